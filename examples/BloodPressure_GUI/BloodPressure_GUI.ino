@@ -45,16 +45,6 @@ const int SW2 = 5;
 const int BUZZ = 7;
 #endif
 
-/**
- * @note  A trick to play when creating fontArial_Rounded_MT_Bold55h. The font width of <space> (hex 0x0020) has been increased to 
- *        the same width as digits 0-9. In BitFontCreator, select 0x0020 with a left mouse click. At the left upper panel locate 
- *        the button with a red + sign. Click on it until the width is adjusted to 29 indicating by a message like this:
- *        Character Editor (w:29*h:55) - 0020<>.
- *        This is to make life easier in vitalSignUpdate() function. Instead of clearing the background color of a field, we
- *        simply need to append empty spaces in front of a vital sign value to get the background cleared for number of different decimal places. 
- *        Example, if a single digit is to be printed in a field of 3 digits, two <space> is appended in front e.g.
- *        String("  ") + String("9") to get the correct indentation.
- */
 extern const BFC_FONT fontArial_Rounded_MT_Bold55h;
 extern const BFC_FONT fontConsolas24h;
 extern const BFC_FONT fontSimHei_35h;
@@ -91,16 +81,14 @@ void buzz(int pin, unsigned int freq, unsigned long duration)
 #define VITAL_SIGN_TOP_MARGIN   50
 #define VITAL_SIGN_LABEL_TOP_MARGIN (VITAL_SIGN_TOP_MARGIN+5)
 
-typedef enum {
-  SYS_PRESSURE=0, //systolic blood pressure
-  DIA_PRESSURE,   //diastolic blood pressure
-  PUL_RATE}       //pulse rate of the heart
-  VITAL_SIGN; 
-
-uint8_t sysPressure, diaPressure, pulRate;
-uint16_t cursorX, cursorY;
+/**
+ * @note  The screen is a tree of widgets in static storage. The loop only sets new values, GFXWidgetRender() repaints
+ *        the widgets that changed and sends their lines to the LCD.
+ */
+GFX_WIDGET screen, sysValue, diaValue, pulValue, battery, arrowUp, arrowDown, heart, message;
+GFX_WIDGET sysLabel, sysUnit, diaLabel, diaUnit, pulLabel;
 
-void vitalSignUpdate(VITAL_SIGN sign, uint8_t data);
+void vitalSignUpdate(int32_t sysData, int32_t diaData, int32_t pulData);
 
 bool IoT_message_received = false;
 
@@ -142,47 +130,63 @@ void setup() {
   buzz(BUZZ,1000,500);
   
   GFXDisplayAllClear();
-  
-  //display the battery icon
-  GFXDisplayPutImage(VITAL_SIGN_LABEL_LEFT_MARGIN+100,5, &battery_46x26, false);
-  //display an up arrow 
-  GFXDisplayPutImage(VITAL_SIGN_LABEL_LEFT_MARGIN+80,50, &arrowUp_89x48, false);
-  //display the down arrow
-  GFXDisplayPutImage(VITAL_SIGN_LABEL_LEFT_MARGIN+80,105, &arrowDown_89x48, false);
-  //display the heart
-  GFXDisplayPutImage(VITAL_SIGN_LABEL_LEFT_MARGIN+100,160, &pulseRate_icon, false);
-  
-  //Print SYS pressure label & unit
-  cursorY = VITAL_SIGN_LABEL_TOP_MARGIN; 
-  GFXDisplayPutString(VITAL_SIGN_LABEL_LEFT_MARGIN, cursorY, &fontConsolas24h, String("SYS.").c_str(), BLACK, WHITE);
-  cursorY +=GFXDisplayGetFontHeight(&fontConsolas24h);
-  GFXDisplayPutString(VITAL_SIGN_LABEL_LEFT_MARGIN, cursorY, &fontConsolas24h, String("mmHg").c_str(), BLACK, WHITE);
-  
-  //Print DIA. pressure label & unit
-  cursorY = VITAL_SIGN_LABEL_TOP_MARGIN + GFXDisplayGetFontHeight(&fontArial_Rounded_MT_Bold55h);
-  GFXDisplayPutString(VITAL_SIGN_LABEL_LEFT_MARGIN, cursorY, &fontConsolas24h, String("DIA.").c_str(), BLACK, WHITE);
-  cursorY +=GFXDisplayGetFontHeight(&fontConsolas24h);
-  GFXDisplayPutString(VITAL_SIGN_LABEL_LEFT_MARGIN, cursorY, &fontConsolas24h, String("mmHg").c_str(), BLACK, WHITE);
- 
-  //Print pulse rate label
-  cursorY = VITAL_SIGN_LABEL_TOP_MARGIN + 2*GFXDisplayGetFontHeight(&fontArial_Rounded_MT_Bold55h) + GFXDisplayGetFontHeight(&fontConsolas24h) +5;
-  GFXDisplayPutString(VITAL_SIGN_LABEL_LEFT_MARGIN, cursorY, &fontConsolas24h, String("PUL.").c_str(), BLACK, WHITE);       
+
+  uint16_t valueH = GFXDisplayGetFontHeight(&fontArial_Rounded_MT_Bold55h);
+  uint16_t labelH = GFXDisplayGetFontHeight(&fontConsolas24h);
+
+  GFXWidgetInitGroup(&screen, 0, 0, GFXDisplayGetLCDWidth(), GFXDisplayGetLCDHeight(), WHITE);
+  //the battery icon, up and down arrows and the heart
+  GFXWidgetInitImage(&battery, VITAL_SIGN_LABEL_LEFT_MARGIN+100, 5, &battery_46x26, false);
+  GFXWidgetInitImage(&arrowUp, VITAL_SIGN_LABEL_LEFT_MARGIN+80, 50, &arrowUp_89x48, false);
+  GFXWidgetInitImage(&arrowDown, VITAL_SIGN_LABEL_LEFT_MARGIN+80, 105, &arrowDown_89x48, false);
+  GFXWidgetInitImage(&heart, VITAL_SIGN_LABEL_LEFT_MARGIN+100, 160, &pulseRate_icon, false);
+  GFXWidgetAdd(&screen, &battery);
+  GFXWidgetAdd(&screen, &arrowUp);
+  GFXWidgetAdd(&screen, &arrowDown);
+  GFXWidgetAdd(&screen, &heart);
+
+  //SYS. & DIA. pressure labels with units, pulse rate label
+  GFXWidgetInitLabel(&sysLabel, VITAL_SIGN_LABEL_LEFT_MARGIN, VITAL_SIGN_LABEL_TOP_MARGIN, &fontConsolas24h, "SYS.", BLACK, WHITE);
+  GFXWidgetInitLabel(&sysUnit, VITAL_SIGN_LABEL_LEFT_MARGIN, VITAL_SIGN_LABEL_TOP_MARGIN + labelH, &fontConsolas24h, "mmHg", BLACK, WHITE);
+  GFXWidgetInitLabel(&diaLabel, VITAL_SIGN_LABEL_LEFT_MARGIN, VITAL_SIGN_LABEL_TOP_MARGIN + valueH, &fontConsolas24h, "DIA.", BLACK, WHITE);
+  GFXWidgetInitLabel(&diaUnit, VITAL_SIGN_LABEL_LEFT_MARGIN, VITAL_SIGN_LABEL_TOP_MARGIN + valueH + labelH, &fontConsolas24h, "mmHg", BLACK, WHITE);
+  GFXWidgetInitLabel(&pulLabel, VITAL_SIGN_LABEL_LEFT_MARGIN, VITAL_SIGN_LABEL_TOP_MARGIN + 2*valueH + labelH + 5, &fontConsolas24h, "PUL.", BLACK, WHITE);
+  GFXWidgetAdd(&screen, &sysLabel);
+  GFXWidgetAdd(&screen, &sysUnit);
+  GFXWidgetAdd(&screen, &diaLabel);
+  GFXWidgetAdd(&screen, &diaUnit);
+  GFXWidgetAdd(&screen, &pulLabel);
+
+  //3-digit fields for the vital signs, right aligned and cleared to WHITE, no padding with <space> needed
+  GFXWidgetInitNumber(&sysValue, VITAL_SIGN_LEFT_MARGIN, VITAL_SIGN_TOP_MARGIN, &fontArial_Rounded_MT_Bold55h, 3, 0, BLACK, WHITE);
+  GFXWidgetInitNumber(&diaValue, VITAL_SIGN_LEFT_MARGIN, VITAL_SIGN_TOP_MARGIN + valueH, &fontArial_Rounded_MT_Bold55h, 3, 0, BLACK, WHITE);
+  GFXWidgetInitNumber(&pulValue, VITAL_SIGN_LEFT_MARGIN, VITAL_SIGN_TOP_MARGIN + 2*valueH, &fontArial_Rounded_MT_Bold55h, 3, 0, BLACK, WHITE);
+  GFXWidgetAdd(&screen, &sysValue);
+  GFXWidgetAdd(&screen, &diaValue);
+  GFXWidgetAdd(&screen, &pulValue);
+
+  //pseudo IoT message, hidden until received
+  GFXWidgetInitImage(&message, (GFXDisplayGetLCDWidth()-320)/2, 260, &IoT_message, false);
+  GFXWidgetSetVisible(&message, false);
+  GFXWidgetAdd(&screen, &message);
+
+  GFXWidgetRender(&screen);
 }
 
 void loop() {  
-    for(sysPressure=70; sysPressure<120; sysPressure++)
+    for(int32_t sysPressure=70; sysPressure<120; sysPressure++)
     {
-      vitalSignUpdate(SYS_PRESSURE, sysPressure);
+      vitalSignUpdate(sysPressure, diaValue.value, pulValue.value);
       delay(50);
     }
-    for(diaPressure=60; diaPressure<80; diaPressure++)
+    for(int32_t diaPressure=60; diaPressure<80; diaPressure++)
     {
-      vitalSignUpdate(DIA_PRESSURE, diaPressure);
+      vitalSignUpdate(sysValue.value, diaPressure, pulValue.value);
       delay(50);
     }
-    for(pulRate=60; pulRate<80; pulRate++)
+    for(int32_t pulRate=60; pulRate<80; pulRate++)
     {
-      vitalSignUpdate(PUL_RATE, pulRate);
+      vitalSignUpdate(sysValue.value, diaValue.value, pulRate);
       delay(50);
     }
 
@@ -190,62 +194,30 @@ void loop() {
     #if defined LS032B7DD02
     if(!IoT_message_received)
     {
-      GFXDisplayPutImage((GFXDisplayGetLCDWidth()-320)/2,260, &IoT_message, 0);
+      GFXWidgetSetVisible(&message, true);
       IoT_message_received = true;
     }
     #endif
 
     int count = 0;
-    sysPressure=90; diaPressure=52; pulRate=66; //initialize parameters for 'some' value
     while(count++ <30)
     {
-      vitalSignUpdate(SYS_PRESSURE, sysPressure+count);
-      vitalSignUpdate(DIA_PRESSURE, diaPressure+count);
-      vitalSignUpdate(PUL_RATE, pulRate+count);
+      vitalSignUpdate(90+count, 52+count, 66+count);  //'some' values
       delay(50);
     }
   }
 
 /**
  * @brief Function to update vital sign data on Memory LCD
- * @param sign is an enum type defined in this file
- * @param data is the vital sign value to print
- * @note  A trick to play when creating fontArial_Rounded_MT_Bold55h. The font width of <space> (hex 0x0020) has been increased to 
- *        the same width as digits 0-9. In BitFontCreator, select 0x0020 with a left mouse click. At the left upper panel locate 
- *        the button with a red + sign. Click on it until the width is adjusted to 29 indicating by a message like this:
- *        Character Editor (w:29*h:55) - 0020<>.
- *        This is to make life easier in vitalSignUpdate() function. Instead of clearing the background color of a field, we
- *        simply need to append empty spaces in front of a vital sign value to get the background cleared for number of different decimal places. 
- *        Example, if a single digit is to be printed in a field of 3 digits, two <space> is appended in front e.g.
- *        String("  ") + String("9") to get the correct indentation.
+ * @param sysData is the systolic blood pressure
+ * @param diaData is the diastolic blood pressure
+ * @param pulData is the pulse rate of the heart
+ * @note  Only the digits that have changed are drawn again, and their rows sent in a single SPI transaction.
  */
-void vitalSignUpdate(VITAL_SIGN sign, uint8_t data)
+void vitalSignUpdate(int32_t sysData, int32_t diaData, int32_t pulData)
 {
-  String signString;
-
-  cursorX = VITAL_SIGN_LEFT_MARGIN;
-  
-  if(sign==SYS_PRESSURE)
-    cursorY = VITAL_SIGN_TOP_MARGIN;
-  else if (sign==DIA_PRESSURE)
-    cursorY = VITAL_SIGN_TOP_MARGIN + GFXDisplayGetFontHeight(&fontArial_Rounded_MT_Bold55h); 
-  else
-    cursorY = VITAL_SIGN_TOP_MARGIN + 2*GFXDisplayGetFontHeight(&fontArial_Rounded_MT_Bold55h); 
-
-    if(data<10) //single digit
-    {
-     signString = String("  ")+String(data); //1x <space> in front of a single digit, with <space> adjusted to the same width as digits 0-9 in BitFontCreator
-    }
-    else if (data>9 && data<100) //2 digits
-    {
-      signString = String(" ")+String(data);//2x <space> in front of a double digit
-    }
-    else
-    {
-      signString = String(data);
-    }
-
-    GFXDisplayPutString(cursorX, cursorY, &fontArial_Rounded_MT_Bold55h, signString.c_str(), BLACK, WHITE);
+  GFXWidgetSetValue(&sysValue, sysData);
+  GFXWidgetSetValue(&diaValue, diaData);
+  GFXWidgetSetValue(&pulValue, pulData);
+  GFXWidgetRender(&screen);
 }
-
-
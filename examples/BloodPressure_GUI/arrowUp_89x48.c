@@ -133,5 +133,5 @@ static const uint8_t image_data_arrowUp_89x48[600] = {
     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80
 };
 const tImage arrowUp_89x48 = { image_data_arrowUp_89x48, 89, 50,
-    8 };
+    8, TIMAGE_RAW };
 
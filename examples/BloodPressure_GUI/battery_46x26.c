@@ -85,5 +85,5 @@ static const uint8_t image_data_battery_46x26[156] = {
     0xff, 0xff, 0xff, 0xff, 0xff, 0xfc
 };
 const tImage battery_46x26 = { image_data_battery_46x26, 46, 26,
-    8 };
+    8, TIMAGE_RAW };
 
@@ -129,5 +129,5 @@ static const uint8_t image_data_pulseRate_icon[288] = {
     0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
 const tImage pulseRate_icon = { image_data_pulseRate_icon, 48, 48,
-    8 };
+    8, TIMAGE_RAW };
 
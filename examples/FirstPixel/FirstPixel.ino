@@ -32,8 +32,6 @@ void buzz(int pin, unsigned int freq, unsigned long duration)
   tone(pin,freq,duration);
 }
 
-void drawLine(int x1, int y1, int x2, int y2, COLOR color);
-
 void setup() {
   hal_bsp_init();
   GFXDisplayPowerOn();
@@ -49,14 +47,14 @@ void loop() {
       if(digitalRead(SW3)==LOW)
       {
         buzz(BUZZ,1000,100);
-        drawLine(0,0,DISP_HOR_RESOLUTION-1,DISP_VER_RESOLUTION-1,BLACK);  //draw a diagonal from top left to bottom right
-        drawLine(DISP_HOR_RESOLUTION-1,0,0,DISP_VER_RESOLUTION-1,BLACK);  //draw a diagonal from top right to bottom left
+        GFXDisplayDrawLine(0,0,DISP_HOR_RESOLUTION-1,DISP_VER_RESOLUTION-1,BLACK);  //draw a diagonal from top left to bottom right
+        GFXDisplayDrawLine(DISP_HOR_RESOLUTION-1,0,0,DISP_VER_RESOLUTION-1,BLACK);  //draw a diagonal from top right to bottom left
         
-        drawLine(1,1,DISP_HOR_RESOLUTION-2,1,BLACK);  //horizontal top line at y=1
-        drawLine(1,DISP_VER_RESOLUTION-2,DISP_HOR_RESOLUTION-2,DISP_VER_RESOLUTION-2,BLACK);  //horizontal bottom line at y=DISP_VER_RESOLUTION-2
+        GFXDisplayDrawLine(1,1,DISP_HOR_RESOLUTION-2,1,BLACK);  //horizontal top line at y=1
+        GFXDisplayDrawLine(1,DISP_VER_RESOLUTION-2,DISP_HOR_RESOLUTION-2,DISP_VER_RESOLUTION-2,BLACK);  //horizontal bottom line at y=DISP_VER_RESOLUTION-2
 
-        drawLine(1,1,1,DISP_VER_RESOLUTION-2,BLACK);  //vertical line at x=1
-        drawLine(DISP_HOR_RESOLUTION-2,1,DISP_HOR_RESOLUTION-2,DISP_VER_RESOLUTION-2,BLACK);  //vertical line at x=DISP_HOR_RESOLUTION-2
+        GFXDisplayDrawLine(1,1,1,DISP_VER_RESOLUTION-2,BLACK);  //vertical line at x=1
+        GFXDisplayDrawLine(DISP_HOR_RESOLUTION-2,1,DISP_HOR_RESOLUTION-2,DISP_VER_RESOLUTION-2,BLACK);  //vertical line at x=DISP_HOR_RESOLUTION-2
         while(digitalRead(SW3)==LOW)
         ;
       }
@@ -73,81 +71,3 @@ void loop() {
       }
     }
   }
-
-/*
-**********************************************************************************************************
-* @brief  Line draw function from Programming The Nintendo Game Boy Advance: The Unofficial Guide
-*         Copyright (c)2003 by Jonathan S. Harbour -- http://www.jharbour.com
-**********************************************************************************************************
-*/
-void drawLine(int x1, int y1, int x2, int y2, COLOR color)
-{
-  int i, deltax, deltay, numpixels;
-  int d, dinc1, dinc2;
-  int x, xinc1, xinc2;
-  int y, yinc1, yinc2;
-  //calculate deltaX and deltaY
-  deltax = fabs(x2 - x1);
-  deltay = fabs(y2 - y1);
-
-  //initialize
-  if(deltax >= deltay)
-  {
-  //If x is independent variable
-  numpixels = deltax + 1;
-  d = (2 * deltay) - deltax;
-  dinc1 = deltay << 1;
-  dinc2 = (deltay - deltax) << 1;
-  xinc1 = 1;
-  xinc2 = 1;
-  yinc1 = 0;
-  yinc2 = 1;
-  }
-  else
-  {
-  //if y is independent variable
-  numpixels = deltay + 1;
-  d = (2 * deltax) - deltay;
-  dinc1 = deltax << 1;
-  dinc2 = (deltax - deltay) << 1;
-  xinc1 = 0;
-  xinc2 = 1;
-  yinc1 = 1;
-  yinc2 = 1;
-  }
-
-  //move the right direction
-  if(x1 > x2)
-  {
-  xinc1 = -xinc1;
-  xinc2 = -xinc2;
-  }
-  if(y1 > y2)
-  {
-  yinc1 = -yinc1;
-  yinc2 = -yinc2;
-  }
-
-  x = x1;
-  y = y1;
-  //draw the pixels
-  for(i = 1; i < numpixels; i++)
-  {
-  GFXDisplayPutPixel(x, y, color);
-  if(d < 0)
-  {
-    d = d + dinc1;
-    x = x + xinc1;
-    y = y + yinc1;
-  }
-  else
-  {
-    d = d + dinc2;
-    x = x + xinc2;
-    y = y + yinc2;
-  }
-  }  
-}
-
-
-
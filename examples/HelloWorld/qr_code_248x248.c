@@ -529,5 +529,5 @@ static const uint8_t image_data_qr_code_248x248[7688] = {
     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
 const tImage qr_code_248x248 = { image_data_qr_code_248x248, 248, 248,
-    8 };
+    8, TIMAGE_RAW };
 
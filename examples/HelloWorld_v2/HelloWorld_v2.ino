@@ -43,7 +43,7 @@ extern const BFC_FONT fontSimHei_35h;
 extern const BFC_FONT fontBerlinSans_FB30h;
 
 extern const tImage cat_400x246;
-extern const tImage qr_code_248x248;
+extern const tImage qr_code_248x248_rle;	//TIMAGE_RLE, 1055 bytes instead of 7688
 extern const tImage qrcode_33x33;
 extern const tImage beating_64x64;
 extern const tImage pulse_64x48;
@@ -51,6 +51,12 @@ extern const tImage run_64x64;
 extern const tImage step_64x64;
 extern const tImage swim_64x64;
 
+///@note The sport icons as one animation, each frame shown for 400 ms
+const GFX_ANIM_FRAME sportFrames[] = { {&run_64x64, 400}, {&step_64x64, 400}, {&swim_64x64, 400} };
+///@note A beating heart, the pulse frame shorter
+const GFX_ANIM_FRAME heartFrames[] = { {&beating_64x64, 500}, {&pulse_64x48, 150} };
+GFX_ANIM sportIcon, heartIcon;
+
 ///@note Font: SimHei 35 こんにちは in unicode 16
 const uint16_t hello_japanese[]={0x3053, 0x3093, 0x306B, 0x3061, 0x306F, '\0'};
 ///@note Font: SimHei 35 你好 in unicode 16
@@ -79,13 +85,16 @@ void setup() {
 /**
  * @brief A very simple function to hold the program for any key press SW2 or SW3.
  *        This function halt the program with an infinite loop. 
+ * @param pAnim: animations kept running while waiting, NULL for none
  */
-void waitKeyPress(void)
+void waitKeyPress(GFX_ANIM *pAnim = NULL)
 {
   uint16_t timeout = 3000;	//count in msec
   
   while(digitalRead(SW3)==HIGH && digitalRead(SW2)==HIGH && timeout>0)
   {
+	if(pAnim != NULL)
+		GFXAnimTick(pAnim);	//the rows of the frames due, one flush for all of them
 	delay(1);
 	timeout--;
   }
@@ -102,6 +111,36 @@ void waitKeyPress(void)
     }
 }
 
+/**
+ * @brief Plot 3 sine curves in different phases with strip charts, 20 samples per batch like a sampled signal would arrive.
+ *        Each batch refreshes only the rows its segments span.
+ * @param left: left edge of the charts
+ */
+void plotSines(uint16_t left)
+{
+  static GFX_CHART chart[3];
+  int16_t samples[20];
+  uint16_t amplitudeMax = GFXDisplayGetLCDHeight()/4;
+  uint16_t top = GFXDisplayGetLCDHeight()/2 - amplitudeMax;
+  uint16_t c, d, n;
+
+  for(c=0; c<3; c++)
+  {
+    GFXDisplayChartInit(&chart[c], left, top, GFXDisplayGetLCDWidth()-left, 2*amplitudeMax+1, -1000, 1000, GFX_CHART_SWEEP, NULL);
+    chart[c].bg = TRANSPARENT;  //overlay the curves
+  }
+  for(d=0; d<GFXDisplayGetLCDWidth()-left; d+=n)
+  {
+    n = MIN((uint16_t)20, (uint16_t)(GFXDisplayGetLCDWidth()-left-d));
+    for(c=0; c<3; c++)
+    {
+      for(uint16_t i=0; i<n; i++)
+        samples[i] = -1000*sin(DEG_TO_RAD * (2*(d+i) + 90*c));
+      GFXDisplayChartAddSamples(&chart[c], samples, n);
+    }
+  }
+}
+
 /**
  * Main loop to run each demo page in round-robin. Press either SW2 or SW3 to cycle through...
  */
@@ -149,7 +188,8 @@ void loop() {
 
     GFXDisplayPutString(7,2,&fontBerlinSans_FB30h, (String(rtc_min) + String(":")).c_str(), BLACK, WHITE);
     #if defined (LS011B7DH03)
-    GFXDisplayPutImage(80,5,&run_64x64,0);
+    GFXAnimInit(&sportIcon, sportFrames, 3, 80, 5, WHITE, NULL);
+    GFXAnimStart(&sportIcon, 0);
     #endif
     do{
       if(rtc_sec==0)
@@ -173,30 +213,26 @@ void loop() {
       }
       prev_secString = secString;
       buzz(BUZZ,300,50);
-      delay(1000-50);
+      uint32_t secMillis = millis();
+      do{
+        #if defined (LS011B7DH03)
+        GFXAnimTick(&sportIcon);  //the icon runs while the seconds count
+        #endif
+      }while(millis() - secMillis < 1000-50);
     }while(rtc_sec++ < 10);
     
-    waitKeyPress(); GFXDisplayAllClear();
+    #if defined (LS011B7DH03)
+    waitKeyPress(&sportIcon); GFXAnimStop(&sportIcon, false);
+    #else
+    waitKeyPress();
+    #endif
+    GFXDisplayAllClear();
     
     GFXDisplayLineDrawH(0, GFXDisplayGetLCDWidth()-1, 5, BLACK, 2);
     GFXDisplayLineDrawV(5, 0, GFXDisplayGetLCDHeight()-1, BLACK, 2);
     waitKeyPress();
-    uint16_t y = GFXDisplayGetLCDHeight()/2;
-    uint16_t amplitudeMax = GFXDisplayGetLCDHeight()/4;
-    uint16_t d;
     //plot 3 sine curves in different phases
-    for(d=0; d<GFXDisplayGetLCDWidth()*2; d++) //plot a sine curve
-    {      
-      GFXDisplayPutPixel(10+d/2, y+amplitudeMax*sin(DEG_TO_RAD *d), BLACK);
-    }
-    for(d=0; d<GFXDisplayGetLCDWidth()*2; d++) 
-    {      
-      GFXDisplayPutPixel(10+d/2, y+amplitudeMax*sin(DEG_TO_RAD * (d + 90)), BLACK);
-    }
-    for(d=0; d<GFXDisplayGetLCDWidth()*2; d++)
-    {      
-      GFXDisplayPutPixel(10+d/2, y+amplitudeMax*sin(DEG_TO_RAD * (d+180)), BLACK);
-    }
+    plotSines(10);
     waitKeyPress(); GFXDisplayAllClear();
 
 #else
@@ -216,28 +252,22 @@ void loop() {
     GFXDisplayLineDrawH(0, GFXDisplayGetLCDWidth()-1, 20, BLACK, 3);
     GFXDisplayLineDrawV(10, 0, GFXDisplayGetLCDHeight()-1, BLACK, 3);
     waitKeyPress();
-    uint16_t y = GFXDisplayGetLCDHeight()/2;
-    uint16_t amplitudeMax = GFXDisplayGetLCDHeight()/4;
-    uint16_t d;
     //plot 3 sine curves in different phases
-    for(d=0; d<GFXDisplayGetLCDWidth()*2; d++) //plot a sine curve
-    {      
-      GFXDisplayPutPixel(10+d/2, y+amplitudeMax*sin(DEG_TO_RAD *d), BLACK);
-    }
-    for(d=0; d<GFXDisplayGetLCDWidth()*2; d++) 
-    {      
-      GFXDisplayPutPixel(10+d/2, y+amplitudeMax*sin(DEG_TO_RAD * (d + 90)), BLACK);
-    }
-    for(d=0; d<GFXDisplayGetLCDWidth()*2; d++)
-    {      
-      GFXDisplayPutPixel(10+d/2, y+amplitudeMax*sin(DEG_TO_RAD * (d+180)), BLACK);
-    }
+    plotSines(10);
     waitKeyPress();
     GFXDisplayAllClear();
     
     GFXDisplayPutImage(0,0,&cat_400x246,0);
     waitKeyPress(); GFXDisplayAllClear();
-    GFXDisplayPutImage((GFXDisplayGetLCDWidth()-248)/2,0,&qr_code_248x248,0);
+
+    GFXAnimInit(&sportIcon, sportFrames, 3, 10, 10, WHITE, NULL);
+    GFXAnimInit(&heartIcon, heartFrames, 2, 90, 10, WHITE, NULL);
+    GFXAnimAdd(&sportIcon, &heartIcon);   //ticked together
+    GFXAnimStart(&sportIcon, 0);
+    GFXAnimStart(&heartIcon, 0);
+    waitKeyPress(&sportIcon);
+    GFXDisplayAllClear();
+    GFXDisplayPutImage((GFXDisplayGetLCDWidth()-248)/2,0,&qr_code_248x248_rle,0);
     waitKeyPress();
     GFXDisplayOff();  //take DISP in '0' to switch display off. Memory content no change. It is a good time to start checking on power consumption.
                       //measure TP7 vs TP8 with a better multimeter (set to mV measurement) to cross check the current
@@ -525,5 +525,5 @@ static const uint8_t image_data_cat_400x246[12300] = {
     0xb6, 0xad, 0x6d, 0x5b, 0xef, 0x6d, 0x7b, 0xba, 0xd7, 0x77, 0x7f, 0xef, 0xef, 0xf5, 0xbd, 0xf5, 0xbf, 0xff, 0x56, 0xff, 0xbd, 0xd6, 0xd7, 0xbf, 0xfb, 0xdf, 0xb7, 0x7b, 0x5f, 0xdf, 0xb6, 0xfb, 0x7d, 0x7b, 0xff, 0x76, 0xbd, 0xeb, 0xfe, 0xed, 0x7b, 0x56, 0xda, 0xd7, 0xda, 0xed, 0x6d, 0xab, 0x6e, 0xd5
 };
 const tImage cat_400x246 = { image_data_cat_400x246, 400, 246,
-    8 };
+    8, TIMAGE_RAW };
 
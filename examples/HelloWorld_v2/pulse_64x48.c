@@ -129,5 +129,5 @@ static const uint8_t image_data_pulse_64x48[384] = {
     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
 const tImage pulse_64x48 = { image_data_pulse_64x48, 64, 48,
-    8 };
+    8, TIMAGE_RAW };
 
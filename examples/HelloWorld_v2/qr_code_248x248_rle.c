@@ -0,0 +1,80 @@
+/*******************************************************************************
+* generated by extras/host/image_rle.cpp from qr_code_248x248.bmp
+* image: qr_code_248x248_rle, 248x248
+* TIMAGE_RLE: PackBits per row, 1055 bytes, 7688 bytes uncompressed
+*******************************************************************************/
+
+#include <stdint.h>
+#include <tImage.h>
+
+static const uint8_t image_data_qr_code_248x248_rle[1055] = {
+    0xe2, 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0xff, 0xc0, 0xfb, 0x00, 0x08,
+    0x3f, 0xff, 0xff, 0xc0, 0x3f, 0xc0, 0x00, 0x3f, 0xc0, 0xfd, 0x00, 0x02, 0x3f, 0xff, 0xc0, 0xfb,
+    0x00, 0x00, 0x3f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0xff, 0xc0, 0x3f, 0xfd, 0xff,
+    0x06, 0xc0, 0x3f, 0xc0, 0x3f, 0xff, 0xff, 0xc0, 0xfe, 0x00, 0x07, 0x3f, 0xff, 0xc0, 0x3f, 0xc0,
+    0x3f, 0xc0, 0x3f, 0xfd, 0xff, 0x01, 0xc0, 0x3f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x1e,
+    0xff, 0xc0, 0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xff, 0xc0, 0x3f, 0xc0, 0x3f,
+    0xc0, 0x00, 0x3f, 0xff, 0xff, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x3f, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x13, 0xff, 0xc0, 0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x3f,
+    0xff, 0xc0, 0x3f, 0xc0, 0x00, 0x3f, 0xc0, 0x3f, 0xff, 0xc0, 0x3f, 0xfe, 0xff, 0x07, 0xc0, 0x3f,
+    0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x3f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x1e, 0xff, 0xc0,
+    0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x3f, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xc0, 0x3f, 0xc0, 0x3f,
+    0xff, 0xff, 0xc0, 0x00, 0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x3f, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x02, 0xff, 0xc0, 0x3f, 0xfd, 0xff, 0x04, 0xc0, 0x3f, 0xff, 0xff, 0xc0,
+    0xf7, 0x00, 0x02, 0x3f, 0xc0, 0x3f, 0xfd, 0xff, 0x01, 0xc0, 0x3f, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x01, 0xff, 0xc0, 0xfb, 0x00, 0x0f, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0,
+    0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0xfb, 0x00, 0x00, 0x3f, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xf6, 0xff, 0x0a, 0xc0, 0x00, 0x3f, 0xff, 0xc0, 0x3f, 0xc0, 0x00, 0x3f, 0xc0,
+    0x3f, 0xf8, 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0xff, 0x13, 0xc0, 0x00, 0x00,
+    0x3f, 0xc0, 0x00, 0x3f, 0xff, 0xc0, 0x3f, 0xc0, 0x3f, 0xff, 0xff, 0xc0, 0x3f, 0xc0, 0x00, 0x00,
+    0x3f, 0xfc, 0xff, 0x03, 0xc0, 0x00, 0x3f, 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfd,
+    0xff, 0x13, 0xc0, 0x3f, 0xc0, 0x3f, 0xff, 0xc0, 0x00, 0x3f, 0xc0, 0x00, 0x3f, 0xc0, 0x3f, 0xc0,
+    0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0xfd, 0x00, 0x02, 0x3f, 0xc0, 0x3f, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xff, 0xff, 0x04, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0xfc, 0x00, 0x09, 0x3f, 0xc0,
+    0x00, 0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0x3f, 0xc0, 0xfe, 0x00, 0x05, 0x3f, 0xff, 0xff, 0xc0, 0x3f,
+    0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x0a, 0xff, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f,
+    0xff, 0xc0, 0x00, 0x3f, 0xfe, 0xff, 0x01, 0xc0, 0x3f, 0xfe, 0xff, 0x06, 0xc0, 0x3f, 0xc0, 0x00,
+    0x3f, 0xc0, 0x3f, 0xfe, 0xff, 0x01, 0xc0, 0x3f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x05,
+    0xff, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0xfd, 0x00, 0x10, 0x3f, 0xff, 0xff, 0xc0, 0x3f, 0xc0, 0x3f,
+    0xc0, 0x00, 0x3f, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xc0, 0xfe, 0x00, 0x00, 0x3f, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x06, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x3f, 0xfe, 0xff, 0x07,
+    0xc0, 0x3f, 0xc0, 0x3f, 0xff, 0xc0, 0x3f, 0xc0, 0xfe, 0x00, 0x09, 0x3f, 0xff, 0xc0, 0x00, 0x3f,
+    0xc0, 0x00, 0x3f, 0xc0, 0x3f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0xff, 0x1c, 0xc0,
+    0x3f, 0xff, 0xc0, 0x3f, 0xc0, 0x00, 0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xff, 0xc0, 0x00,
+    0x3f, 0xc0, 0x00, 0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0x3f, 0xc0, 0x00, 0x3f, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x0b, 0xff, 0xc0, 0x3f, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x3f,
+    0xfd, 0xff, 0x0b, 0xc0, 0x3f, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xc0, 0x3f, 0xff, 0xc0, 0x3f, 0xfe,
+    0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x06, 0xff, 0xc0, 0x3f, 0xc0, 0x3f, 0xff, 0xc0,
+    0xfe, 0x00, 0x03, 0x3f, 0xc0, 0x00, 0x3f, 0xfc, 0xff, 0x0b, 0xc0, 0x3f, 0xc0, 0x00, 0x3f, 0xff,
+    0xc0, 0x00, 0x3f, 0xff, 0xc0, 0x3f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0xff, 0xc0,
+    0x3f, 0xc0, 0xfe, 0x00, 0x05, 0x3f, 0xff, 0xff, 0xc0, 0x3f, 0xc0, 0xfe, 0x00, 0x09, 0x3f, 0xc0,
+    0x00, 0x3f, 0xff, 0xc0, 0x00, 0x3f, 0xc0, 0x3f, 0xfc, 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xff, 0xff, 0x0c, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x3f,
+    0xc0, 0xfe, 0x00, 0x08, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xfd, 0xff, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0xff, 0xc0, 0xfc, 0x00, 0x17, 0x3f, 0xff, 0xc0, 0x3f,
+    0xff, 0xff, 0xc0, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xc0,
+    0x00, 0x3f, 0xff, 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x10, 0xff, 0xc0, 0x3f, 0xc0,
+    0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0x3f, 0xc0, 0x3f, 0xff, 0xc0, 0x00, 0x3f, 0xc0, 0xf6, 0x00, 0x02,
+    0x3f, 0xc0, 0x3f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xf8, 0xff, 0x01, 0xc0, 0x3f, 0xfb,
+    0xff, 0x0d, 0xc0, 0x00, 0x3f, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xc0, 0x00, 0x3f,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0xff, 0xc0, 0xfb, 0x00, 0x16, 0x3f, 0xff, 0xc0,
+    0x00, 0x00, 0x3f, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f,
+    0xc0, 0x00, 0x3f, 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0xff, 0xc0, 0x3f, 0xfd,
+    0xff, 0x07, 0xc0, 0x3f, 0xc0, 0x3f, 0xff, 0xff, 0xc0, 0x3f, 0xfd, 0xff, 0x0b, 0xc0, 0x3f, 0xc0,
+    0x3f, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xc0, 0x00, 0x3f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x08, 0xff, 0xc0, 0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x3f, 0xfe, 0xff, 0x09, 0xc0, 0x3f, 0xff,
+    0xc0, 0x3f, 0xff, 0xc0, 0x3f, 0xff, 0xc0, 0xfa, 0x00, 0x01, 0x3f, 0xff, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x0d, 0xff, 0xc0, 0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xff,
+    0xff, 0xc0, 0xfe, 0x00, 0x0d, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xff, 0xc0, 0x3f, 0xff,
+    0xff, 0xc0, 0x3f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x0b, 0xff, 0xc0, 0x3f, 0xc0, 0x00,
+    0x00, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0xfd, 0x00, 0x00, 0x3f, 0xfc, 0xff, 0x08, 0xc0, 0x3f,
+    0xff, 0xff, 0xc0, 0x3f, 0xff, 0xc0, 0x3f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0xff,
+    0xc0, 0x3f, 0xfd, 0xff, 0x17, 0xc0, 0x3f, 0xc0, 0x00, 0x3f, 0xc0, 0x00, 0x3f, 0xff, 0xc0, 0x00,
+    0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xc0, 0x3f, 0xff, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x01, 0xff, 0xc0, 0xfb, 0x00, 0x04, 0x3f, 0xff, 0xc0, 0x3f, 0xc0, 0xfd,
+    0x00, 0x0d, 0x3f, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xc0, 0x3f, 0xff,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xe2, 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80
+};
+const tImage qr_code_248x248_rle = { image_data_qr_code_248x248_rle, 248, 248,
+    8, TIMAGE_RLE };
+
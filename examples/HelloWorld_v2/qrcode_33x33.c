@@ -99,5 +99,5 @@ static const uint8_t image_data_qrcode_33x33[165] = {
     0x01, 0x78, 0x1b, 0xe1, 0x80
 };
 const tImage qrcode_33x33 = { image_data_qrcode_33x33, 33, 33,
-    8 };
+    8, TIMAGE_RAW };
 
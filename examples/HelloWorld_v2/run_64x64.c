@@ -161,5 +161,5 @@ static const uint8_t image_data_run_64x64[512] = {
     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
 const tImage run_64x64 = { image_data_run_64x64, 64, 64,
-    8 };
+    8, TIMAGE_RAW };
 
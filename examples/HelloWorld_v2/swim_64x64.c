@@ -161,5 +161,5 @@ static const uint8_t image_data_swim_64x64[512] = {
     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
 const tImage swim_64x64 = { image_data_swim_64x64, 64, 64,
-    8 };
+    8, TIMAGE_RAW };
 
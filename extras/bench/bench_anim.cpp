@@ -0,0 +1,225 @@
+/**
+ * @brief	Host check and benchmark of frame animations (GFXAnimTick()).
+ *			The 64x64 icons of HelloWorld_v2 run as four animations linked together: an opaque sequence, a TRANSPARENT one
+ *			over a striped background with frames of two sizes, one played twice and then moved and erased, and the run
+ *			icon with a progress bar filling up in its bottom rows. Simulated time goes on in steps of 10 ms; after every
+ *			tick the panel has to match the background and the frames due drawn from scratch, and every tick may send one
+ *			update at most (one SCS window without GFX_SCS_MAX_US). The lines sent are reported against drawing every frame
+ *			due with GFXDisplayPutImage() and flushing each animation on its own. The same ticks run on a banded display.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/bench/bench_anim.cpp extras/host/MemoryLCDSim.cpp src/MemoryLCD.cpp src/bfcFontMgr.c \
+ *				examples/HelloWorld_v2/run_64x64.c examples/HelloWorld_v2/step_64x64.c examples/HelloWorld_v2/swim_64x64.c \
+ *				examples/HelloWorld_v2/beating_64x64.c examples/HelloWorld_v2/pulse_64x48.c -lstdc++ -o bench_anim && ./bench_anim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+#include "bench_util.h"
+
+extern const tImage run_64x64;
+extern const tImage step_64x64;
+extern const tImage swim_64x64;
+extern const tImage beating_64x64;
+extern const tImage pulse_64x48;
+
+#define TICK_MS		10
+#define RUN_MS		6000
+
+static const GFX_ANIM_FRAME sport[] = { {&run_64x64, 200}, {&step_64x64, 150}, {&swim_64x64, 250}, {&step_64x64, 150} };
+static const GFX_ANIM_FRAME heart[] = { {&beating_64x64, 120}, {&pulse_64x48, 80}, {&beating_64x64, 300}, {&pulse_64x48, 80} };
+static const GFX_ANIM_FRAME swim[]  = { {&swim_64x64, 90}, {&run_64x64, 90}, {&beating_64x64, 90} };
+
+
+#define PROGRESS_FRAMES	8
+static uint8_t progressData[PROGRESS_FRAMES][512];
+static tImage progressImage[PROGRESS_FRAMES];
+static GFX_ANIM_FRAME progress[PROGRESS_FRAMES];
+
+static GFX_ANIM sportAnim, heartAnim, swimAnim, progressAnim;
+static GFX_ANIM *const anims[] = { &sportAnim, &heartAnim, &swimAnim, &progressAnim };
+#define ANIMS	(sizeof(anims) / sizeof(anims[0]))
+static uint8_t heartUnder[GFX_ANIM_UNDER_SIZE(64, 64)];
+
+typedef struct
+{
+	uint16_t	left, top, right, bottom;
+	COLOR		color;
+} BOX;
+
+static BOX erased[4];			//boxes an animation without a frame buffer to keep what was below has been erased with
+static uint16_t erasedCount;
+
+static GFX_DISPLAY refLcd;
+static uint8_t refBuffer[GFX_FB_SIZE(DISP_HOR_RESOLUTION, GFX_FB_CANVAS_H)], refDirty[(GFX_FB_CANVAS_H + 7) / 8];
+
+/**
+ * @brief	Stripes and a frame below the TRANSPARENT animation
+ */
+static void drawBackground(void)
+{
+	for(uint16_t y = 100; y < 180; y += 3)
+		GFXDisplayLineDrawH(90, 200, y, BLACK, 1);
+	GFXDisplayDrawLine(90, 100, 200, 179, BLACK);
+}
+
+/**
+ * @brief	The run icon with a bar in its bottom 6 rows, 1/8 longer every frame: the rows above it are the same in every frame
+ */
+static void buildProgress(void)
+{
+	for(uint16_t f = 0; f < PROGRESS_FRAMES; f++)
+	{
+		memcpy(progressData[f], run_64x64.data, sizeof(progressData[f]));
+		for(uint16_t y = 58; y < 64; y++)
+			memset(&progressData[f][y * 8], 0x00, f + 1);		//black bytes, leftmost pixel in the MSB
+		progressImage[f] = run_64x64;
+		progressImage[f].data = progressData[f];
+		progress[f].image = &progressImage[f];
+		progress[f].ms = 100;
+	}
+}
+
+/**
+ * @brief	Move an animation or erase it, the box it leaves is filled with bg unless the frame buffer keeps what was below
+ */
+static void leave(GFX_ANIM *pAnim, GFX_DISPLAY *pLcd, bool move, uint16_t left, uint16_t top)
+{
+	if((pAnim->bg != TRANSPARENT) || pLcd->bandLines)
+		erased[erasedCount++] = (BOX){pAnim->left, pAnim->top, (uint16_t)(pAnim->left + pAnim->width - 1),
+									  (uint16_t)(pAnim->top + pAnim->height - 1), (pAnim->bg == TRANSPARENT) ? WHITE : pAnim->bg};
+	if(move)
+		GFXAnimMove(pAnim, left, top);
+	else
+		GFXAnimStop(pAnim, true);
+}
+
+/**
+ * @return	true if the panel shows the background and the frames of the animations drawn from scratch
+ */
+static bool panelMatches(GFX_DISPLAY *pLcd)
+{
+	memset(refBuffer, 0xFF, sizeof(refBuffer));
+	GFXDisplaySelect(&refLcd);
+	drawBackground();
+	for(uint16_t i = 0; i < erasedCount; i++)
+		GFXDisplayDrawRect(erased[i].left, erased[i].top, erased[i].right, erased[i].bottom, erased[i].color);
+	for(uint16_t i = 0; i < ANIMS; i++)
+	{
+		const GFX_ANIM *a = anims[i];
+		if(!(a->flags & GFX_ANIM_SHOWN))
+			continue;
+		if((a->bg == TRANSPARENT) && !pLcd->bandLines)
+			GFXDisplaySetRasterOp(GFX_ROP_AND);
+		else
+			GFXDisplayDrawRect(a->left, a->top, a->left + a->width - 1, a->top + a->height - 1, (a->bg == TRANSPARENT) ? WHITE : a->bg);
+		GFXDisplayPutImage(a->left, a->top, a->frames[a->frame].image, false);
+		GFXDisplaySetRasterOp(GFX_ROP_SET);
+	}
+	return panelShows(&refLcd, pLcd);
+}
+
+static bool runScenario(GFX_DISPLAY *pLcd, const char *name)
+{
+	uint32_t ticks = 0, changes = 0, lines = 0, transactions = 0, wholeLines = 0, wholeTransactions = 0;
+	uint64_t busNs = 0;
+	bool ok = true;
+
+	GFXDisplaySelect(pLcd);
+	GFXDisplayAllClear();
+	GFXDisplaySetFlushMode(GFX_FLUSH_IMMEDIATE);
+	drawBackground();
+
+	GFXAnimInit(&sportAnim, sport, 4, 5, 5, WHITE, NULL);
+	GFXAnimInit(&heartAnim, heart, 4, 110, 105, TRANSPARENT, heartUnder);
+	GFXAnimInit(&swimAnim, swim, 3, 250, 20, WHITE, NULL);
+	GFXAnimInit(&progressAnim, progress, PROGRESS_FRAMES, 300, 150, WHITE, NULL);
+	GFXAnimAdd(&sportAnim, &heartAnim);
+	GFXAnimAdd(&sportAnim, &swimAnim);
+	GFXAnimAdd(&sportAnim, &progressAnim);
+	GFXAnimStart(&sportAnim, 0);
+	GFXAnimStart(&heartAnim, 0);
+	GFXAnimStart(&swimAnim, 2);
+	GFXAnimStart(&progressAnim, 0);
+	erasedCount = 0;
+
+	for(uint32_t t = 0; t < RUN_MS; t += TICK_MS)
+	{
+		const tImage *shown[ANIMS];
+		uint16_t shownLeft[ANIMS], shownTop[ANIMS];
+		SIM_COUNTERS cnt;
+
+		if(t == 2000)
+			leave(&swimAnim, pLcd, true, 120, 20);
+		if(t == 3000)
+			leave(&swimAnim, pLcd, false, 0, 0);
+		if(t == 4000)
+			leave(&heartAnim, pLcd, true, 130, 110);
+		for(uint16_t i = 0; i < ANIMS; i++)
+		{
+			shown[i] = (anims[i]->flags & GFX_ANIM_DRAWN) ? anims[i]->drawnImage : NULL;
+			shownLeft[i] = anims[i]->drawnLeft;
+			shownTop[i] = anims[i]->drawnTop;
+		}
+
+		sim_counters_reset();
+		uint16_t sent = GFXAnimTick(&sportAnim);
+		sim_get_counters(&cnt);
+		ok &= (cnt.linesWritten <= sent) && (pLcd->bandLines || (GFX_SCS_MAX_US != 0) || (cnt.transactions <= 1)) && (cnt.protocolErrors == 0);
+		ok &= panelMatches(pLcd);
+		if(!ok)
+		{
+			printf("%s: FAILED at %u ms, %u lines, %u transactions\n", name, t, sent, cnt.transactions);
+			break;
+		}
+
+		for(uint16_t i = 0; i < ANIMS; i++)		//the same frames drawn whole, the box left erased, one flush per animation
+		{
+			const GFX_ANIM *a = anims[i];
+			const tImage *now = (a->flags & GFX_ANIM_DRAWN) ? a->drawnImage : NULL;
+			bool moved = (shown[i] != NULL) && ((now == NULL) || (a->drawnLeft != shownLeft[i]) || (a->drawnTop != shownTop[i]));
+			if(moved || (now != shown[i]))
+			{
+				changes++;
+				wholeLines += (moved ? a->height : 0) + ((now != NULL) ? a->height : 0);
+				wholeTransactions++;
+			}
+		}
+		ticks++;
+		lines += cnt.linesWritten;
+		transactions += cnt.transactions;
+		busNs += cnt.busTimeNs;
+		hal_delayMs(TICK_MS);
+	}
+	ok &= !(swimAnim.flags & GFX_ANIM_RUNNING) && (sportAnim.flags & GFX_ANIM_RUNNING);
+
+	printf("\n%s\n%-36s %8s %8s %8s %10s\n", name, "", "ticks", "lines", "trans", "bus ms");
+	printf("%-36s %8u %8u %8u %10.2f\n", "GFXAnimTick(), changed rows", ticks, lines, transactions, busNs / 1e6);
+	printf("%-36s %8u %8u %8u\n", "whole frames, a flush per animation", changes, wholeLines, wholeTransactions);
+	return ok;
+}
+
+int main(void)
+{
+	static GFX_DISPLAY bandLcd;
+	static uint8_t band[GFX_FB_SIZE(DISP_HOR_RESOLUTION, 16)], list[2048], bandDirty[(GFX_FB_CANVAS_H + 7) / 8];
+	bool ok = true;
+
+	hal_bsp_init();
+	buildProgress();
+	GFXDisplayInit(&refLcd, &GFX_DISPLAY_DESC_DEFAULT, refBuffer, refDirty, NULL);
+	refLcd.flushMode = GFX_FLUSH_DEFERRED;		//painted to compare with the panel, never sent
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+
+	GFXDisplayPowerOn();
+	printf("%s %ux%u, HelloWorld_v2 icons as %u animations for %u ms\n", GFXDisplayGetDesc()->name, GFXDisplayGetLCDWidth(),
+		   GFXDisplayGetLCDHeight(), (unsigned)ANIMS, RUN_MS);
+	ok &= runScenario(GFXDisplayGetSelected(), "full frame buffer");
+
+	GFXDisplayInitBanded(&bandLcd, &GFX_DISPLAY_DESC_DEFAULT, band, 16, list, sizeof(list), bandDirty, NULL);
+	ok &= runScenario(&bandLcd, "banded, 16 lines");
+
+	printf("%s\n", ok ? "ok" : "FAILED");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,319 @@
+/**
+ * @brief	Host microbenchmark suite of the public GFXDisplay* API with stored baselines.
+ *			Every case is timed in GFX_FLUSH_DEFERRED mode (frame buffer work only, best of BENCH_ROUNDS rounds) and run again
+ *			in GFX_FLUSH_IMMEDIATE mode on the simulated panel to count the SPI bytes, transactions and bus time of one call.
+ *			Pixels per second is the number of pixels a call covers (estimated for curves) divided by its frame buffer time.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/bench/bench_api.cpp extras/host/MemoryLCDSim.cpp src/MemoryLCD.cpp src/bfcFontMgr.c \
+ *				examples/HelloWorld/Consolas24h.c examples/HelloWorld/SimHei_35h.c examples/HelloWorld/cat_400x246.c \
+ *				examples/HelloWorld_v2/run_64x64.c -lstdc++ -o bench_api<br>
+ *			./bench_api extras/bench/bench_api.baseline		compare with the stored baseline, exit code 1 on a regression<br>
+ *			./bench_api -w extras/bench/bench_api.baseline	record a new baseline<br>
+ *			SPI bytes and transactions are exact and a regression is any increase. The change of ns per call is printed for
+ *			review but never fails the run, host timings vary too much between runs. A baseline only applies to the model
+ *			and GFX_SHADOW it was recorded with.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+#include "bench_util.h"
+
+extern const BFC_FONT fontConsolas24h;
+extern const BFC_FONT fontSimHei_35h;
+extern const tImage cat_400x246;
+extern const tImage run_64x64;
+
+#define BENCH_ROUNDS		5
+#define BENCH_ROUND_NS		20000000.0		//minimum duration of a timed round
+#define BENCH_TRAFFIC_CALLS	16				//calls averaged for the SPI counters
+#define BENCH_MAX_CASES		32
+
+static const char helloString[] = "Hello World 0123";
+static const uint16_t helloChinese[] = {0x4F60, 0x597D, 0x4F60, 0x597D, '\0'};
+
+typedef struct
+{
+	const char *name;
+	void (*pfcn)(uint32_t i);			//i varies the position so the shadow and caches see different lines
+	uint32_t pixels;					//pixels covered by one call, 0 if the call does not draw
+} BENCH_CASE;
+
+typedef struct
+{
+	char name[32];
+	double ns;
+	double bytes;
+	double transactions;
+} BENCH_RESULT;
+
+static uint16_t lcdW, lcdH;
+static volatile uint16_t widthSink;
+
+#define BENCH_CHART_BATCH	20				//samples per GFXDisplayChartAddSamples() call, a 400 Hz signal at 20 Hz
+static GFX_CHART chart;
+static uint16_t chartHistory[GFX_CHART_HISTORY_SIZE(GFX_FB_CANVAS_W * 8, 1)];
+
+/**
+ * @brief	Next batch of a triangle wave spanning a fifth of the chart height per batch. The chart restarts with the rounds,
+ *			so the SPI counters do not depend on how many calls were timed.
+ */
+static void chartBatch(uint32_t i, GFX_CHART_MODE mode)
+{
+	int16_t samples[BENCH_CHART_BATCH];
+
+	if(i == 0)
+	{
+		GFXDisplayChartInit(&chart, 0, lcdH / 4, lcdW, lcdH / 2, -1000, 1000, mode, chartHistory);
+		GFXDisplayChartClear(&chart);
+	}
+	for(uint32_t k = 0; k < BENCH_CHART_BATCH; k++)
+	{
+		uint32_t t = (i * BENCH_CHART_BATCH + k) % 200;
+		samples[k] = (int16_t)((t < 100) ? (t * 20) : ((200 - t) * 20)) - 1000;
+	}
+	GFXDisplayChartAddSamples(&chart, samples, BENCH_CHART_BATCH);
+}
+
+static void casePutPixel(uint32_t i)		{ GFXDisplayPutPixel((i * 37) % lcdW, (i * 11) % lcdH, (i & 1) ? BLACK : WHITE); }
+static void caseLineDrawH(uint32_t i)		{ GFXDisplayLineDrawH(0, lcdW - 1, i % (lcdH - 1), (i & 1) ? BLACK : WHITE, 1); }
+static void caseLineDrawH3(uint32_t i)		{ GFXDisplayLineDrawH(0, lcdW - 1, i % (lcdH - 3), (i & 1) ? BLACK : WHITE, 3); }
+static void caseLineDrawV(uint32_t i)		{ GFXDisplayLineDrawV(i % (lcdW - 1), 0, lcdH - 1, (i & 1) ? BLACK : WHITE, 1); }
+static void caseLineDrawV3(uint32_t i)		{ GFXDisplayLineDrawV(i % (lcdW - 3), 0, lcdH - 1, (i & 1) ? BLACK : WHITE, 3); }
+static void caseDrawRect(uint32_t i)		{ uint16_t x = i % 8, y = i % (lcdH / 2); GFXDisplayDrawRect(x, y, x + lcdW / 2 - 1, y + lcdH / 2 - 1, (i & 1) ? BLACK : WHITE); }
+static void caseDrawRectSmall(uint32_t i)	{ uint16_t x = (i * 13) % (lcdW - 16), y = (i * 7) % (lcdH - 16); GFXDisplayDrawRect(x, y, x + 15, y + 15, (i & 1) ? BLACK : WHITE); }
+static void caseDrawLine(uint32_t i)		{ GFXDisplayDrawLine(i % 16, 0, lcdW - 1 - i % 16, lcdH - 1, (i & 1) ? BLACK : WHITE); }
+static void caseDrawCircle(uint32_t i)		{ GFXDisplayDrawCircle(lcdW / 2 + i % 8, lcdH / 2, lcdH / 2 - 1, (i & 1) ? BLACK : WHITE); }
+static void caseFillCircle(uint32_t i)		{ GFXDisplayFillCircle(lcdW / 2 + i % 8, lcdH / 2, lcdH / 4, (i & 1) ? BLACK : WHITE); }
+static void caseDrawEllipse(uint32_t i)		{ GFXDisplayDrawEllipse(lcdW / 2, lcdH / 2 + i % 4, lcdW / 2 - 1, lcdH / 2 - 4, (i & 1) ? BLACK : WHITE); }
+static void caseFillEllipse(uint32_t i)		{ GFXDisplayFillEllipse(lcdW / 2, lcdH / 2 + i % 4, lcdW / 4, lcdH / 4, (i & 1) ? BLACK : WHITE); }
+static void caseChartSweep(uint32_t i)		{ chartBatch(i, GFX_CHART_SWEEP); }
+static void caseChartScroll(uint32_t i)		{ chartBatch(i, GFX_CHART_SCROLL); }
+static void casePutImageFull(uint32_t i)	{ GFXDisplayPutImage(0, 0, &cat_400x246, i & 1); }
+static void casePutImageIcon(uint32_t i)	{ GFXDisplayPutImage((i * 5) % (lcdW - 64), (i * 3) % (lcdH - 64), &run_64x64, i & 1); }
+static void casePutChar(uint32_t i)			{ GFXDisplayPutChar((i * 13) % (lcdW - 16), (i * 7) % (lcdH - 24), &fontConsolas24h, 'A' + i % 26, BLACK, WHITE); }
+static void casePutString(uint32_t i)		{ GFXDisplayPutString(i % 16, (i * 7) % (lcdH - 24), &fontConsolas24h, helloString, BLACK, WHITE); }
+static void casePutWString(uint32_t i)		{ GFXDisplayPutWString(i % 16, (i * 7) % (lcdH - 35), &fontSimHei_35h, helloChinese, BLACK, WHITE); }
+static void caseGetStringWidth(uint32_t i)	{ widthSink = GFXDisplayGetStringWidth(&fontConsolas24h, helloString + (i & 3)); }
+static void caseAllClear(uint32_t i)		{ (void)i; GFXDisplayAllClear(); }
+
+/**
+ * @brief	Best ns per call over BENCH_ROUNDS rounds, the number of calls per round is doubled until a round lasts BENCH_ROUND_NS
+ */
+static double timeCase(const BENCH_CASE *pCase)
+{
+	uint32_t calls = 1;
+	double best = 1e18;
+
+	for(;;)
+	{
+		double t0 = nowNs();
+		for(uint32_t i = 0; i < calls; i++)
+			pCase->pfcn(i);
+		if((nowNs() - t0) >= BENCH_ROUND_NS || calls >= (1u << 24))
+			break;
+		calls <<= 1;
+	}
+
+	for(int round = 0; round < BENCH_ROUNDS; round++)
+	{
+		double t0 = nowNs();
+		for(uint32_t i = 0; i < calls; i++)
+			pCase->pfcn(i);
+		best = MIN(best, (nowNs() - t0) / calls);
+	}
+	return best;
+}
+
+static void configName(char *buf, size_t len)
+{
+	snprintf(buf, len, "%s %ux%u GFX_SHADOW=%d", GFXDisplayGetDesc()->name, lcdW, lcdH, GFX_SHADOW);
+}
+
+static int loadBaseline(const char *path, BENCH_RESULT *pBase, char *config, size_t configLen)
+{
+	FILE *fp = fopen(path, "r");
+	char line[160];
+	int n = 0;
+
+	if(fp == NULL)
+		return -1;
+
+	config[0] = '\0';
+	while(fgets(line, sizeof(line), fp) && n < BENCH_MAX_CASES)
+	{
+		if(line[0] == '#')
+		{
+			if(strncmp(line, "# config: ", 10) == 0)
+			{
+				snprintf(config, configLen, "%s", line + 10);
+				config[strcspn(config, "\r\n")] = '\0';
+			}
+			continue;
+		}
+		if(sscanf(line, "%31s %lf %lf %lf", pBase[n].name, &pBase[n].ns, &pBase[n].bytes, &pBase[n].transactions) == 4)
+			n++;
+	}
+	fclose(fp);
+	return n;
+}
+
+static bool saveBaseline(const char *path, const char *config, const BENCH_RESULT *pResult, int n)
+{
+	FILE *fp = fopen(path, "w");
+	if(fp == NULL)
+		return false;
+
+	fprintf(fp, "# bench_api baseline, regenerate with ./bench_api -w <file>\n");
+	fprintf(fp, "# config: %s\n", config);
+	fprintf(fp, "# %-22s %12s %12s %12s\n", "case", "ns/call", "bytes/call", "trans/call");
+	for(int c = 0; c < n; c++)
+		fprintf(fp, "%-24s %12.1f %12.2f %12.3f\n", pResult[c].name, pResult[c].ns, pResult[c].bytes, pResult[c].transactions);
+	fclose(fp);
+	return true;
+}
+
+int main(int argc, char **argv)
+{
+	const char *baselinePath = NULL;
+	bool writeBaseline = false;
+
+	if(argc == 3 && strcmp(argv[1], "-w") == 0)
+	{
+		writeBaseline = true;
+		baselinePath = argv[2];
+	}
+	else if(argc == 2)
+		baselinePath = argv[1];
+
+	hal_bsp_init();
+	GFXDisplayPowerOn();
+	lcdW = GFXDisplayGetLCDWidth();
+	lcdH = GFXDisplayGetLCDHeight();
+
+	uint16_t strW = GFXDisplayGetStringWidth(&fontConsolas24h, helloString);
+	uint16_t wstrW = GFXDisplayGetWStringWidth(&fontSimHei_35h, helloChinese);
+	uint16_t catW = MIN((uint16_t)cat_400x246.width, lcdW), catH = MIN((uint16_t)cat_400x246.height, lcdH);
+
+	const BENCH_CASE cases[] =
+	{
+		{ "PutPixel",			casePutPixel,		1 },
+		{ "LineDrawH",			caseLineDrawH,		lcdW },
+		{ "LineDrawH_thick3",	caseLineDrawH3,		lcdW * 3u },
+		{ "LineDrawV",			caseLineDrawV,		lcdH },
+		{ "LineDrawV_thick3",	caseLineDrawV3,		lcdH * 3u },
+		{ "DrawRect_half",		caseDrawRect,		(lcdW / 2u) * (lcdH / 2u) },
+		{ "DrawRect_16x16",		caseDrawRectSmall,	16 * 16 },
+		{ "DrawLine_diagonal",	caseDrawLine,		MAX(lcdW, lcdH) },
+		{ "DrawCircle",			caseDrawCircle,		(uint32_t)(6.2832 * (lcdH / 2 - 1)) },
+		{ "FillCircle",			caseFillCircle,		(uint32_t)(3.1416 * (lcdH / 4) * (lcdH / 4)) },
+		{ "DrawEllipse",		caseDrawEllipse,	(uint32_t)(3.1416 * (lcdW / 2 + lcdH / 2)) },
+		{ "FillEllipse",		caseFillEllipse,	(uint32_t)(3.1416 * (lcdW / 4) * (lcdH / 4)) },
+		{ "ChartSweep_20",		caseChartSweep,		BENCH_CHART_BATCH },
+		{ "ChartScroll_20",		caseChartScroll,	lcdW },
+		{ "PutImage_cat",		casePutImageFull,	(uint32_t)catW * catH },
+		{ "PutImage_64x64",		casePutImageIcon,	64 * 64 },
+		{ "PutChar",			casePutChar,		(uint32_t)GFXDisplayGetCharWidth(&fontConsolas24h, 'A') * fontConsolas24h.FontHeight },
+		{ "PutString",			casePutString,		(uint32_t)strW * fontConsolas24h.FontHeight },
+		{ "PutWString",			casePutWString,		(uint32_t)wstrW * fontSimHei_35h.FontHeight },
+		{ "GetStringWidth",		caseGetStringWidth,	0 },
+		{ "AllClear",			caseAllClear,		(uint32_t)lcdW * lcdH },
+	};
+	const int nCases = sizeof(cases) / sizeof(cases[0]);
+	BENCH_RESULT result[BENCH_MAX_CASES];
+	char config[160];
+
+	configName(config, sizeof(config));
+	printf("%s\n\n", config);
+	printf("%-18s %10s %10s %11s %7s %10s\n", "case", "ns/call", "Mpixel/s", "bytes/call", "trans", "bus us");
+
+	for(int c = 0; c < nCases; c++)
+	{
+		SIM_COUNTERS cnt;
+
+		GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+		double ns = timeCase(&cases[c]);
+		GFXDisplayFlush();
+
+		GFXDisplaySetFlushMode(GFX_FLUSH_IMMEDIATE);
+		sim_counters_reset();
+		for(uint32_t i = 0; i < BENCH_TRAFFIC_CALLS; i++)
+			cases[c].pfcn(i);
+		sim_get_counters(&cnt);
+
+		snprintf(result[c].name, sizeof(result[c].name), "%s", cases[c].name);
+		result[c].ns = ns;
+		result[c].bytes = (double)cnt.bytes / BENCH_TRAFFIC_CALLS;
+		result[c].transactions = (double)cnt.transactions / BENCH_TRAFFIC_CALLS;
+
+		if(cases[c].pixels)
+			printf("%-18s %10.1f %10.1f %11.1f %7.2f %10.1f\n", cases[c].name, ns, cases[c].pixels * 1e3 / ns,
+				result[c].bytes, result[c].transactions, cnt.busTimeNs / 1e3 / BENCH_TRAFFIC_CALLS);
+		else
+			printf("%-18s %10.1f %10s %11.1f %7.2f %10.1f\n", cases[c].name, ns, "-",
+				result[c].bytes, result[c].transactions, cnt.busTimeNs / 1e3 / BENCH_TRAFFIC_CALLS);
+	}
+
+	if(sim_compare_framebuffer() != 0)
+	{
+		printf("\nPanel and frame buffer differ after the suite\n");
+		return 1;
+	}
+
+	if(baselinePath == NULL)
+		return 0;
+
+	if(writeBaseline)
+	{
+		if(!saveBaseline(baselinePath, config, result, nCases))
+		{
+			printf("\nCannot write %s\n", baselinePath);
+			return 1;
+		}
+		printf("\nBaseline written to %s\n", baselinePath);
+		return 0;
+	}
+
+	BENCH_RESULT base[BENCH_MAX_CASES];
+	char baseConfig[160];
+	int nBase = loadBaseline(baselinePath, base, baseConfig, sizeof(baseConfig));
+	int regressions = 0;
+
+	if(nBase < 0)
+	{
+		printf("\nCannot read %s\n", baselinePath);
+		return 1;
+	}
+	if(strcmp(baseConfig, config) != 0)
+	{
+		printf("\nBaseline recorded for \"%s\", not compared\n", baseConfig);
+		return 0;
+	}
+
+	printf("\n%-18s %10s %8s %11s %11s\n", "against baseline", "ns/call", "change", "bytes/call", "trans");
+	for(int c = 0; c < nCases; c++)
+	{
+		int b;
+		for(b = 0; b < nBase; b++)
+			if(strcmp(base[b].name, result[c].name) == 0)
+				break;
+		if(b == nBase)
+		{
+			printf("%-18s not in baseline\n", result[c].name);
+			continue;
+		}
+
+		double change = (result[c].ns - base[b].ns) * 100.0 / base[b].ns;		//printed only
+		bool moreBytes = result[c].bytes > base[b].bytes + 0.005;
+		bool moreTransactions = result[c].transactions > base[b].transactions + 0.0005;
+
+		printf("%-18s %10.1f %+7.0f%% %11.1f %11.3f%s\n", result[c].name, base[b].ns, change, base[b].bytes, base[b].transactions,
+			(moreBytes || moreTransactions) ? "  REGRESSION" : "");
+		if(moreBytes || moreTransactions)
+			regressions++;
+	}
+
+	printf("\n%d regression(s)\n", regressions);
+	return regressions ? 1 : 0;
+}
@@ -0,0 +1,127 @@
+/**
+ * @brief	Host check and benchmark of GFXDisplayFlushAsync() on the simulator's DMA emulation.
+ *			Checks snapshot ownership (drawing during a transfer does not reach the panel), ordering with synchronous updates,
+ *			partial transfer buffers and the fallback without DMA, then compares how long the caller is blocked.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/bench/bench_async.cpp extras/host/MemoryLCDSim.cpp src/MemoryLCD.cpp src/bfcFontMgr.c \
+ *				examples/HelloWorld/cat_400x246.c -lstdc++ -o bench_async && ./bench_async
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+#include "bench_util.h"
+
+extern const tImage cat_400x246;
+
+static uint8_t xfer[GFX_FB_CANVAS_H * (GFX_FB_CANVAS_W + 2) + 2];
+static int doneCalls;
+static uint16_t doneLines;
+
+static void onFlushDone(uint16_t lines)
+{
+	doneCalls++;
+	doneLines = lines;
+}
+
+#define CHECK(cond)	do { if(!(cond)) { printf("FAILED line %d: %s\n", __LINE__, #cond); return false; } } while(0)
+
+static bool checkOwnershipAndOrdering(void)
+{
+	SIM_COUNTERS c;
+
+	GFXDisplaySetTransferBuffer(xfer, sizeof(xfer));
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+	GFXDisplayAllClear();
+	sim_counters_reset();
+
+	//1. the transfer holds the frame as it was when GFXDisplayFlushAsync() was called
+	GFXDisplayDrawRect(0, 0, 99, 49, BLACK);
+	doneCalls = 0;
+	CHECK(GFXDisplayFlushAsync(onFlushDone) == 50);
+	CHECK(GFXDisplayFlushBusy() && sim_dma_pending() && doneCalls == 0);
+	GFXDisplayDrawRect(0, 0, 99, 9, WHITE);			//drawing goes on while the transfer is pending
+	CHECK(sim_dma_complete());
+	CHECK(!GFXDisplayFlushBusy() && doneCalls == 1 && doneLines == 50);
+	CHECK(sim_get_pixel(5, 5) == false);				//panel shows the snapshot (black)
+	CHECK(sim_compare_framebuffer() == 10);			//the 10 rows drawn afterwards are still dirty
+	CHECK(GFXDisplayFlushAsync(onFlushDone) == 10);
+	GFXDisplayFlushWait();
+	CHECK(sim_compare_framebuffer() == 0 && doneCalls == 2);
+
+	//2. a synchronous update while a transfer is pending waits for it, the bus is never shared
+	GFXDisplayDrawRect(0, GFX_FB_CANVAS_H/2, DISP_HOR_RESOLUTION-1, GFX_FB_CANVAS_H-1, BLACK);
+	CHECK(GFXDisplayFlushAsync(NULL) != 0);
+	GFXDisplaySetFlushMode(GFX_FLUSH_IMMEDIATE);		//nothing left to flush, but the lines below are sent right away
+	GFXDisplayPutPixel(0, GFX_FB_CANVAS_H-1, WHITE);
+	CHECK(!sim_dma_pending());
+	CHECK(sim_compare_framebuffer() == 0);
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+
+	//3. a transfer buffer smaller than the dirty lines sends what fits and leaves the rest dirty
+	GFXDisplaySetTransferBuffer(xfer, 20 * (GFX_FB_CANVAS_W + 2) + 2);
+	GFXDisplayPutImage(0, 0, &cat_400x246, true);
+	uint16_t total = 0, lines, flushes = 0;
+	while((lines = GFXDisplayFlushAsync(NULL)) != 0)
+	{
+		CHECK(lines <= 20);
+		total += lines;
+		flushes++;
+	}
+	CHECK(total == MIN(246, GFX_FB_CANVAS_H) && sim_compare_framebuffer() == 0);
+
+	//4. without DMA transport the transfer is sent before GFXDisplayFlushAsync() returns
+	sim_dma_enable(false);
+	GFXDisplaySetTransferBuffer(xfer, sizeof(xfer));
+	GFXDisplayDrawRect(10, 10, 20, 20, WHITE);
+	doneCalls = 0;
+	lines = GFXDisplayFlushAsync(onFlushDone);			//GFX_SHADOW may skip rows that were white already
+	CHECK(lines > 0 && lines <= 11 && doneCalls == 1 && !GFXDisplayFlushBusy());
+	CHECK(sim_compare_framebuffer() == 0);
+	sim_dma_enable(true);
+
+	sim_get_counters(&c);
+	CHECK(c.protocolErrors == 0);
+	printf("ownership, ordering, partial buffer (%u flushes) and no-DMA fallback: ok\n", flushes);
+	return true;
+}
+
+/**
+ * @brief	Simulated bus time spent inside the call, i.e. how long the caller is blocked at 2MHz
+ */
+static void benchBlocking(void)
+{
+	GFXDisplaySetTransferBuffer(xfer, sizeof(xfer));
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+
+	GFXDisplayPutImage(0, 0, &cat_400x246, false);
+	uint64_t t0 = sim_time_ns();
+	uint16_t syncLines = GFXDisplayFlush();
+	uint64_t syncNs = sim_time_ns() - t0;
+
+	GFXDisplayPutImage(0, 0, &cat_400x246, true);
+	t0 = sim_time_ns();
+	double w0 = nowNs();
+	uint16_t asyncLines = GFXDisplayFlushAsync(NULL);
+	double snapshotNs = nowNs() - w0;
+	uint64_t asyncNs = sim_time_ns() - t0;
+	sim_dma_complete();
+	uint64_t transferNs = sim_time_ns() - t0;
+
+	printf("\n%-34s %6s %14s\n", "full frame", "lines", "caller blocked");
+	printf("%-34s %6u %11.3f ms\n", "GFXDisplayFlush()", syncLines, syncNs / 1e6);
+	printf("%-34s %6u %11.3f ms  (+ %.1f us host time to copy the rows, transfer takes %.3f ms)\n", "GFXDisplayFlushAsync()",
+		   asyncLines, asyncNs / 1e6, snapshotNs / 1e3, transferNs / 1e6);
+}
+
+int main(void)
+{
+	hal_bsp_init();
+
+	if(!checkOwnershipAndOrdering())
+		return 1;
+
+	benchBlocking();
+	return 0;
+}
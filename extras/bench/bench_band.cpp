@@ -0,0 +1,174 @@
+/**
+ * @brief	Host check and benchmark of banded rendering (GFXDisplayInitBanded()).
+ *			A screen using every drawing function is drawn on a banded display and on a display with a full frame buffer,
+ *			the simulated panel has to match the full frame buffer for every band height, flush mode and incremental update.
+ *			A banded display has to start in GFX_FLUSH_DEFERRED mode and send each row of the screen once, as the full frame
+ *			buffer does. GFX_FLUSH_IMMEDIATE, which sends the rows of every drawing call, is reported for comparison.
+ *			RAM, display list use, host CPU time and SPI traffic of a full screen are reported per band height.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/bench/bench_band.cpp extras/host/MemoryLCDSim.cpp src/MemoryLCD.cpp src/bfcFontMgr.c \
+ *				examples/HelloWorld/Consolas24h.c examples/HelloWorld/SimHei_35h.c examples/HelloWorld/Arial_Rounded_MT_Bold55h.c \
+ *				examples/HelloWorld_v2/run_64x64.c -lstdc++ -o bench_band && ./bench_band
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+#include "bench_util.h"
+
+extern const BFC_FONT fontConsolas24h;
+extern const BFC_FONT fontSimHei_35h;
+extern const BFC_FONT fontArial_Rounded_MT_Bold55h;
+extern const tImage run_64x64;
+
+#define LIST_SIZE	2048
+
+static const uint16_t helloChinese[] = {0x4F60, 0x597D, '\0'};
+
+static GFX_DISPLAY refLcd, bandLcd;
+static uint8_t refFrameBuffer[GFX_FB_SIZE(DISP_HOR_RESOLUTION, GFX_FB_CANVAS_H)];
+static uint8_t refDirtyLines[(GFX_FB_CANVAS_H + 7) / 8];
+static uint8_t bandBuffer[GFX_FB_SIZE(DISP_HOR_RESOLUTION, GFX_FB_CANVAS_H)];	//large enough for every band height tried
+static uint8_t bandList[LIST_SIZE];
+static uint8_t bandDirtyLines[(GFX_FB_CANVAS_H + 7) / 8];
+static uint32_t fullLines;	//lines sent for the screen by the display with a full frame buffer
+
+/**
+ * @brief	A screen with every drawing function, overlapping and partly outside the LCD
+ */
+static void drawScene(void)
+{
+	uint16_t w = GFXDisplayGetLCDWidth(), h = GFXDisplayGetLCDHeight();
+
+	GFXDisplayDrawRect(0, 0, w - 1, h / 3, BLACK);
+	GFXDisplayPutString(4, 2, &fontConsolas24h, "Banded 12:34", WHITE, BLACK);
+	GFXDisplayLineDrawH(0, w - 1, h / 2, BLACK, 3);
+	GFXDisplayLineDrawV(w / 3, 0, h - 1, BLACK, 2);
+	GFXDisplayDrawLine(0, h - 1, w - 1, h / 4, BLACK);
+	GFXDisplayDrawLine(w / 2, 0, w / 2 + 7, h - 1, WHITE);
+	GFXDisplayDrawCircle(w / 2, h / 2, h / 3, BLACK);
+	GFXDisplayFillCircle(w - 10, h - 10, 30, BLACK);
+	GFXDisplayDrawEllipse(w / 2, h / 2, w / 2 + 20, h / 5, BLACK);
+	GFXDisplayFillEllipse(w / 4, h - 20, w / 6, 25, BLACK);
+	GFXDisplayPutImage(w - 40, h / 3 - 20, &run_64x64, false);
+	GFXDisplayPutImage(5, h - 50, &run_64x64, true);
+	GFXDisplayPutString(10, h / 2 - 10, &fontArial_Rounded_MT_Bold55h, "@12", BLACK, TRANSPARENT);
+	GFXDisplayPutWString(w / 2, h / 2 + 5, &fontSimHei_35h, helloChinese, BLACK, WHITE);
+	GFXDisplayPutChar(w - 20, 2, &fontConsolas24h, 'Z', BLACK, WHITE);
+	for(uint16_t i = 0; i < 16; i++)
+		GFXDisplayPutPixel((i * 37) % w, (i * 23) % h, (i & 1) ? WHITE : BLACK);
+}
+
+/**
+ * @brief	Later changes to a part of the screen
+ */
+static void drawUpdate(uint32_t n)
+{
+	char text[16];
+
+	snprintf(text, sizeof(text), "%05u", n);
+	GFXDisplayPutString(20, GFXDisplayGetLCDHeight() / 2 + 8, &fontConsolas24h, text, BLACK, WHITE);
+	GFXDisplayPutImage(GFXDisplayGetLCDWidth() / 3, 40, &run_64x64, (n & 1) != 0);
+}
+
+/**
+ * @brief	Draw the reference into the full frame buffer only, nothing is sent
+ */
+static void drawReference(void (*pfcn)(uint32_t), uint32_t n)
+{
+	GFXDisplaySelect(&refLcd);
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+	pfcn(n);
+}
+
+static void sceneStep(uint32_t n) { (void)n; drawScene(); }
+
+static bool runBand(uint16_t lines, GFX_FLUSH_MODE mode)
+{
+	SIM_COUNTERS cnt;
+	uint16_t dropped;
+	bool ok;
+
+	memset(refFrameBuffer, 0xFF, sizeof(refFrameBuffer));
+	GFXDisplayInit(&refLcd, &GFX_DISPLAY_DESC_DEFAULT, refFrameBuffer, refDirtyLines, NULL);
+	drawReference(sceneStep, 0);
+
+	GFXDisplayInitBanded(&bandLcd, &GFX_DISPLAY_DESC_DEFAULT, bandBuffer, lines, bandList, sizeof(bandList), bandDirtyLines, NULL);
+	GFXDisplaySelect(&bandLcd);
+	bool deferredDefault = (GFXDisplayGetFlushMode() == GFX_FLUSH_DEFERRED);
+	GFXDisplayAllClear();
+	GFXDisplaySetFlushMode(mode);
+
+	sim_counters_reset();
+	double t0 = nowNs();
+	drawScene();
+	GFXDisplayFlush();
+	double ns = nowNs() - t0;
+	sim_get_counters(&cnt);
+	uint16_t used = GFXDisplayGetBandListUsed(&dropped);
+	ok = panelShows(&refLcd, &bandLcd) && (dropped == 0) && (cnt.protocolErrors == 0) && deferredDefault;
+	if(mode == GFX_FLUSH_DEFERRED)
+		ok &= (cnt.linesWritten == fullLines);
+
+	//incremental updates: a counter and an icon over the same place replace their entries, the display list stops growing
+	uint16_t usedUpdate = 0;
+	for(uint32_t n = 1; n <= 200; n++)
+	{
+		drawReference(drawUpdate, n);
+		GFXDisplaySelect(&bandLcd);
+		drawUpdate(n);
+		GFXDisplayFlush();
+		if(n == 1)
+			usedUpdate = GFXDisplayGetBandListUsed(NULL);
+	}
+	ok &= panelShows(&refLcd, &bandLcd) && (GFXDisplayGetBandListUsed(&dropped) == usedUpdate) && (dropped == 0);
+
+	uint32_t ram = (uint32_t)lines * GFX_FB_CANVAS_W + sizeof(bandList) + sizeof(bandDirtyLines);
+	printf("%5u %-9s %7u %6u %11.1f %8u %7u %10.2f  %s\n", lines, (mode == GFX_FLUSH_DEFERRED) ? "deferred" : "immediate",
+		ram, used, ns / 1e3, cnt.linesWritten, cnt.transactions, cnt.busTimeNs / 1e6, ok ? "ok" : "FAILED");
+	return ok;
+}
+
+int main(void)
+{
+	bool ok = true;
+	const uint16_t H = GFX_FB_CANVAS_H;
+	const uint16_t bands[] = {1, 8, 16, 32, 64, H};
+	SIM_COUNTERS cnt;
+
+	hal_bsp_init();
+	GFXDisplayPowerOn();
+
+	//full frame buffer for comparison
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+	sim_counters_reset();
+	double t0 = nowNs();
+	drawScene();
+	GFXDisplayFlush();
+	double ns = nowNs() - t0;
+	sim_get_counters(&cnt);
+	fullLines = cnt.linesWritten;
+
+	printf("%s %ux%u, full screen drawn and flushed\n\n", GFXDisplayGetDesc()->name, GFXDisplayGetLCDWidth(), H);
+	printf("%5s %-9s %7s %6s %11s %8s %7s %10s\n", "band", "mode", "RAM", "list", "draw+flush us", "lines", "trans", "bus ms");
+	printf("%5s %-9s %7u %6s %11.1f %8u %7u %10.2f\n", GFXDisplayGetSelected()->bandLines ? "deflt" : "full", "deferred", (uint32_t)sizeof(frameBuffer) + (H + 7) / 8, "-",
+		ns / 1e3, cnt.linesWritten, cnt.transactions, cnt.busTimeNs / 1e6);
+
+	for(uint16_t i = 0; i < sizeof(bands) / sizeof(bands[0]); i++)
+		ok &= runBand(bands[i], GFX_FLUSH_DEFERRED);
+	ok &= runBand(16, GFX_FLUSH_IMMEDIATE);
+
+	//a display list too small for the screen drops calls and says so
+	GFXDisplayInitBanded(&bandLcd, &GFX_DISPLAY_DESC_DEFAULT, bandBuffer, 16, bandList, 128, bandDirtyLines, NULL);
+	GFXDisplaySelect(&bandLcd);
+	GFXDisplayAllClear();
+	drawScene();
+	uint16_t dropped;
+	GFXDisplayGetBandListUsed(&dropped);
+	printf("\n128-byte display list: %u drawing calls dropped\n", dropped);
+	ok &= (dropped > 0);
+
+	printf("%s\n", ok ? "ok" : "FAILED");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,199 @@
+/**
+ * @brief	Host microbenchmark of GetCharInfo() with the font lookup index against the BFC_FONT_PROP list walk.
+ *			CJK-like fonts are synthesized with one range per glyph, the way BitFontCreator exports sparse character sets:
+ *			with the ranges evenly spaced as the generated .c files lay them out, scattered in memory, listed in
+ *			descending order and with two ranges overlapping. Every build checks all 16-bit codes resolve as with the
+ *			list walk in each of them, that the indexed fonts are at least INDEX_MIN_SPEEDUP times faster and that the
+ *			fonts of the examples and ASCII are not slower.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/bench/bench_charinfo.cpp extras/host/MemoryLCDSim.cpp src/MemoryLCD.cpp src/bfcFontMgr.c \
+ *				examples/HelloWorld/Consolas24h.c examples/HelloWorld/SimHei_35h.c -lstdc++ -o bench_charinfo && ./bench_charinfo
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+#include "bench_util.h"
+
+extern const BFC_FONT fontConsolas24h;
+extern const BFC_FONT fontSimHei_35h;
+
+/**
+ * @brief	Reference, the BFC_FONT_PROP list walk GetCharInfo() does for fonts without an index
+ */
+static __attribute__((noinline)) const BFC_CHARINFO* refGetCharInfo(const BFC_FONT *pFont, unsigned short ch)
+{
+	const BFC_FONT_PROP *pProp = pFont->p.pProp;
+	for(;; pProp = pProp->pNextProp)
+	{
+		if(ch >= pProp->FirstChar && ch <= pProp->LastChar)
+			return pProp->pFirstCharInfo + (ch - pProp->FirstChar);
+		if(pProp->pNextProp == 0)
+			return pProp->pFirstCharInfo;		//not in the font, the first character of the last range
+	}
+}
+
+#define INDEX_ON			(BFC_INDEX_FONTS > 0)
+#define INDEX_MIN_SPEEDUP	(INDEX_ON ? 1.5 : 0.5)	//indexed fonts against the list walk, the pool-sorted ones have 63 ranges only
+#define WALK_MIN_SPEEDUP	0.7						//fonts or characters left to the first range or the list walk, a few ns per lookup on a host
+#define BENCH_ROUNDS		7
+
+typedef enum
+{
+	LAYOUT_EVEN,			//ranges in an array, as the generated fonts end up in flash
+	LAYOUT_SCATTERED,		//ranges at uneven addresses, sorted into the table of the index
+	LAYOUT_DESCENDING,		//ranges listed from the last character down
+	LAYOUT_OVERLAP			//the first two CJK ranges overlap, the font keeps the list walk
+} LAYOUT;
+
+/**
+ * @brief	Synthesize a font with an ASCII range 0x20~0x7E and glyphs single ranges of every other character from 0x4E00
+ */
+static BFC_FONT* makeSparseFont(uint16_t glyphs, LAYOUT layout)
+{
+	static const uint8_t data[1] = { 0 };
+	BFC_FONT *pFont = (BFC_FONT *)calloc(1, sizeof(BFC_FONT));
+	BFC_FONT_PROP *pProps = (BFC_FONT_PROP *)calloc(2 * (glyphs + 1), sizeof(BFC_FONT_PROP));
+	BFC_FONT_PROP **pRange = (BFC_FONT_PROP **)calloc(glyphs + 1, sizeof(BFC_FONT_PROP *));
+	BFC_CHARINFO *pInfo = (BFC_CHARINFO *)calloc(glyphs + 95, sizeof(BFC_CHARINFO));
+
+	for(uint16_t i = 0; i < glyphs + 95; i++)
+	{
+		pInfo[i].Width = 1 + i % 32;
+		pInfo[i].DataSize = 1;
+		pInfo[i].p.pData8 = data;
+	}
+
+	for(uint16_t i = 0; i <= glyphs; i++)
+		pRange[i] = &pProps[(layout == LAYOUT_SCATTERED) ? (2 * i + (i % 3 == 0)) : i];
+	pRange[0]->FirstChar = 0x20;
+	pRange[0]->LastChar = 0x7E;
+	pRange[0]->pFirstCharInfo = pInfo;
+	for(uint16_t i = 1; i <= glyphs; i++)
+	{
+		pRange[i]->FirstChar = pRange[i]->LastChar = 0x4E00 + 2 * (i - 1);
+		pRange[i]->pFirstCharInfo = &pInfo[94 + i];
+	}
+	if(layout == LAYOUT_OVERLAP)
+		pRange[1]->LastChar = pRange[2]->FirstChar;
+
+	if(layout == LAYOUT_DESCENDING)
+	{
+		for(uint16_t i = glyphs; i > 0; i--)
+			pRange[i]->pNextProp = pRange[i - 1];
+		pFont->p.pProp = pRange[glyphs];
+	}
+	else
+	{
+		for(uint16_t i = 0; i < glyphs; i++)
+			pRange[i]->pNextProp = pRange[i + 1];
+		pFont->p.pProp = pRange[0];
+	}
+	free(pRange);
+
+	pFont->FontType = FONTTYPE_PROP | BFC_LITTLE_ENDIAN | ENCODING_UNICODE | DATALENGTH_8;
+	pFont->FontHeight = 1;
+	return pFont;
+}
+
+/**
+ * @brief	Every 16-bit code must resolve to the same BFC_CHARINFO with and without the index
+ */
+static bool checkAgainstReference(const BFC_FONT *pFont, const char *name)
+{
+	for(uint32_t ch = 0; ch <= 0xFFFF; ch++)
+	{
+		if(GetCharInfo(pFont, (unsigned short)ch) != refGetCharInfo(pFont, (unsigned short)ch))
+		{
+			printf("%s: mismatch at 0x%04X\n", name, (unsigned)ch);
+			return false;
+		}
+	}
+	return true;
+}
+
+static volatile uintptr_t sink;
+
+/**
+ * @return	ns per lookup of one timed round
+ */
+static double timeRound(const BFC_CHARINFO* (*pfcn)(const BFC_FONT *, unsigned short), const BFC_FONT *pFont,
+						const uint16_t *codes, int count, int repeat)
+{
+	uintptr_t acc = 0;
+
+	double t0 = nowNs();
+	for(int r = 0; r < repeat; r++)
+		for(int i = 0; i < count; i++) acc += (uintptr_t)pfcn(pFont, codes[i]);
+	double ns = (nowNs() - t0) / ((double)repeat * count);
+	sink = acc;
+	return ns;
+}
+
+/**
+ * @return	the speedup of GetCharInfo() over the list walk, best of BENCH_ROUNDS alternated rounds each. The font is
+ *			indexed first if it can be.
+ */
+static double bench(const char *label, const BFC_FONT *pFont, const uint16_t *codes, int count, int repeat)
+{
+	double refNs = 1e18, idxNs = 1e18;
+
+	ResetFontIndex();
+	int indexed = BuildFontIndex(pFont);
+
+	for(int round = 0; round < BENCH_ROUNDS; round++)
+	{
+		refNs = MIN(refNs, timeRound(refGetCharInfo, pFont, codes, count, repeat));
+		idxNs = MIN(idxNs, timeRound(GetCharInfo, pFont, codes, count, repeat));
+	}
+
+	printf("%-40s %-10s %10.1f %11.1f %8.1fx\n", label, indexed ? "indexed" : "list walk", refNs, idxNs, refNs/idxNs);
+	return refNs/idxNs;
+}
+
+int main(void)
+{
+	const BFC_FONT *pSparse1k = makeSparseFont(1000, LAYOUT_EVEN);
+	const BFC_FONT *pSparse7k = makeSparseFont(7000, LAYOUT_EVEN);
+	const BFC_FONT *pScattered = makeSparseFont(BFC_INDEX_RANGES - 1, LAYOUT_SCATTERED);
+	const BFC_FONT *pDescending = makeSparseFont(BFC_INDEX_RANGES - 1, LAYOUT_DESCENDING);
+	const BFC_FONT *pOverlap = makeSparseFont(1000, LAYOUT_OVERLAP);
+	const BFC_FONT *fonts[] = { &fontConsolas24h, &fontSimHei_35h, pSparse1k, pSparse7k, pScattered, pDescending, pOverlap };
+	const char *names[] = { "Consolas24h", "SimHei_35h", "1000 even", "7000 even", "scattered", "descending", "overlapping" };
+	const uint16_t hello[] = { 'H', 'e', 'l', 'l', 'o', ' ', 'W', 'o', 'r', 'l', 'd', '!' };
+	const uint16_t hello_japanese[] = { 0x3053, 0x3093, 0x306B, 0x3061, 0x306F };
+	uint16_t cjk[256];
+	bool ok = true;
+
+	for(unsigned f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++)
+	{
+		ResetFontIndex();
+		if(!checkAgainstReference(fonts[f], names[f]))
+			return 1;
+	}
+	ResetFontIndex();
+	ok &= !BuildFontIndex(pOverlap) && !BuildFontIndex(&fontSimHei_35h) && (BuildFontIndex(pScattered) == INDEX_ON);
+
+	printf("BFC_INDEX_FONTS %d, BFC_INDEX_RANGES %d, BFC_INDEX_MIN_RANGES %d\n\n", BFC_INDEX_FONTS, BFC_INDEX_RANGES, BFC_INDEX_MIN_RANGES);
+	printf("%-40s %-10s %10s %11s %9s\n", "case (ns per lookup)", "", "list walk", "GetCharInfo", "speedup");
+	ok &= (bench("Consolas24h ASCII, 1 range", &fontConsolas24h, hello, 12, 200000) >= WALK_MIN_SPEEDUP);
+	ok &= (bench("SimHei_35h, 7 ranges", &fontSimHei_35h, hello_japanese, 5, 200000) >= WALK_MIN_SPEEDUP);
+
+	srand(1);
+	for(int i = 0; i < 256; i++)
+		cjk[i] = 0x4E00 + 2 * (rand() % 1000);
+	ok &= (bench("1000 ranges, random CJK", pSparse1k, cjk, 256, 200) >= INDEX_MIN_SPEEDUP);
+	bench("1000 ranges overlapping, random CJK", pOverlap, cjk, 256, 200);
+	for(int i = 0; i < 256; i++)
+		cjk[i] = 0x4E00 + 2 * (rand() % 7000);
+	ok &= (bench("7000 ranges, random CJK", pSparse7k, cjk, 256, 50) >= INDEX_MIN_SPEEDUP);
+	ok &= (bench("7000 ranges, ASCII", pSparse7k, hello, 12, 200000) >= WALK_MIN_SPEEDUP);
+	for(int i = 0; i < 256; i++)
+		cjk[i] = 0x4E00 + 2 * (rand() % (BFC_INDEX_RANGES - 1));
+	ok &= (bench("scattered ranges, random CJK", pScattered, cjk, 256, 2000) >= INDEX_MIN_SPEEDUP);
+	ok &= (bench("descending ranges, random CJK", pDescending, cjk, 256, 2000) >= INDEX_MIN_SPEEDUP);
+
+	printf("%s\n", ok ? "ok" : "FAILED");
+	return ok ? 0 : 1;
+}
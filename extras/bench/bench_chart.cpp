@@ -0,0 +1,195 @@
+/**
+ * @brief	Host check and bus budget of the strip chart API (GFXDisplayChartInit()/GFXDisplayChartAddSamples()).
+ *			After every batch the simulated panel has to match the frame buffer, i.e. the rows refreshed cover everything the
+ *			batch changed, the batch has to go out in one transaction and no pixel outside the chart rectangle may change. A full-width chart fed at 20 Hz is then measured in
+ *			sweep and scroll mode against the 50 ms period, and compared with a trace drawn by GFXDisplayLineDrawV() and
+ *			GFXDisplayPutPixel() per sample.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/bench/bench_chart.cpp extras/host/MemoryLCDSim.cpp src/MemoryLCD.cpp src/bfcFontMgr.c \
+ *				-lstdc++ -lm -o bench_chart && ./bench_chart
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "MemoryLCDSim.h"
+
+#define RATE_HZ			20		//batches per second
+#define SAMPLES_PER_S	400		//samples per second, one per pixel across a 400 pixel wide chart in sweep mode
+#define BATCH			(SAMPLES_PER_S / RATE_HZ)
+#define RUN_BATCHES		60		//3 s of signal
+
+static uint16_t history[GFX_CHART_HISTORY_SIZE(GFX_FB_CANVAS_W * 8, 1)];
+static bool panelBefore[GFX_FB_CANVAS_H][GFX_FB_CANVAS_W * 8];	//panel pixels when a run starts
+
+/**
+ * @return	number of pixels outside the chart rectangle the panel shows differently from panelBefore
+ */
+static uint32_t changedOutside(const GFX_CHART *pChart)
+{
+	uint32_t changed = 0;
+
+	for(uint16_t y = 0; y < GFXDisplayGetLCDHeight(); y++)
+		for(uint16_t x = 0; x < GFXDisplayGetLCDWidth(); x++)
+		{
+			bool inside = (x >= pChart->left) && (x < pChart->left + pChart->width) && (y >= pChart->top) && (y < pChart->top + pChart->height);
+			if(!inside && (sim_get_pixel(x, y) != panelBefore[y][x]))
+				changed++;
+		}
+	return changed;
+}
+
+/**
+ * @brief	Test signal: two sines and some noise, full scale is +/-1000
+ */
+static int16_t signal(uint32_t n)
+{
+	double t = (double)n / SAMPLES_PER_S;
+	return (int16_t)(700.0 * sin(2.0 * M_PI * 1.3 * t) + 200.0 * sin(2.0 * M_PI * 7.0 * t) + (rand() % 101) - 50);
+}
+
+/**
+ * @brief	Feed a chart with RUN_BATCHES batches, check each one and report its bus time
+ * @return	true if every batch passed
+ */
+static bool runChart(const char *label, GFX_CHART *pChart, double *pMaxMs)
+{
+	int16_t samples[BATCH];
+	uint32_t n = 0, rowsTotal = 0;
+	uint64_t busNs = 0, maxNs = 0;
+	bool ok = true;
+	SIM_COUNTERS cnt;
+
+	for(uint16_t y = 0; y < GFXDisplayGetLCDHeight(); y++)
+		for(uint16_t x = 0; x < GFXDisplayGetLCDWidth(); x++)
+			panelBefore[y][x] = sim_get_pixel(x, y);
+
+	srand(1);
+	for(uint16_t b = 0; b < RUN_BATCHES; b++)
+	{
+		for(uint16_t i = 0; i < BATCH; i++)
+			samples[i] = signal(n++);
+
+		sim_counters_reset();
+		uint16_t rows = GFXDisplayChartAddSamples(pChart, samples, BATCH);
+		sim_get_counters(&cnt);
+
+		//one transaction with the rows reported (GFX_SHADOW skips those the panel has already), nothing left different
+		//between panel and frame buffer
+#if GFX_SHADOW
+		bool batchOk = (cnt.transactions <= 1) && (cnt.linesWritten <= rows);
+#else
+		bool batchOk = (cnt.transactions == (rows ? 1u : 0u)) && (cnt.linesWritten == rows);
+#endif
+		batchOk &= (cnt.protocolErrors == 0) && (sim_compare_framebuffer() == 0);
+		uint32_t outside = changedOutside(pChart);
+		batchOk &= (outside == 0);
+
+		//newest sample drawn, sweep mode keeps the gap ahead of it blank
+		int32_t x = (pChart->mode == GFX_CHART_SCROLL) ? (pChart->left + pChart->width - 1) : (pChart->left + (pChart->count - 1) * pChart->step);
+		batchOk &= !sim_get_pixel((uint16_t)x, (uint16_t)pChart->lastY);
+		if((pChart->mode == GFX_CHART_SWEEP) && (pChart->bg != TRANSPARENT))
+		{
+			for(int32_t g = x + 1; g <= MIN(x + pChart->gap, (int32_t)pChart->left + pChart->width - 1); g++)
+				for(uint16_t y = pChart->top; y < pChart->top + pChart->height; y++)
+					batchOk &= sim_get_pixel((uint16_t)g, y);
+		}
+
+		if(!batchOk)
+			printf("%s: batch %u FAILED, %u rows, %u transactions, %u lines, %u pixels changed outside the chart\n", label, b, rows,
+				cnt.transactions, cnt.linesWritten, outside);
+		ok &= batchOk;
+		rowsTotal += rows;
+		busNs += cnt.busTimeNs;
+		maxNs = MAX(maxNs, cnt.busTimeNs);
+	}
+
+	*pMaxMs = maxNs / 1e6;
+	printf("%-34s rows/batch %6.1f  bus ms/batch avg %6.2f max %6.2f  (%4.1f%% of %u ms)  %s\n", label, (double)rowsTotal / RUN_BATCHES,
+		busNs / 1e6 / RUN_BATCHES, *pMaxMs, 100.0 * maxNs / 1e6 / (1000.0 / RATE_HZ), 1000 / RATE_HZ, ok ? "ok" : "FAILED");
+	return ok;
+}
+
+/**
+ * @brief	The same sweep trace the way it was done before: erase the column, then one GFXDisplayPutPixel() per sample
+ */
+static void runPerPixel(uint16_t left, uint16_t top, uint16_t width, uint16_t height)
+{
+	SIM_COUNTERS cnt;
+	uint32_t n = 0;
+	uint64_t busNs = 0, maxNs = 0, trans = 0;
+
+	srand(1);
+	for(uint16_t b = 0; b < RUN_BATCHES; b++)
+	{
+		sim_counters_reset();
+		for(uint16_t i = 0; i < BATCH; i++, n++)
+		{
+			uint16_t x = left + n % width;
+			int32_t y = top + height - 1 - ((int32_t)signal(n) + 1000) * (height - 1) / 2000;
+			GFXDisplayLineDrawV(x, top, top + height - 1, WHITE, 1);
+			GFXDisplayPutPixel(x, (uint16_t)y, BLACK);
+		}
+		sim_get_counters(&cnt);
+		busNs += cnt.busTimeNs;
+		trans += cnt.transactions;
+		maxNs = MAX(maxNs, cnt.busTimeNs);
+	}
+	printf("%-34s transactions/batch %6.1f  bus ms/batch avg %6.2f max %6.2f  (%4.1f%% of %u ms), dots not connected\n",
+		"sweep, LineDrawV + PutPixel", (double)trans / RUN_BATCHES, busNs / 1e6 / RUN_BATCHES, maxNs / 1e6,
+		100.0 * maxNs / 1e6 / (1000.0 / RATE_HZ), 1000 / RATE_HZ);
+}
+
+int main(void)
+{
+	bool ok = true;
+	GFX_CHART chart;
+	double maxMs;
+	uint16_t width = GFXDisplayGetLCDWidth(), height = GFXDisplayGetLCDHeight();
+	uint16_t chartTop = height / 6, chartHeight = height * 2 / 3;
+
+	hal_bsp_init();
+	GFXDisplayPowerOn();
+	GFXDisplayAllClear();
+
+	printf("%ux%u, chart %ux%u at %u Hz, %u samples per batch\n", width, height, width, chartHeight, RATE_HZ, BATCH);
+
+	//hatched background to catch rows changed but not refreshed
+	for(uint16_t y = chartTop; y < chartTop + chartHeight; y += 8)
+		GFXDisplayLineDrawH(0, width - 1, y, BLACK, 1);
+
+	GFXDisplayChartInit(&chart, 0, chartTop, width, chartHeight, -1000, 1000, GFX_CHART_SWEEP, NULL);
+	ok &= runChart("sweep, full width", &chart, &maxMs);
+#if defined (LS027B7DH01)
+	ok &= (maxMs < 1000.0 / RATE_HZ);	//the 20 Hz target is set for the 2.7" model, a full-height swing on taller models takes longer at 2 MHz
+#endif
+
+	chart.step = 2;
+	GFXDisplayChartClear(&chart);
+	ok &= runChart("sweep, step 2", &chart, &maxMs);
+
+	GFXDisplayChartInit(&chart, 0, chartTop, width, chartHeight, -1000, 1000, GFX_CHART_SWEEP, NULL);
+	chart.bg = TRANSPARENT;
+	ok &= runChart("sweep, transparent", &chart, &maxMs);
+
+	GFXDisplayChartInit(&chart, 0, chartTop, width, chartHeight, -1000, 1000, GFX_CHART_SCROLL, history);
+	GFXDisplayChartClear(&chart);
+	ok &= runChart("scroll, full width", &chart, &maxMs);
+
+	GFXDisplayChartInit(&chart, width / 4, chartTop + 10, width / 2, chartHeight / 2, -1000, 1000, GFX_CHART_SCROLL, history);
+	chart.step = 3;
+	GFXDisplayChartClear(&chart);
+	ok &= runChart("scroll, half width, step 3", &chart, &maxMs);
+
+	//100x50 at left 50 on the 400x240 model, hatched columns on both sides
+	GFXDisplayChartInit(&chart, 50, chartTop + 10, MIN(100, width - 60), MIN(50, chartHeight - 20), -1000, 1000, GFX_CHART_SCROLL, history);
+	GFXDisplayChartClear(&chart);
+	ok &= runChart("scroll, narrow at left 50", &chart, &maxMs);
+
+	GFXDisplayAllClear();
+	runPerPixel(0, chartTop, width, chartHeight);
+
+	printf("%s\n", ok ? "ok" : "FAILED");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,226 @@
+/**
+ * @brief	Host check and benchmark of GFXDisplayFlush() with scattered dirty lines.
+ *			Each case marks a set of rows dirty, drawn in any order, and flushes them once the way the driver does now (one
+ *			multiple-lines update for all of them) and once run by run (one update per group of adjacent rows, as before).
+ *			The panel has to match the frame buffer after both. Transactions, bytes and bus time at GFX_SPI_CLOCK_HZ are
+ *			reported; with GFX_SCS_MAX_US every SCS window has to stay within it and the flush has to use as few as it allows.
+ *			A banded display flushes the same rows with one update per band.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/bench/bench_coalesce.cpp extras/host/MemoryLCDSim.cpp src/MemoryLCD.cpp src/bfcFontMgr.c \
+ *				-lstdc++ -o bench_coalesce && ./bench_coalesce<br>
+ *			Add -DGFX_SCS_MAX_US=2000 to see the update split into windows of 2 ms.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+
+#define ROWS_MAX	1024
+
+typedef struct
+{
+	const char	*name;
+	uint16_t	count;
+	uint16_t	rows[ROWS_MAX];
+} ROW_SET;
+
+static GFX_DISPLAY lcd;		//full frame buffer in every build, GFX_BAND_LINES included
+static uint8_t lcdBuffer[GFX_FB_SIZE(DISP_HOR_RESOLUTION, GFX_FB_CANVAS_H)], lcdDirty[(GFX_FB_CANVAS_H + 7) / 8];
+
+/**
+ * @brief	Rows given in any order: a stripe of dirty rows in every band of 8, three menu rows, random rows and the whole screen
+ */
+static void buildSets(ROW_SET *sets, uint16_t *pCount)
+{
+	const uint16_t H = GFXDisplayGetLCDHeight();
+	uint16_t n = 0;
+
+	sets[n].name = "every 8th row";
+	sets[n].count = 0;
+	for(uint16_t y = H - 1; y < H; y -= 8)		//bottom up
+		sets[n].rows[sets[n].count++] = y;
+	n++;
+
+	sets[n].name = "3 menu rows of 21";
+	sets[n].count = 0;
+	for(uint16_t r = 0; r < 3; r++)
+	{
+		uint16_t top = (uint16_t)((2 - r) * H / 3);
+		for(uint16_t y = top; (y < top + 21) && (y < H); y++)
+			sets[n].rows[sets[n].count++] = y;
+	}
+	n++;
+
+	sets[n].name = "40 random rows";
+	sets[n].count = 0;
+	srand(7);
+	for(uint16_t i = 0; i < 40; i++)
+		sets[n].rows[sets[n].count++] = (uint16_t)(rand() % H);	//repeats are flushed once
+	n++;
+
+	sets[n].name = "two fields";
+	sets[n].count = 0;
+	for(uint16_t y = H / 2; y < H / 2 + 12; y++)
+		sets[n].rows[sets[n].count++] = y;
+	for(uint16_t y = 4; y < 16; y++)
+		sets[n].rows[sets[n].count++] = y;
+	n++;
+
+	sets[n].name = "whole screen";
+	sets[n].count = 0;
+	for(uint16_t y = 0; y < H; y++)
+		sets[n].rows[sets[n].count++] = y;
+	n++;
+
+	*pCount = n;
+}
+
+/**
+ * @brief	Change the rows of a set in the frame buffer, marking them dirty in the same order
+ */
+static void drawRows(const ROW_SET *pSet)
+{
+	const uint16_t W = GFXDisplayGetLCDWidth();
+
+	for(uint16_t i = 0; i < pSet->count; i++)
+		GFXDisplayLineDrawH(0, W - 1, pSet->rows[i], (rand() & 1) ? WHITE : BLACK, 1);
+	for(uint16_t i = 0; i < pSet->count; i++)
+		GFXDisplayPutPixel((uint16_t)(rand() % W), pSet->rows[i], BLACK);
+}
+
+/**
+ * @return	longest SCS high window in us since time t0 in the edge log
+ */
+static double longestWindowUs(uint64_t t0)
+{
+	const SIM_EDGE *log;
+	uint16_t first, count = sim_edge_log(&log, &first);
+	uint64_t high = 0, longest = 0;
+	bool open = false;		//the previous window may end at t0
+
+	for(uint16_t i = 0; i < count; i++)
+	{
+		const SIM_EDGE *e = &log[(first + i) % SIM_EDGE_LOG_SIZE];
+		if((e->pin != GFX_DISPLAY_SCS) || (e->timeNs < t0))
+			continue;
+		if(e->level)
+			high = e->timeNs;
+		else if(open && (e->timeNs - high > longest))
+			longest = e->timeNs - high;
+		open = e->level;
+	}
+	return longest / 1000.0;
+}
+
+/**
+ * @brief	Flush the dirty rows run by run, one update for each group of adjacent rows as GFXDisplayFlush() did before
+ */
+static void flushRuns(void)
+{
+	const uint16_t H = GFXDisplayGetLCDHeight();
+	uint8_t dirty[(GFX_FB_CANVAS_H + 7) / 8];
+
+	memcpy(dirty, lcdDirty, sizeof(dirty));
+	memset(lcdDirty, 0x00, sizeof(dirty));
+	for(uint16_t y = 0; y < H; )
+	{
+		if((dirty[y >> 3] & (0x01 << (y & 0x07))) == 0)
+		{
+			y++;
+			continue;
+		}
+		for(; (y < H) && (dirty[y >> 3] & (0x01 << (y & 0x07))); y++)
+			lcdDirty[y >> 3] |= (uint8_t)(0x01 << (y & 0x07));
+		GFXDisplayFlush();
+	}
+}
+
+/**
+ * @brief	The rows of a set on a banded display: one window per band that holds dirty rows
+ */
+static bool checkBanded(const ROW_SET *pSet, uint16_t bandLines)
+{
+	static GFX_DISPLAY bandLcd;
+	static uint8_t band[GFX_FB_SIZE(DISP_HOR_RESOLUTION, 64)], list[512], dirty[(GFX_FB_CANVAS_H + 7) / 8];
+	const uint16_t H = GFXDisplayGetLCDHeight();
+	SIM_COUNTERS c;
+	uint16_t bands = 0;
+
+	GFXDisplayInitBanded(&bandLcd, &GFX_DISPLAY_DESC_DEFAULT, band, bandLines, list, sizeof(list), dirty, NULL);
+	GFXDisplaySelect(&bandLcd);
+	GFXDisplayAllClear();
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+	for(uint16_t i = 0; i < pSet->count; i++)
+		GFXDisplayPutPixel(5, pSet->rows[i], BLACK);
+	for(uint16_t y = 0; y < H; y++)		//bands as GFXDisplayFlush() renders them: from a dirty row, bandLines rows
+	{
+		if(dirty[y >> 3] & (0x01 << (y & 0x07)))
+		{
+			bands++;
+			y += bandLines - 1;
+		}
+	}
+
+	sim_counters_reset();
+	GFXDisplayFlush();
+	sim_get_counters(&c);
+	GFXDisplaySelect(&lcd);
+	return (GFX_SCS_MAX_US != 0) || (c.transactions == bands);
+}
+
+int main(void)
+{
+	static ROW_SET sets[8];
+	uint16_t setCount;
+	bool ok = true;
+
+	hal_bsp_init();
+	GFXDisplayInit(&lcd, &GFX_DISPLAY_DESC_DEFAULT, lcdBuffer, lcdDirty, NULL);
+	GFXDisplaySelect(&lcd);
+	GFXDisplayAllClear();
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+	buildSets(sets, &setCount);
+
+	printf("%s, %u lines, GFX_SCS_MAX_US %u\n", GFXDisplayGetDesc()->name, GFXDisplayGetLCDHeight(), (unsigned)GFX_SCS_MAX_US);
+	printf("%-20s %6s %8s %8s %10s %8s %8s %10s %8s\n", "dirty rows", "lines", "runs tx", "bytes", "bus us", "one tx", "bytes",
+		"bus us", "window");
+	for(uint16_t s = 0; s < setCount; s++)
+	{
+		SIM_COUNTERS runs, one;
+
+		drawRows(&sets[s]);
+		sim_counters_reset();
+		flushRuns();
+		sim_get_counters(&runs);
+		ok &= (sim_compare_framebuffer() == 0);
+
+		drawRows(&sets[s]);
+		sim_counters_reset();
+		uint64_t t0 = sim_time_ns();
+		uint16_t lines = GFXDisplayFlush();
+		sim_get_counters(&one);
+		double window = longestWindowUs(t0);
+		ok &= (sim_compare_framebuffer() == 0) && (one.linesWritten == lines) && (runs.linesWritten == lines);
+
+		if(GFX_SCS_MAX_US == 0)
+			ok &= (one.transactions == 1);
+		else
+		{
+			//as few windows as fit: each holds the lines whose bytes stay within the budget
+			uint32_t lineUs = (uint32_t)((2u + GFXDisplayGetDesc()->bytesPerLine) * 8000000ULL / GFX_SPI_CLOCK_HZ);
+			uint32_t fixedUs = GFXDisplayGetDesc()->scsSetupUs + GFXDisplayGetDesc()->scsHoldUs + (uint32_t)(2 * 8000000ULL / GFX_SPI_CLOCK_HZ);
+			uint32_t perWindow = (GFX_SCS_MAX_US - fixedUs) / lineUs;
+			ok &= (window <= GFX_SCS_MAX_US + 1) && (one.transactions <= (lines + perWindow - 1) / perWindow + 1);
+		}
+
+		printf("%-20s %6u %8u %8u %10.0f %8u %8u %10.0f %8.0f\n", sets[s].name, lines, runs.transactions, runs.bytes,
+			runs.busTimeNs / 1000.0, one.transactions, one.bytes, one.busTimeNs / 1000.0, window);
+	}
+
+	for(uint16_t s = 0; s < setCount; s++)		//last, they write the same panel
+		ok &= checkBanded(&sets[s], 16);
+
+	printf("%s\n", ok ? "ok" : "FAILED");
+	return ok ? 0 : 1;
+}
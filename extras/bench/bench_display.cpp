@@ -0,0 +1,129 @@
+/**
+ * @brief	Host check and microbenchmark of run-time display descriptors.
+ *			Every model is driven from one binary through GFXDisplaySelect() and checked on the simulated panel, then the same
+ *			drawing runs on the default display (model constants) and on a display of the same model through a copy of its
+ *			descriptor (geometry read at run time) to compare the frame buffers and the throughput of both paths.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/bench/bench_display.cpp extras/host/MemoryLCDSim.cpp src/MemoryLCD.cpp src/bfcFontMgr.c \
+ *				examples/HelloWorld/Consolas24h.c examples/HelloWorld_v2/run_64x64.c -lstdc++ -o bench_display && ./bench_display
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+#include "bench_util.h"
+
+extern const BFC_FONT fontConsolas24h;
+extern const tImage run_64x64;
+
+GFX_DISPLAY_DEFINE(lcdSmall, LS013B7DH03);
+
+static void drawScene(uint16_t seed)
+{
+	uint16_t w = GFXDisplayGetLCDWidth(), h = GFXDisplayGetLCDHeight();
+
+	GFXDisplayDrawRect(seed % 7, seed % 5, w/2 + seed % 9, h/3, BLACK);
+	GFXDisplayLineDrawH(3, w - 1, h/2, BLACK, 3);
+	GFXDisplayLineDrawV(w/3 + seed % 8, 0, h - 1, WHITE, 2);
+	GFXDisplayPutString(seed % 11, h/2 + 4, &fontConsolas24h, "Memory LCD", BLACK, WHITE);
+	GFXDisplayPutImage(w/2 + seed % 13, seed % 17, &run_64x64, seed & 1);
+	GFXDisplayPutPixel(w - 1, h - 1, BLACK);
+}
+
+/**
+ * @brief	Draw on every model in immediate mode and compare the simulated panel with the frame buffer of the display
+ */
+static bool checkModels(void)
+{
+	const GFX_DISPLAY_DESC *models[] = { &gfxDescLS027B7DH01, &gfxDescLS032B7DD02, &gfxDescLS044Q7DH01, &gfxDescLS006B7DH03,
+										 &gfxDescLS011B7DH03, &gfxDescLS013B7DH03, &gfxDescLS018B7DH02 };
+	bool ok = true;
+
+	for(unsigned m = 0; m < sizeof(models)/sizeof(models[0]); m++)
+	{
+		const GFX_DISPLAY_DESC *pDesc = models[m];
+		GFX_DISPLAY display;
+		uint8_t *fb = (uint8_t *)malloc(GFX_FB_SIZE(pDesc->width, pDesc->height));
+		uint8_t *dirty = (uint8_t *)malloc((pDesc->height + 7) / 8);
+		SIM_COUNTERS c;
+
+		GFXDisplayInit(&display, pDesc, fb, dirty, NULL);
+		GFXDisplaySelect(&display);
+		sim_counters_reset();
+		GFXDisplayAllClear();
+		for(uint16_t seed = 0; seed < 4; seed++)
+			drawScene(seed);
+		sim_get_counters(&c);
+
+		uint16_t diff = sim_compare_framebuffer();
+		printf("%-12s %3ux%-3u  %2u-bit address  lines written %5u  differing lines %u%s\n", pDesc->name, pDesc->width, pDesc->height,
+			   pDesc->addressBits, c.linesWritten, diff, c.protocolErrors ? "  PROTOCOL ERROR" : "");
+		if(diff != 0 || c.protocolErrors)
+			ok = false;
+
+		GFXDisplaySelect(NULL);
+		free(fb);
+		free(dirty);
+	}
+
+	GFXDisplaySelect(&lcdSmall);
+	GFXDisplayAllClear();
+	drawScene(1);
+	if(sim_compare_framebuffer() != 0)
+		ok = false;
+	GFXDisplaySelect(NULL);
+
+	return ok;
+}
+
+#define REPEAT	2000
+
+int main(void)
+{
+	hal_bsp_init();
+
+	if(!checkModels())
+		return 1;
+
+	//a copy of the default model descriptor makes GFX_GEOMETRY_CALL() take the run-time geometry path
+	static GFX_DISPLAY_DESC descCopy = GFX_DISPLAY_DESC_DEFAULT;
+	static uint8_t fbCopy[GFX_FB_SIZE(DISP_HOR_RESOLUTION, GFX_FB_CANVAS_H)];
+	static uint8_t dirtyCopy[(GFX_FB_CANVAS_H + 7) / 8];
+	GFX_DISPLAY runtimeDisplay;
+
+	GFXDisplayInit(&runtimeDisplay, &descCopy, fbCopy, dirtyCopy, NULL);
+	GFX_DISPLAY *displays[2] = { NULL, &runtimeDisplay };
+	double ns[2] = { 1e12, 1e12 };
+
+	for(int d = 0; d < 2; d++)
+	{
+		GFXDisplaySelect(displays[d]);
+		GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+		memset(GFXDisplayGetSelected()->frameBuffer, 0xFF, sizeof(fbCopy));
+	}
+
+	for(int round = 0; round < 5; round++)		//alternate both paths and keep the best round of each
+	{
+		for(int d = 0; d < 2; d++)
+		{
+			GFXDisplaySelect(displays[d]);
+			double t0 = nowNs();
+			for(int i = 0; i < REPEAT; i++)
+				drawScene((uint16_t)i);
+			ns[d] = MIN(ns[d], (nowNs() - t0) / REPEAT);
+		}
+	}
+	GFXDisplaySelect(NULL);
+
+	if(memcmp(frameBuffer, fbCopy, sizeof(fbCopy)) != 0)
+	{
+		printf("Frame buffers of the model and descriptor paths differ\n");
+		return 1;
+	}
+
+	printf("\n%-40s %10s\n", "scene in deferred mode", "ns");
+	printf("%-40s %10.0f\n", "default display, model constants", ns[0]);
+	printf("%-40s %10.0f\n", "same model, descriptor read at run time", ns[1]);
+	return 0;
+}
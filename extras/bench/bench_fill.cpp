@@ -0,0 +1,90 @@
+/**
+ * @brief	Host microbenchmark of the rectangle/line fill kernels against the former per-pixel path.
+ *			The drawing functions run in GFX_FLUSH_DEFERRED mode on the host simulator HAL, so only the frame buffer work is timed.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/bench/bench_fill.cpp extras/host/MemoryLCDSim.cpp src/MemoryLCD.cpp src/bfcFontMgr.c -lstdc++ -o bench_fill && ./bench_fill
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+#include "bench_util.h"
+
+static uint8_t refBuffer[GFX_FB_CANVAS_H][GFX_FB_CANVAS_W];
+
+static void refDrawRect(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, COLOR color)
+{
+	for(uint16_t y = top; y <= bottom; y++)
+		for(uint16_t x = left; x <= right; x++)
+			refPutPixel(refBuffer, x, y, color);
+}
+
+/**
+ * @brief	Draw random rectangles with both paths and compare the frame buffers
+ */
+static bool checkAgainstReference(void)
+{
+	memset(frameBuffer, 0xFF, sizeof(frameBuffer));
+	memset(refBuffer, 0xFF, sizeof(refBuffer));
+	srand(1);
+
+	for(int i = 0; i < 20000; i++)
+	{
+		uint16_t x1 = rand() % (DISP_HOR_RESOLUTION + 16), x2 = rand() % (DISP_HOR_RESOLUTION + 16);
+		uint16_t y1 = rand() % (DISP_VER_RESOLUTION + 4),  y2 = rand() % (DISP_VER_RESOLUTION + 4);
+		COLOR color = (COLOR)(rand() % 2);
+
+		GFXDisplayDrawRect(x1, y1, x2, y2, color);
+		refDrawRect(MIN(x1,x2), MIN(y1,y2), MAX(x1,x2), MAX(y1,y2), color);
+
+		if(sim_compare_rows(&refBuffer[0][0]) != 0)
+		{
+			printf("Mismatch at rectangle %d (%u,%u)-(%u,%u)\n", i, x1, y1, x2, y2);
+			return false;
+		}
+	}
+	return true;
+}
+
+#define REPEAT	2000
+
+int main(void)
+{
+	hal_bsp_init();
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+
+	if(!checkAgainstReference())
+		return 1;
+
+	uint16_t w = DISP_HOR_RESOLUTION, h = MIN(60, DISP_VER_RESOLUTION);
+	double t0, refNs, spanNs;
+
+	printf("%-28s %12s %12s %8s\n", "case", "per-pixel ns", "span ns", "speedup");
+
+	t0 = nowNs();
+	for(int i = 0; i < REPEAT; i++) refDrawRect(0, 0, w-1, h-1, (COLOR)(i & 1));
+	refNs = (nowNs() - t0) / REPEAT;
+	t0 = nowNs();
+	for(int i = 0; i < REPEAT; i++) GFXDisplayDrawRect(0, 0, w-1, h-1, (COLOR)(i & 1));
+	spanNs = (nowNs() - t0) / REPEAT;
+	printf("DrawRect %3ux%-3u            %12.0f %12.0f %7.1fx\n", w, h, refNs, spanNs, refNs/spanNs);
+
+	t0 = nowNs();
+	for(int i = 0; i < REPEAT; i++) refDrawRect(3, 7, w-5, 9, (COLOR)(i & 1));
+	refNs = (nowNs() - t0) / REPEAT;
+	t0 = nowNs();
+	for(int i = 0; i < REPEAT; i++) GFXDisplayLineDrawH(3, w-5, 7, (COLOR)(i & 1), 3);
+	spanNs = (nowNs() - t0) / REPEAT;
+	printf("LineDrawH thick 3           %12.0f %12.0f %7.1fx\n", refNs, spanNs, refNs/spanNs);
+
+	t0 = nowNs();
+	for(int i = 0; i < REPEAT; i++) refDrawRect(10, 0, 12, DISP_VER_RESOLUTION-1, (COLOR)(i & 1));
+	refNs = (nowNs() - t0) / REPEAT;
+	t0 = nowNs();
+	for(int i = 0; i < REPEAT; i++) GFXDisplayLineDrawV(10, 0, DISP_VER_RESOLUTION-1, (COLOR)(i & 1), 3);
+	spanNs = (nowNs() - t0) / REPEAT;
+	printf("LineDrawV thick 3           %12.0f %12.0f %7.1fx\n", refNs, spanNs, refNs/spanNs);
+
+	return 0;
+}
@@ -0,0 +1,168 @@
+/**
+ * @brief	Host microbenchmark of the row-based glyph renderer against the former per-pixel BFC decoder.
+ *			Frame buffer work is timed in GFX_FLUSH_DEFERRED mode, SPI traffic of GFXDisplayPutString() is counted in GFX_FLUSH_IMMEDIATE mode.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/bench/bench_font.cpp extras/host/MemoryLCDSim.cpp src/MemoryLCD.cpp src/bfcFontMgr.c \
+ *				examples/HelloWorld/Consolas24h.c examples/HelloWorld/Arial_Rounded_MT_Bold55h.c examples/HelloWorld/SimHei_35h.c \
+ *				-lstdc++ -o bench_font && ./bench_font
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+#include "bench_util.h"
+
+extern const BFC_FONT fontConsolas24h;
+extern const BFC_FONT fontArial_Rounded_MT_Bold55h;
+extern const BFC_FONT fontSimHei_35h;
+
+static uint8_t refBuffer[GFX_FB_CANVAS_H][GFX_FB_CANVAS_W];
+
+/**
+ * @brief	Per-pixel reference, the decoding bfc_DrawChar_RowRowUnpacked() did for every glyph before the row renderer
+ */
+static uint16_t refPutChar(uint16_t x0, uint16_t y0, const BFC_FONT *pFont, uint16_t ch, COLOR color, COLOR bg)
+{
+	const BFC_CHARINFO *pCharInfo = GetCharInfo(pFont, ch);
+	if(pCharInfo == 0)
+		return 0;
+
+	int height = pFont->FontHeight;
+	int width = pCharInfo->Width;
+	int bpp = GetFontBpp(pFont->FontType);
+	int bytesPerLine = (width * bpp + 7) / 8;
+	int bLittleEndian = (GetFontEndian(pFont->FontType)==1);
+
+	for(int y = 0; y < height; y++)
+	{
+		for(int x = 0; x < width; x++)
+		{
+			unsigned char pixel = pCharInfo->p.pData8[y * bytesPerLine + (x * bpp) / 8];
+			unsigned char bit = bLittleEndian ? (8-bpp)-(x*bpp)%8 : (x*bpp)%8;
+			pixel = pixel<<bit;
+			pixel = pixel>>(8/bpp-1)*bpp;
+
+			if(pixel)
+				refPutPixel(refBuffer, x0+x, y0+y, color);
+			else if(bg != TRANSPARENT)
+				refPutPixel(refBuffer, x0+x, y0+y, bg);
+		}
+	}
+	return (uint16_t)width;
+}
+
+static uint16_t refPutString(uint16_t x, uint16_t y, const BFC_FONT *pFont, const char *str, COLOR color, COLOR bg)
+{
+	uint16_t _x = x;
+	while(*str != '\0')
+		_x += refPutChar(_x, y, pFont, (uint8_t)*str++, color, bg);
+	return (uint16_t)(_x - x);
+}
+
+/**
+ * @brief	Build a big endian (leftmost pixel in MSB) copy of a BFC_LITTLE_ENDIAN font, all example fonts are little endian
+ */
+static const BFC_FONT* makeBigEndianFont(const BFC_FONT *pFont)
+{
+	BFC_FONT *pCopy = (BFC_FONT *)malloc(sizeof(BFC_FONT));
+	*pCopy = *pFont;
+	pCopy->FontType &= ~BFC_LITTLE_ENDIAN;
+
+	BFC_FONT_PROP **ppNext = (BFC_FONT_PROP **)&pCopy->p.pProp;
+	for(const BFC_FONT_PROP *pProp = pFont->p.pProp; pProp != 0; pProp = pProp->pNextProp)
+	{
+		uint16_t count = pProp->LastChar - pProp->FirstChar + 1;
+		BFC_FONT_PROP *pNewProp = (BFC_FONT_PROP *)malloc(sizeof(BFC_FONT_PROP));
+		BFC_CHARINFO *pInfo = (BFC_CHARINFO *)malloc(count * sizeof(BFC_CHARINFO));
+
+		for(uint16_t i = 0; i < count; i++)
+		{
+			pInfo[i] = pProp->pFirstCharInfo[i];
+			uint8_t *pData = (uint8_t *)malloc(pInfo[i].DataSize);
+			for(uint16_t j = 0; j < pInfo[i].DataSize; j++)
+			{
+				uint8_t b = pProp->pFirstCharInfo[i].p.pData8[j], r = 0;
+				for(int k = 0; k < 8; k++)
+					r |= ((b >> k) & 0x01) << (7 - k);
+				pData[j] = r;
+			}
+			pInfo[i].p.pData8 = pData;
+		}
+		*pNewProp = *pProp;
+		pNewProp->pFirstCharInfo = pInfo;
+		pNewProp->pNextProp = 0;
+		*ppNext = pNewProp;
+		ppNext = (BFC_FONT_PROP **)&pNewProp->pNextProp;
+	}
+	return pCopy;
+}
+
+/**
+ * @brief	Print strings at random positions, partly off screen, with both paths and compare the frame buffers
+ */
+static bool checkAgainstReference(const BFC_FONT *pFont, const char *name)
+{
+	static const char *strings[] = { "@123:{Hello}", "Memory LCD", "jq|W_", "0" };
+
+	memset(frameBuffer, 0x5A, sizeof(frameBuffer));
+	memset(refBuffer, 0x5A, sizeof(refBuffer));
+	srand(1);
+
+	for(int i = 0; i < 2000; i++)
+	{
+		const char *str = strings[rand() % 4];
+		uint16_t x = rand() % (DISP_HOR_RESOLUTION + 8), y = rand() % (DISP_VER_RESOLUTION + 4);
+		COLOR color = (COLOR)(rand() % 2), bg = (COLOR)(rand() % 3);
+
+		GFXDisplayPutString(x, y, pFont, str, color, bg);
+		refPutString(x, y, pFont, str, color, bg);
+
+		if(sim_compare_rows(&refBuffer[0][0]) != 0)
+		{
+			printf("%s: mismatch at string %d \"%s\" at (%u,%u)\n", name, i, str, x, y);
+			return false;
+		}
+	}
+	return true;
+}
+
+static void bench(const char *label, const BFC_FONT *pFont, const char *str, COLOR bg, int repeat)
+{
+	double t0 = nowNs();
+	for(int i = 0; i < repeat; i++) refPutString(3, 10, pFont, str, BLACK, bg);
+	double refNs = (nowNs() - t0) / repeat;
+
+	t0 = nowNs();
+	for(int i = 0; i < repeat; i++) GFXDisplayPutString(3, 10, pFont, str, BLACK, bg);
+	double rowNs = (nowNs() - t0) / repeat;
+
+	printf("%-36s %12.0f %12.0f %7.1fx\n", label, refNs, rowNs, refNs/rowNs);
+}
+
+int main(void)
+{
+	hal_bsp_init();
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+
+	const BFC_FONT *pConsolasBE = makeBigEndianFont(&fontConsolas24h);
+	const BFC_FONT *pArialBE = makeBigEndianFont(&fontArial_Rounded_MT_Bold55h);
+
+	if(!checkAgainstReference(&fontConsolas24h, "Consolas24h") ||
+	   !checkAgainstReference(&fontArial_Rounded_MT_Bold55h, "Arial_Rounded_MT_Bold55h") ||
+	   !checkAgainstReference(pConsolasBE, "Consolas24h big endian") ||
+	   !checkAgainstReference(pArialBE, "Arial_Rounded_MT_Bold55h big endian"))
+		return 1;
+
+	printf("%-36s %12s %12s %8s\n", "case", "per-pixel ns", "row ns", "speedup");
+	bench("Arial55h \"@123:{Hello}\" on WHITE", &fontArial_Rounded_MT_Bold55h, "@123:{Hello}", WHITE, 2000);
+	bench("Arial55h \"@123:{Hello}\" TRANSPARENT", &fontArial_Rounded_MT_Bold55h, "@123:{Hello}", TRANSPARENT, 2000);
+	bench("Arial55h big endian on WHITE", pArialBE, "@123:{Hello}", WHITE, 2000);
+	bench("Consolas24h \"Memory LCD\" on WHITE", &fontConsolas24h, "Memory LCD", WHITE, 5000);
+
+	//SPI traffic of one string, the text band is sent once instead of once per glyph
+	GFXDisplaySetFlushMode(GFX_FLUSH_IMMEDIATE);
+	SIM_REPORT(GFXDisplayPutString(0, 0, &fontArial_Rounded_MT_Bold55h, "@123:{Hello}", BLACK, WHITE));
+
+	return 0;
+}
@@ -0,0 +1,256 @@
+/**
+ * @brief	Host check and benchmark of the frame buffer layout of GFX_LINE_HEADERS.
+ *			Flushes sets of dirty rows and reports SPI write calls and bytes per flush, then checks GFXDisplayFlushAsync()
+ *			without a transfer buffer: one DMA transfer per run of adjacent lines straight from the frame buffer, the frame
+ *			buffer unchanged once it is complete (headers and the row after the run), with a transfer buffer, across VCOM
+ *			inversions, in a scrolled region and on a banded display. The panel has to match the frame buffer every time.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -DGFX_LINE_HEADERS=1 -Isrc -Iextras/host extras/bench/bench_headers.cpp extras/host/MemoryLCDSim.cpp \
+ *				src/MemoryLCD.cpp src/bfcFontMgr.c -lstdc++ -o bench_headers && ./bench_headers<br>
+ *			Without -DGFX_LINE_HEADERS=1 the same flushes are reported for comparison, -DGFX_VCOM=1 adds serial VCOM.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+
+static GFX_DISPLAY lcd;		//full frame buffer in every build, GFX_BAND_LINES included
+static uint8_t lcdBuffer[GFX_FB_SIZE(DISP_HOR_RESOLUTION, GFX_FB_CANVAS_H)], lcdDirty[(GFX_FB_CANVAS_H + 7) / 8];
+static uint8_t before[sizeof(lcdBuffer)];
+static uint8_t xfer[GFX_FB_CANVAS_H * (GFX_FB_CANVAS_W + 2) + 2];
+
+#define CHECK(cond)	do { if(!(cond)) { printf("FAILED line %d: %s\n", __LINE__, #cond); return false; } } while(0)
+
+/**
+ * @brief	Change rows top..bottom (included), a different pattern every call
+ */
+static void drawRows(uint16_t top, uint16_t bottom)
+{
+	const uint16_t W = GFXDisplayGetLCDWidth();
+
+	for(uint16_t y = top; y <= bottom; y++)
+		GFXDisplayLineDrawH((uint16_t)(rand() % (W / 2)), (uint16_t)(W / 2 + rand() % (W / 2)), y, (rand() & 1) ? WHITE : BLACK, 1);
+}
+
+/**
+ * @brief	Every 8th row, two fields and the whole screen with GFXDisplayFlush()
+ */
+static bool benchFlush(void)
+{
+	const uint16_t H = GFXDisplayGetLCDHeight();
+
+	printf("%-28s %6s %6s %8s %8s\n", "GFXDisplayFlush()", "lines", "tx", "writes", "bytes");
+	for(uint16_t s = 0; s < 3; s++)
+	{
+		static const char *names[] = { "every 8th row", "two fields of 12", "whole screen" };
+		SIM_COUNTERS c;
+
+		if(s == 0)
+			for(uint16_t y = 0; y < H; y += 8)
+				drawRows(y, y);
+		else if(s == 1)
+		{
+			drawRows(4, 15);
+			drawRows(H / 2, H / 2 + 11);
+		}
+		else
+			drawRows(0, H - 1);
+		sim_counters_reset();
+		uint16_t lines = GFXDisplayFlush();
+		sim_get_counters(&c);
+		CHECK(sim_compare_framebuffer() == 0 && c.linesWritten == lines && c.protocolErrors == 0);
+		printf("%-28s %6u %6u %8u %8u\n", names[s], lines, c.transactions, c.writeCalls, c.bytes);
+	}
+	return true;
+}
+
+/**
+ * @brief	GFXDisplayFlushAsync() until nothing is left, each transfer completed before the next
+ * @return	number of transfers
+ */
+static uint16_t flushAsyncAll(uint16_t *pLines)
+{
+	uint16_t lines, transfers = 0;
+
+	*pLines = 0;
+	while((lines = GFXDisplayFlushAsync(NULL)) != 0)
+	{
+		sim_dma_complete();
+		*pLines += lines;
+		transfers++;
+	}
+	return transfers;
+}
+
+/**
+ * @brief	GFXDisplayFlushAsync() with and without a transfer buffer
+ */
+static bool checkAsync(void)
+{
+	const uint16_t H = GFXDisplayGetLCDHeight();
+	SIM_COUNTERS c;
+	uint16_t lines, transfers;
+
+	printf("\n%-28s %6s %6s %8s %8s\n", "GFXDisplayFlushAsync()", "lines", "dma", "writes", "bytes");
+	GFXDisplaySetTransferBuffer(NULL, 0);
+	drawRows(4, 15);
+	drawRows(H / 2, H / 2 + 11);
+	memcpy(before, lcdBuffer, sizeof(before));
+	sim_counters_reset();
+	lines = GFXDisplayFlushAsync(NULL);
+#if GFX_LINE_HEADERS
+	//the first field straight from the frame buffer, the second one stays dirty
+	CHECK(lines > 0 && lines <= 12 && GFXDisplayFlushBusy() && sim_dma_pending());
+	CHECK(sim_dma_complete() && !GFXDisplayFlushBusy());
+	CHECK(memcmp(before, lcdBuffer, sizeof(before)) == 0);
+	for(uint16_t y = 0; y < H; y++)
+		CHECK(((lcdDirty[y >> 3] >> (y & 0x07)) & 0x01) == ((y >= 4 + lines) && ((y < 16) || ((y >= H / 2) && (y < H / 2 + 12)))));
+	transfers = (uint16_t)(1 + flushAsyncAll(&lines));
+#else
+	CHECK(lines == 24 && !GFXDisplayFlushBusy());	//sent by GFXDisplayFlush() before returning
+	transfers = 0;
+#endif
+	sim_get_counters(&c);
+	CHECK(sim_compare_framebuffer() == 0 && c.linesWritten == 24 && c.dmaTransfers == transfers && c.protocolErrors == 0);
+	printf("%-28s %6u %6u %8u %8u\n", "two fields, no buffer", c.linesWritten, c.dmaTransfers, c.writeCalls, c.bytes);
+
+	drawRows(0, H - 1);
+	memcpy(before, lcdBuffer, sizeof(before));
+	sim_counters_reset();
+	transfers = flushAsyncAll(&lines);
+	sim_get_counters(&c);
+	CHECK(lines == H && sim_compare_framebuffer() == 0 && c.protocolErrors == 0);
+	CHECK(memcmp(before, lcdBuffer, sizeof(before)) == 0);
+	CHECK(!GFX_LINE_HEADERS || (GFX_SCS_MAX_US != 0) || (c.dmaTransfers == 1 && c.writeCalls == 1));
+	printf("%-28s %6u %6u %8u %8u\n", "whole screen, no buffer", lines, c.dmaTransfers, c.writeCalls, c.bytes);
+
+	GFXDisplaySetTransferBuffer(xfer, sizeof(xfer));
+	drawRows(4, 15);
+	drawRows(H / 2, H / 2 + 11);
+	sim_counters_reset();
+	transfers = flushAsyncAll(&lines);
+	sim_get_counters(&c);
+	CHECK(lines == 24 && sim_compare_framebuffer() == 0 && c.protocolErrors == 0);
+	CHECK((GFX_SCS_MAX_US != 0) || (transfers == 1));
+	printf("%-28s %6u %6u %8u %8u\n", "two fields, transfer buffer", lines, c.dmaTransfers, c.writeCalls, c.bytes);
+	GFXDisplaySetTransferBuffer(NULL, 0);
+	return true;
+}
+
+/**
+ * @brief	Updates across VCOM inversions: the M1 bit of the headers kept in the frame buffer follows VCOM
+ */
+static bool checkVcom(void)
+{
+#if (GFX_VCOM == GFX_VCOM_SERIAL)
+	const uint16_t H = GFXDisplayGetLCDHeight();
+	SIM_COUNTERS c;
+	uint16_t lines;
+
+	sim_set_extmode(false);		//EXTMODE low, VCOM from the M1 bit
+	sim_counters_reset();
+	for(uint16_t i = 0; i < 8; i++)
+	{
+		hal_delayMs(GFX_VCOM_PERIOD_MS);
+		drawRows((uint16_t)(i * 8), (uint16_t)(i * 8 + 3));
+		if(i & 1)
+			GFXDisplayFlush();
+		else
+			flushAsyncAll(&lines);
+		CHECK(sim_vcom_age_ns() < 1000000ULL * GFX_VCOM_PERIOD_MS);	//inverted by the update itself
+		CHECK(sim_compare_framebuffer() == 0);
+	}
+	drawRows(H - 4, H - 1);
+	GFXDisplayFlush();
+	sim_get_counters(&c);
+	CHECK(c.vcomInversions >= 8 && c.displayModes == 0 && c.protocolErrors == 0 && sim_compare_framebuffer() == 0);
+	printf("\n%-28s inversions %u\n", "serial VCOM", c.vcomInversions);
+#endif
+	return true;
+}
+
+/**
+ * @brief	Scrolls of a region with drawing in and around it, flushed both ways
+ */
+static bool checkScroll(void)
+{
+	const uint16_t H = GFXDisplayGetLCDHeight();
+	uint16_t lines, transfers = 0;
+	SIM_COUNTERS c;
+
+	sim_counters_reset();
+	CHECK(GFXDisplaySetScrollRegion(H / 4, H / 2));
+	for(uint16_t i = 0; i < 20; i++)
+	{
+		GFXDisplayScroll((int16_t)((rand() % 31) - 15), (i & 1) ? WHITE : BLACK);
+		uint16_t y = (uint16_t)(rand() % (H - 8));
+		drawRows(y, (uint16_t)(y + 7));
+		drawRows((uint16_t)(H / 4 + rand() % (H / 2 - 4)), (uint16_t)(H / 4 + H / 2 - 1));
+		if(i & 1)
+			GFXDisplayFlush();
+		else
+			transfers = (uint16_t)(transfers + flushAsyncAll(&lines));
+		CHECK(sim_compare_framebuffer() == 0);
+	}
+	CHECK(GFXDisplaySetScrollRegion(0, 0));
+	drawRows(0, H - 1);
+	flushAsyncAll(&lines);
+	sim_get_counters(&c);
+	CHECK(lines == H && sim_compare_framebuffer() == 0 && c.protocolErrors == 0);
+	printf("\n%-28s transfers %u\n", "scroll region", transfers);
+	return true;
+}
+
+/**
+ * @brief	The same drawing on a banded display and on the full frame buffer: the panel shows the full frame buffer
+ */
+static bool checkBanded(void)
+{
+	static GFX_DISPLAY bandLcd;
+	static uint8_t band[GFX_FB_SIZE(DISP_HOR_RESOLUTION, 16)], list[2048], dirty[(GFX_FB_CANVAS_H + 7) / 8];
+	const uint16_t H = GFXDisplayGetLCDHeight(), W = GFXDisplayGetLCDWidth();
+	SIM_COUNTERS c;
+
+	GFXDisplayInitBanded(&bandLcd, &GFX_DISPLAY_DESC_DEFAULT, band, 16, list, sizeof(list), dirty, NULL);
+	for(uint16_t pass = 0; pass < 2; pass++)
+	{
+		GFXDisplaySelect(pass ? &lcd : &bandLcd);
+		if(pass == 0)
+		{
+			GFXDisplayAllClear();
+			GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+		}
+		GFXDisplayDrawRect(0, 0, W - 1, H - 1, WHITE);
+		GFXDisplayDrawRect(W / 4, H / 3, W / 2, H / 3 + 20, BLACK);
+		GFXDisplayFillCircle(W / 2, H / 2, H / 4, BLACK);
+		GFXDisplayLineDrawH(0, W - 1, H / 2, BLACK, 3);
+		if(pass == 0)
+		{
+			sim_counters_reset();
+			GFXDisplayFlush();
+			sim_get_counters(&c);
+			CHECK(c.protocolErrors == 0);
+		}
+	}
+	memset(lcdDirty, 0x00, sizeof(lcdDirty));		//already on the panel from the banded display
+	CHECK(sim_compare_framebuffer() == 0);
+	printf("%-28s tx %u, lines %u\n", "banded display", c.transactions, c.linesWritten);
+	return true;
+}
+
+int main(void)
+{
+	hal_bsp_init();
+	GFXDisplayInit(&lcd, &GFX_DISPLAY_DESC_DEFAULT, lcdBuffer, lcdDirty, NULL);
+	GFXDisplaySelect(&lcd);
+	GFXDisplayAllClear();
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+	srand(11);
+
+	printf("%s, %u lines, GFX_LINE_HEADERS %u, GFX_SCS_MAX_US %u\n\n", GFXDisplayGetDesc()->name, GFXDisplayGetLCDHeight(),
+		   (unsigned)GFX_LINE_HEADERS, (unsigned)GFX_SCS_MAX_US);
+	bool ok = benchFlush() && checkAsync() && checkVcom() && checkScroll() && checkBanded();
+	printf("%s\n", ok ? "ok" : "FAILED");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+/**
+ * @brief	Host microbenchmark of GFXDisplayPutImage() against the former per-pixel decoding.
+ *			The drawing functions run in GFX_FLUSH_DEFERRED mode on the host simulator HAL, so only the frame buffer work is timed.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/bench/bench_image.cpp extras/host/MemoryLCDSim.cpp src/MemoryLCD.cpp src/bfcFontMgr.c \
+ *				examples/HelloWorld/cat_400x246.c examples/HelloWorld_v2/qrcode_33x33.c examples/HelloWorld_v2/run_64x64.c \
+ *				-lstdc++ -o bench_image && ./bench_image
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+#include "bench_util.h"
+
+extern const tImage cat_400x246;
+extern const tImage qrcode_33x33;
+extern const tImage run_64x64;
+
+static uint8_t refBuffer[GFX_FB_CANVAS_H][GFX_FB_CANVAS_W];
+
+/**
+ * @brief	Per-pixel reference, the decoding GFXDisplayPutImage() did before the row blitter
+ */
+static void refPutImage(uint16_t left, uint16_t top, const tImage* image, bool invert)
+{
+	uint16_t bytesPerLine = (image->width+7)/8;
+
+	for(uint16_t y = 0; y < image->height; y++)
+	{
+		for(uint16_t x = 0; x < image->width; x++)
+		{
+			uint8_t pixel = image->data[y*bytesPerLine + x/8];
+			if(invert)
+				pixel ^= 0xff;
+			pixel = (uint8_t)(pixel << (x%8)) >> 7;
+
+			refPutPixel(refBuffer, left + x, top + y, (pixel == 1) ? WHITE : BLACK);
+		}
+	}
+}
+
+/**
+ * @brief	Blit images at random positions, partly off screen, with both paths and compare the frame buffers
+ */
+static bool checkAgainstReference(void)
+{
+	const tImage *images[] = { &cat_400x246, &qrcode_33x33, &run_64x64 };
+
+	memset(frameBuffer, 0x5A, sizeof(frameBuffer));
+	memset(refBuffer, 0x5A, sizeof(refBuffer));
+	srand(1);
+
+	for(int i = 0; i < 3000; i++)
+	{
+		const tImage *image = images[rand() % 3];
+		uint16_t left = rand() % (DISP_HOR_RESOLUTION + 8), top = rand() % (DISP_VER_RESOLUTION + 4);
+		bool invert = rand() % 2;
+
+		GFXDisplayPutImage(left, top, image, invert);
+		refPutImage(left, top, image, invert);
+
+		if(sim_compare_rows(&refBuffer[0][0]) != 0)
+		{
+			printf("Mismatch at image %d %ux%u at (%u,%u)\n", i, image->width, image->height, left, top);
+			return false;
+		}
+	}
+	return true;
+}
+
+static void bench(const char *label, const tImage *image, uint16_t left, uint16_t top, int repeat)
+{
+	double t0 = nowNs();
+	for(int i = 0; i < repeat; i++) refPutImage(left, top, image, i & 1);
+	double refNs = (nowNs() - t0) / repeat;
+
+	t0 = nowNs();
+	for(int i = 0; i < repeat; i++) GFXDisplayPutImage(left, top, image, i & 1);
+	double blitNs = (nowNs() - t0) / repeat;
+
+	printf("%-28s %12.0f %12.0f %7.1fx\n", label, refNs, blitNs, refNs/blitNs);
+}
+
+int main(void)
+{
+	hal_bsp_init();
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+
+	if(!checkAgainstReference())
+		return 1;
+
+	printf("%-28s %12s %12s %8s\n", "case", "per-pixel ns", "blit ns", "speedup");
+	bench("cat_400x246 at (0,0)", &cat_400x246, 0, 0, 500);
+	bench("cat_400x246 at (3,0)", &cat_400x246, 3, 0, 500);
+	bench("run_64x64 at (5,5)", &run_64x64, 5, 5, 20000);
+	bench("qrcode_33x33 at (8,5)", &qrcode_33x33, 8, 5, 20000);
+
+	return 0;
+}
@@ -0,0 +1,201 @@
+/**
+ * @brief	Host check and benchmark of the frame buffer row kernels of GFXRowKernels.h.
+ *			Every kernel runs with each word policy the compiler offers over all lengths up to 3 rows and all start offsets
+ *			of dst and src within a word, on random data, and has to give the same bytes and results as GFXRowBytes.
+ *			GFXRowNEON is checked on every host: with the intrinsics of <arm_neon.h> on ARM, with the lane by lane emulation
+ *			below elsewhere, so the policy is built and its logic tested even where no NEON compiler is at hand.
+ *			Times are reported per span for the row widths of the models, LS018B7DH02 rows (30 bytes) starting at every
+ *			offset as they do in its frame buffer, short spans of filled circles and a whole LS032B7DD02 frame buffer.
+ *			GCC turns the byte loops of fill and copy into memset() and memcpy() calls, so their bytes column is the C library.
+ * @note	Build and run from the library folder on a Linux/macOS host, -mavx2 adds the AVX2 policy:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/bench/bench_kernels.cpp -lstdc++ -o bench_kernels && ./bench_kernels<br>
+ *			The drawing functions use the policy of GFX_ROW_KERNEL, bench_api.cpp built with -DGFX_ROW_KERNEL=0, 1 and 2
+ *			shows what it does for each API call.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#if !defined (__ARM_NEON) && !defined (__ARM_NEON__)
+//NEON intrinsics used by GFXRowNEON, emulated one lane at a time
+typedef struct { uint8_t lane[16]; } uint8x16_t;
+typedef struct { uint64_t lane[2]; } uint64x2_t;
+
+static inline uint8x16_t vld1q_u8(const uint8_t *p)				{ uint8x16_t w; memcpy(w.lane, p, 16); return w; }
+static inline void vst1q_u8(uint8_t *p, uint8x16_t w)			{ memcpy(p, w.lane, 16); }
+static inline uint8x16_t vdupq_n_u8(uint8_t b)					{ uint8x16_t w; memset(w.lane, b, 16); return w; }
+static inline uint8x16_t vorrq_u8(uint8x16_t a, uint8x16_t b)	{ for(int i = 0; i < 16; i++) a.lane[i] |= b.lane[i]; return a; }
+static inline uint8x16_t vandq_u8(uint8x16_t a, uint8x16_t b)	{ for(int i = 0; i < 16; i++) a.lane[i] &= b.lane[i]; return a; }
+static inline uint8x16_t veorq_u8(uint8x16_t a, uint8x16_t b)	{ for(int i = 0; i < 16; i++) a.lane[i] ^= b.lane[i]; return a; }
+static inline uint64x2_t vreinterpretq_u64_u8(uint8x16_t w)		{ uint64x2_t r; memcpy(r.lane, w.lane, 16); return r; }
+#define vgetq_lane_u64(w, n)	((w).lane[(n)])
+#define GFX_ROW_HAS_NEON		1
+#define NEON_NAME				"GFXRowNEON (emulated)"
+#else
+#define NEON_NAME				"GFXRowNEON"
+#endif
+
+#include "GFXRowKernels.h"
+#include "bench_util.h"
+
+#define BUF_SIZE	(22512 + 64)		//LS032B7DD02 frame buffer and room for offsets
+
+static uint8_t refDst[BUF_SIZE], dst[BUF_SIZE], src[BUF_SIZE];
+static volatile uint32_t sink;			//keeps results of timed calls alive
+
+static void randomize(uint8_t *buf, uint32_t len)
+{
+	for(uint32_t i = 0; i < len; i++)
+		buf[i] = (uint8_t)rand();
+}
+
+/**
+ * @brief	Kernels of policy K against GFXRowBytes for every length and offset
+ */
+template <class K>
+static bool check(const char *name)
+{
+	bool ok = true;
+
+	for(uint32_t len = 0; (len <= 150) && ok; len++)
+	{
+		for(uint32_t d = 0; (d < 8) && ok; d++)
+		{
+			for(uint32_t s = 0; (s < 8) && ok; s++)
+			{
+				randomize(src, 200);
+				randomize(refDst, 200);
+				for(int op = 0; op < 9; op++)
+				{
+					uint8_t fill = (op & 1) ? 0xFF : (uint8_t)rand();
+					bool refResult = false, result = false;
+
+					memcpy(dst, refDst, 200);
+					if((op == 7) && len)		//equal spans differing in one byte
+						dst[d + rand() % len] ^= 0x10;
+					uint8_t saved[200];
+					memcpy(saved, refDst, 200);
+					switch(op)
+					{
+					case 0: GFXRowFill<GFXRowBytes>(refDst + d, fill, len); GFXRowFill<K>(dst + d, fill, len); break;
+					case 1: refResult = GFXRowFillChanged<GFXRowBytes>(refDst + d, fill, len); result = GFXRowFillChanged<K>(dst + d, fill, len); break;
+					case 2: GFXRowInvert<GFXRowBytes>(refDst + d, len); GFXRowInvert<K>(dst + d, len); break;
+					case 3: GFXRowCopy<GFXRowBytes>(refDst + d, src + 100 + s, len); GFXRowCopy<K>(dst + d, src + 100 + s, len); break;
+					case 4: GFXRowOr<GFXRowBytes>(refDst + d, src + 100 + s, len); GFXRowOr<K>(dst + d, src + 100 + s, len); break;
+					case 5: GFXRowAnd<GFXRowBytes>(refDst + d, src + 100 + s, len); GFXRowAnd<K>(dst + d, src + 100 + s, len); break;
+					case 6: GFXRowXor<GFXRowBytes>(refDst + d, src + 100 + s, len); GFXRowXor<K>(dst + d, src + 100 + s, len); break;
+					case 8: GFXRowAndXor<GFXRowBytes>(refDst + d, fill, src[s], len); GFXRowAndXor<K>(dst + d, fill, src[s], len); break;
+					case 7:
+						memcpy(dst, saved, 200);
+						refResult = GFXRowEqual<GFXRowBytes>(refDst + d, saved + d, len) && GFXRowEqual<GFXRowBytes>(refDst + d, src + 100 + s, len);
+						result = GFXRowEqual<K>(refDst + d, dst + d, len) && GFXRowEqual<K>(refDst + d, src + 100 + s, len);
+						if(len)		//a difference in any byte is found
+						{
+							uint32_t at = rand() % len;
+							dst[d + at] ^= 0x01;
+							ok &= !GFXRowEqual<K>(refDst + d, dst + d, len);
+							dst[d + at] ^= 0x01;
+						}
+						break;
+					}
+					if((memcmp(dst, refDst, 200) != 0) || (result != refResult))
+					{
+						printf("%s: kernel %d differs at length %u, offsets %u/%u\n", name, op, len, d, s);
+						ok = false;
+					}
+				}
+			}
+		}
+	}
+	return ok;
+}
+
+typedef struct
+{
+	const char	*name;
+	uint32_t	len;		//bytes per span
+	uint32_t	stride;		//distance of the spans, the row width
+	uint32_t	spans;		//spans per call
+} SPAN_CASE;
+
+static const SPAN_CASE cases[] =
+{
+	{"circle spans 4B",		4,		50,		240},
+	{"LS013 row 16B",		16,		16,		128},
+	{"LS018 row 30B",		30,		30,		303},
+	{"LS032 row 42B",		42,		42,		536},
+	{"LS027 row 50B",		50,		50,		240},
+	{"LS032 frame 22512B",	22512,	22512,	1},
+};
+
+static const char *kernelNames[] = {"fill", "fill changed", "invert", "copy", "xor", "equal", "and-xor"};
+#define KERNELS	(sizeof(kernelNames) / sizeof(kernelNames[0]))
+
+/**
+ * @return	ns per span of kernel op with policy K
+ */
+template <class K>
+static double timeKernel(uint16_t op, const SPAN_CASE *pCase)
+{
+	const uint32_t repeat = 2000000 / (pCase->stride * pCase->spans) + 1;
+	uint32_t acc = 0;
+
+	memcpy(dst, src, BUF_SIZE);		//equal spans are compared to the end
+	double t0 = nowNs();
+	for(uint32_t r = 0; r < repeat; r++)
+	{
+		uint8_t *d = dst;
+		const uint8_t *s = src;
+
+		for(uint32_t i = 0; i < pCase->spans; i++, d += pCase->stride, s += pCase->stride)
+		{
+			switch(op)
+			{
+			case 0: GFXRowFill<K>(d, (uint8_t)r, pCase->len); break;
+			case 1: acc += GFXRowFillChanged<K>(d, (uint8_t)r, pCase->len); break;
+			case 2: GFXRowInvert<K>(d, pCase->len); break;
+			case 3: GFXRowCopy<K>(d, s, pCase->len); break;
+			case 4: GFXRowXor<K>(d, s, pCase->len); break;
+			case 5: acc += GFXRowEqual<K>(d, s, pCase->len); break;
+			case 6: GFXRowAndXor<K>(d, (uint8_t)r, 0x5A, pCase->len); break;
+			}
+		}
+	}
+	double ns = (nowNs() - t0) / repeat / pCase->spans;
+	sink = acc + dst[0];
+	return ns;
+}
+
+int main(void)
+{
+	bool ok = true;
+
+	srand(1);
+	randomize(src, BUF_SIZE);
+	ok &= check<GFXRowWords>("GFXRowWords");
+#if defined (__SSE2__)
+	ok &= check<GFXRowSSE2>("GFXRowSSE2");
+#endif
+#if defined (__AVX2__)
+	ok &= check<GFXRowAVX2>("GFXRowAVX2");
+#endif
+	ok &= check<GFXRowNEON>(NEON_NAME);
+
+	printf("ns per span          kernel          bytes    words  vectors  words x  vectors x\n");
+	for(uint16_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++)
+	{
+		for(uint16_t op = 0; op < KERNELS; op++)
+		{
+			double bytes = timeKernel<GFXRowBytes>(op, &cases[c]);
+			double words = timeKernel<GFXRowWords>(op, &cases[c]);
+			double vectors = timeKernel<GFXRowVectors>(op, &cases[c]);
+			printf("%-20s %-12s %8.1f %8.1f %8.1f %7.1fx %9.1fx\n", op ? "" : cases[c].name, kernelNames[op], bytes, words, vectors,
+				bytes / words, bytes / vectors);
+		}
+	}
+
+	printf("%s\n", ok ? "ok" : "FAILED");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,165 @@
+/**
+ * @brief	Host check and benchmark of TIMAGE_RLE images against the raw images of the examples.
+ *			Every image is compressed with the encoder of extras/host/image_rle.cpp and drawn raw and compressed at random
+ *			positions, partly off screen and inverted, into frame buffers that have to match; the compressed QR code of
+ *			HelloWorld_v2 has to match the encoder output and is drawn on banded displays too. Flash size and
+ *			GFXDisplayPutImage() time in GFX_FLUSH_DEFERRED mode are reported per image.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/bench/bench_rle.cpp extras/host/ImageRLE.cpp extras/host/MemoryLCDSim.cpp src/MemoryLCD.cpp \
+ *				src/bfcFontMgr.c examples/HelloWorld/cat_400x246.c examples/HelloWorld/qr_code_248x248.c \
+ *				examples/HelloWorld_v2/qr_code_248x248_rle.c examples/HelloWorld_v2/qrcode_33x33.c examples/HelloWorld_v2/run_64x64.c \
+ *				examples/BloodPressure_GUI/IoT_message.c examples/BloodPressure_GUI/arrowUp_89x48.c -lstdc++ -o bench_rle && ./bench_rle
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+#include "bench_util.h"
+#include "ImageRLE.h"
+
+extern const tImage cat_400x246;
+extern const tImage qr_code_248x248;
+extern const tImage qr_code_248x248_rle;
+extern const tImage qrcode_33x33;
+extern const tImage run_64x64;
+extern const tImage IoT_message;
+extern const tImage arrowUp_89x48;
+
+static const struct
+{
+	const char		*name;
+	const tImage	*image;
+} images[] =
+{
+	{"cat_400x246",		&cat_400x246},
+	{"qr_code_248x248",	&qr_code_248x248},
+	{"IoT_message",		&IoT_message},
+	{"arrowUp_89x48",	&arrowUp_89x48},
+	{"run_64x64",		&run_64x64},
+	{"qrcode_33x33",	&qrcode_33x33},
+};
+#define IMAGES	(sizeof(images) / sizeof(images[0]))
+
+static tImage rleImages[IMAGES];
+static GFX_DISPLAY lcd;		//full frame buffer in every build, GFX_BAND_LINES included
+static uint8_t lcdBuffer[GFX_FB_SIZE(DISP_HOR_RESOLUTION, GFX_FB_CANVAS_H)], lcdDirty[(GFX_FB_CANVAS_H + 7) / 8];
+static uint8_t refBuffer[GFX_FB_SIZE(DISP_HOR_RESOLUTION, GFX_FB_CANVAS_H)], prevBuffer[GFX_FB_SIZE(DISP_HOR_RESOLUTION, GFX_FB_CANVAS_H)];
+
+/**
+ * @brief	Draw raw and compressed images at random positions and compare the frame buffers after each one
+ */
+static bool checkAgainstRaw(void)
+{
+	memset(lcdBuffer, 0x5A, sizeof(lcdBuffer));
+	srand(1);
+
+	for(int i = 0; i < 3000; i++)
+	{
+		uint16_t n = rand() % IMAGES;
+		uint16_t left = rand() % (GFXDisplayGetLCDWidth() + 8), top = rand() % (GFXDisplayGetLCDHeight() + 4);
+		bool invert = rand() % 2;
+
+		memcpy(prevBuffer, lcdBuffer, sizeof(prevBuffer));
+		GFXDisplayPutImage(left, top, images[n].image, invert);
+		memcpy(refBuffer, lcdBuffer, sizeof(refBuffer));
+
+		memcpy(lcdBuffer, prevBuffer, sizeof(prevBuffer));	//compressed image drawn over the same pixels
+		GFXDisplayPutImage(left, top, &rleImages[n], invert);
+
+		if(memcmp(lcdBuffer, refBuffer, sizeof(lcdBuffer)) != 0)
+		{
+			printf("Mismatch at image %d %s at (%u,%u)\n", i, images[n].name, left, top);
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief	The compressed QR code of the examples on banded displays, each band starts in the middle of the image
+ */
+static bool checkBanded(void)
+{
+	static GFX_DISPLAY refLcd, bandLcd;
+	static uint8_t band[GFX_FB_SIZE(DISP_HOR_RESOLUTION, 64)], list[512], dirty[(GFX_FB_CANVAS_H + 7) / 8], refDirty[(GFX_FB_CANVAS_H + 7) / 8];
+	const uint16_t bands[] = {1, 7, 64};
+	bool ok = true;
+
+	memset(refBuffer, 0xFF, sizeof(refBuffer));
+	GFXDisplayInit(&refLcd, &GFX_DISPLAY_DESC_DEFAULT, refBuffer, refDirty, NULL);
+	GFXDisplaySelect(&refLcd);
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+	GFXDisplayPutImage(13, 3, &qr_code_248x248, true);
+
+	for(uint16_t i = 0; i < sizeof(bands) / sizeof(bands[0]); i++)
+	{
+		GFXDisplayInitBanded(&bandLcd, &GFX_DISPLAY_DESC_DEFAULT, band, bands[i], list, sizeof(list), dirty, NULL);
+		GFXDisplaySelect(&bandLcd);
+		GFXDisplayAllClear();
+		GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+		GFXDisplayPutImage(13, 3, &qr_code_248x248_rle, true);
+		GFXDisplayFlush();
+
+		ok &= panelShows(&refLcd, &bandLcd);
+	}
+	GFXDisplaySelect(&lcd);
+	return ok;
+}
+
+static double timePutImage(const tImage *image, uint16_t left, uint16_t top, int repeat)
+{
+	double t0 = nowNs();
+	for(int i = 0; i < repeat; i++)
+		GFXDisplayPutImage(left, top, image, i & 1);
+	return (nowNs() - t0) / repeat;
+}
+
+int main(void)
+{
+	bool ok = true;
+	size_t rawTotal = 0, rleTotal = 0;
+
+	hal_bsp_init();
+	GFXDisplayInit(&lcd, &GFX_DISPLAY_DESC_DEFAULT, lcdBuffer, lcdDirty, NULL);
+	GFXDisplaySelect(&lcd);
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+
+	for(uint16_t n = 0; n < IMAGES; n++)
+	{
+		const tImage *image = images[n].image;
+		uint8_t *data = (uint8_t *)malloc(IMAGE_RLE_MAX_SIZE(image->width, image->height));
+
+		image_rle_encode(image->data, image->width, image->height, data);
+		rleImages[n] = *image;
+		rleImages[n].data = data;
+		rleImages[n].compression = TIMAGE_RLE;
+	}
+
+	//the asset in HelloWorld_v2 is what the converter writes
+	size_t qrSize = image_rle_size(qr_code_248x248_rle.data, 248, 248);
+	ok &= (qrSize != 0) && (memcmp(qr_code_248x248_rle.data, rleImages[1].data, qrSize) == 0);
+
+	ok &= checkAgainstRaw();
+	ok &= checkBanded();
+
+	printf("%-16s %8s %8s %7s %10s %10s %10s %10s\n", "image", "raw B", "rle B", "ratio", "raw ns", "rle ns", "raw+3 ns", "rle+3 ns");
+	for(uint16_t n = 0; n < IMAGES; n++)
+	{
+		const tImage *image = images[n].image;
+		size_t raw = (size_t)(image->width + 7) / 8 * image->height;
+		size_t rle = image_rle_size(rleImages[n].data, image->width, image->height);
+		int repeat = (int)(4000000 / raw);
+
+		ok &= (rle != 0);
+		rawTotal += raw;
+		rleTotal += MIN(rle, raw);		//an image that does not compress stays raw
+		printf("%-16s %8u %8u %6.1f%% %10.0f %10.0f %10.0f %10.0f\n", images[n].name, (unsigned)raw, (unsigned)rle, 100.0 * rle / raw,
+			timePutImage(image, 0, 0, repeat), timePutImage(&rleImages[n], 0, 0, repeat),
+			timePutImage(image, 3, 0, repeat), timePutImage(&rleImages[n], 3, 0, repeat));
+	}
+	printf("flash of these images: %u bytes raw, %u bytes with TIMAGE_RLE where smaller\n", (unsigned)rawTotal, (unsigned)rleTotal);
+
+	printf("%s\n", ok ? "ok" : "FAILED");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,368 @@
+/**
+ * @brief	Host check and benchmark of the raster ops of GFXDisplaySetRasterOp().
+ *			Rectangles, lines, pixels, raw and TIMAGE_RLE images, text and a glyph wide enough for the row kernels are drawn with every op at random positions, partly
+ *			off screen, over random frame buffer content. Each result has to match the op applied to the source and the pixels
+ *			covered, both found by drawing the same call with GFX_ROP_SET over a black and a white frame buffer; circles have to
+ *			draw as with GFX_ROP_SET. A banded display draws a screen with every op and has to send what a full frame buffer
+ *			holds. Highlighting a menu row with GFX_ROP_NOT is timed against drawing the row again in inverted colors.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/bench/bench_rop.cpp extras/host/ImageRLE.cpp extras/host/MemoryLCDSim.cpp src/MemoryLCD.cpp \
+ *				src/bfcFontMgr.c examples/BloodPressure_GUI/Consolas24h.c examples/BloodPressure_GUI/arrowUp_89x48.c \
+ *				examples/BloodPressure_GUI/IoT_message.c -lstdc++ -o bench_rop && ./bench_rop
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+#include "bench_util.h"
+#include "ImageRLE.h"
+
+extern const BFC_FONT fontConsolas24h;
+extern const tImage arrowUp_89x48;
+extern const tImage IoT_message;
+
+#define FB_SIZE		GFX_FB_SIZE(DISP_HOR_RESOLUTION, GFX_FB_CANVAS_H)
+
+static const char *ropNames[] = {"SET", "CLEAR", "XOR", "OR", "AND", "NOT"};
+#define ROPS		(sizeof(ropNames) / sizeof(ropNames[0]))
+
+enum
+{
+	CALL_RECT = 0,
+	CALL_LINE_H,
+	CALL_LINE_V,
+	CALL_LINE,
+	CALL_PIXEL,
+	CALL_IMAGE,
+	CALL_IMAGE_RLE,
+	CALL_TEXT,
+	CALL_GLYPH,
+	CALL_CIRCLE,
+	CALLS
+};
+static const char *callNames[CALLS] = {"DrawRect", "LineDrawH", "LineDrawV", "DrawLine", "PutPixel", "PutImage", "PutImage RLE",
+									   "PutString", "PutChar wide", "FillCircle"};
+
+typedef struct
+{
+	uint8_t		kind;
+	uint16_t	x1, y1, x2, y2;
+	COLOR		color, bg;
+	bool		invert;
+	const tImage *image;
+} CALL;
+
+static GFX_DISPLAY lcd;		//full frame buffer in every build, GFX_BAND_LINES included
+static uint8_t lcdBuffer[FB_SIZE], lcdDirty[(GFX_FB_CANVAS_H + 7) / 8];
+static uint8_t prevBuffer[FB_SIZE], blackBuffer[FB_SIZE], whiteBuffer[FB_SIZE], refBuffer[FB_SIZE];
+static tImage rleImage;
+
+#define WIDE_WIDTH		100		//13 bytes a row, more than GFXDisplayGlyph_FB() merges byte by byte
+#define WIDE_HEIGHT		21
+static BFC_CHARINFO wideInfo[2];
+static BFC_FONT_PROP wideProp[2];
+static BFC_FONT wideFont[2];		//'W' only, BFC_LITTLE_ENDIAN and big endian
+
+/**
+ * @brief	Fonts of one random glyph WIDE_WIDTH pixels wide, the same pixels in both bit orders
+ */
+static void makeWideFonts(void)
+{
+	const uint16_t bytesPerLine = (WIDE_WIDTH + 7) / 8;
+	static uint8_t data[2][bytesPerLine * WIDE_HEIGHT];
+
+	srand(7);
+	for(uint16_t j = 0; j < sizeof(data[0]); j++)
+	{
+		uint8_t b = (uint8_t)rand(), r = 0;
+		for(int k = 0; k < 8; k++)
+			r |= ((b >> k) & 0x01) << (7 - k);
+		data[0][j] = b;
+		data[1][j] = r;
+	}
+	for(int e = 0; e < 2; e++)
+	{
+		wideInfo[e].Width = WIDE_WIDTH;
+		wideInfo[e].DataSize = sizeof(data[e]);
+		wideInfo[e].p.pData8 = data[e];
+		wideProp[e].FirstChar = wideProp[e].LastChar = 'W';
+		wideProp[e].pFirstCharInfo = &wideInfo[e];
+		wideProp[e].pNextProp = 0;
+		wideFont[e] = fontConsolas24h;
+		wideFont[e].FontType = (e == 0) ? fontConsolas24h.FontType : (fontConsolas24h.FontType & ~BFC_LITTLE_ENDIAN);
+		wideFont[e].FontHeight = WIDE_HEIGHT;
+		wideFont[e].p.pProp = &wideProp[e];
+	}
+}
+
+static void draw(const CALL *pCall)
+{
+	switch(pCall->kind)
+	{
+	case CALL_RECT:			GFXDisplayDrawRect(pCall->x1, pCall->y1, pCall->x2, pCall->y2, pCall->color); break;
+	case CALL_LINE_H:		GFXDisplayLineDrawH(pCall->x1, pCall->x2, pCall->y1, pCall->color, (uint8_t)(pCall->y2 % 5 + 1)); break;
+	case CALL_LINE_V:		GFXDisplayLineDrawV(pCall->x1, pCall->y1, pCall->y2, pCall->color, (uint8_t)(pCall->x2 % 5 + 1)); break;
+	case CALL_LINE:			GFXDisplayDrawLine(pCall->x1, pCall->y1, pCall->x2, pCall->y2, pCall->color); break;
+	case CALL_PIXEL:		GFXDisplayPutPixel(pCall->x1, pCall->y1, pCall->color); break;
+	case CALL_IMAGE:
+	case CALL_IMAGE_RLE:	GFXDisplayPutImage(pCall->x1, pCall->y1, pCall->image, pCall->invert); break;
+	case CALL_TEXT:			GFXDisplayPutString(pCall->x1, pCall->y1, &fontConsolas24h, "Menu 42", pCall->color, pCall->bg); break;
+	case CALL_GLYPH:		GFXDisplayPutChar(pCall->x1, pCall->y1, &wideFont[pCall->invert], 'W', pCall->color, pCall->bg); break;
+	case CALL_CIRCLE:		GFXDisplayFillCircle(pCall->x1, pCall->y1, (uint16_t)(pCall->x2 % 40), pCall->color); break;
+	}
+}
+
+/**
+ * @brief	The wide glyph of a CALL_GLYPH drawn pixel by pixel with GFX_ROP_SET, the reference its GFX_ROP_SET draws are held to
+ */
+static void refWideGlyph(const CALL *pCall)
+{
+	const BFC_CHARINFO *pInfo = &wideInfo[0];		//little endian, the pixels of both fonts
+	const uint16_t bytesPerLine = (WIDE_WIDTH + 7) / 8;
+
+	for(uint16_t y = 0; y < WIDE_HEIGHT; y++)
+		for(uint16_t x = 0; x < WIDE_WIDTH; x++)
+		{
+			bool stroke = (pInfo->p.pData8[y*bytesPerLine + (x >> 3)] >> (x & 0x07)) & 0x01;
+			if(stroke || (pCall->bg != TRANSPARENT))
+				GFXDisplayPutPixel(pCall->x1 + x, pCall->y1 + y, stroke ? pCall->color : pCall->bg);
+		}
+}
+
+/**
+ * @return	frame buffer byte of raster op rop over dst, for the source bits src of the pixels mask
+ */
+static uint8_t refRop(uint16_t rop, uint8_t dst, uint8_t src, uint8_t mask)
+{
+	uint8_t out;
+
+	switch(rop)
+	{
+	case GFX_ROP_SET:	out = src; break;
+	case GFX_ROP_CLEAR:	out = 0xFF; break;
+	case GFX_ROP_XOR:	out = dst ^ src; break;
+	case GFX_ROP_OR:	out = dst | src; break;
+	case GFX_ROP_AND:	out = dst & src; break;
+	default:			out = (uint8_t)~dst; break;
+	}
+	return (uint8_t)((dst & ~mask) | (out & mask));
+}
+
+/**
+ * @brief	Every call with every op at random positions against the op applied byte by byte
+ */
+static bool checkOps(void)
+{
+	const uint16_t W = GFXDisplayGetLCDWidth(), H = GFXDisplayGetLCDHeight();
+
+	srand(1);
+	for(int i = 0; i < 6000; i++)
+	{
+		CALL call;
+		call.kind   = (uint8_t)(i % CALLS);
+		call.x1     = (uint16_t)(rand() % (W + 16));
+		call.y1     = (uint16_t)(rand() % (H + 8));
+		call.x2     = (uint16_t)(rand() % (W + 16));
+		call.y2     = (uint16_t)(rand() % (H + 8));
+		call.color  = (rand() & 1) ? WHITE : BLACK;
+		call.bg     = (COLOR)(rand() % 3);
+		call.invert = rand() & 1;
+		call.image  = (call.kind == CALL_IMAGE_RLE) ? &rleImage : ((rand() & 1) ? &arrowUp_89x48 : &IoT_message);
+
+		for(uint16_t b = 0; b < FB_SIZE; b++)
+			prevBuffer[b] = (uint8_t)rand();
+
+		GFXDisplaySetRasterOp(GFX_ROP_SET);		//source and pixels covered
+		memset(lcdBuffer, 0x00, FB_SIZE);
+		draw(&call);
+		memcpy(blackBuffer, lcdBuffer, FB_SIZE);
+		memset(lcdBuffer, 0xFF, FB_SIZE);
+		draw(&call);
+		memcpy(whiteBuffer, lcdBuffer, FB_SIZE);
+
+		if(call.kind == CALL_GLYPH)		//the source itself, the ops below only compare against the same code
+		{
+			bool same = true;
+			memset(lcdBuffer, 0x00, FB_SIZE);
+			refWideGlyph(&call);
+			same &= (memcmp(lcdBuffer, blackBuffer, FB_SIZE) == 0);
+			memset(lcdBuffer, 0xFF, FB_SIZE);
+			refWideGlyph(&call);
+			same &= (memcmp(lcdBuffer, whiteBuffer, FB_SIZE) == 0);
+			if(!same)
+			{
+				printf("%s differs from the glyph pixels, call %d at (%u,%u)\n", callNames[call.kind], i, call.x1, call.y1);
+				return false;
+			}
+		}
+
+		for(uint16_t rop = 0; rop < ROPS; rop++)
+		{
+			uint16_t refOp = (call.kind == CALL_CIRCLE) ? (uint16_t)GFX_ROP_SET : rop;
+
+			for(uint32_t b = 0; b < FB_SIZE; b++)
+			{
+				uint8_t mask = (uint8_t)~(blackBuffer[b] ^ whiteBuffer[b]);
+				refBuffer[b] = refRop(refOp, prevBuffer[b], whiteBuffer[b] & mask, mask);
+			}
+
+			memcpy(lcdBuffer, prevBuffer, FB_SIZE);
+			GFXDisplaySetRasterOp((GFX_ROP)rop);
+			draw(&call);
+			if(memcmp(lcdBuffer, refBuffer, FB_SIZE) != 0)
+			{
+				printf("%s with GFX_ROP_%s differs, call %d at (%u,%u)-(%u,%u)\n", callNames[call.kind], ropNames[rop], i,
+					call.x1, call.y1, call.x2, call.y2);
+				GFXDisplaySetRasterOp(GFX_ROP_SET);
+				return false;
+			}
+		}
+	}
+	GFXDisplaySetRasterOp(GFX_ROP_SET);
+	return true;
+}
+
+/**
+ * @brief	A screen drawn with every op on a full frame buffer, the frame buffer stays as the reference
+ */
+static void drawScreen(void)
+{
+	GFXDisplaySetRasterOp(GFX_ROP_SET);
+	GFXDisplayPutImage(10, 10, &arrowUp_89x48, false);
+	GFXDisplayPutString(20, 70, &fontConsolas24h, "Settings", BLACK, WHITE);
+	GFXDisplayPutImage(5, 100, &rleImage, false);
+	GFXDisplaySetRasterOp(GFX_ROP_NOT);
+	GFXDisplayDrawRect(0, 68, 119, 95, BLACK);			//highlight over the text, keeps the entries below
+	GFXDisplaySetRasterOp(GFX_ROP_XOR);
+	GFXDisplayDrawLine(0, 0, 120, 120, WHITE);
+	GFXDisplayPutImage(40, 30, &arrowUp_89x48, true);
+	GFXDisplayFillCircle(60, 60, 20, BLACK);			//drawn with GFX_ROP_SET
+	GFXDisplaySetRasterOp(GFX_ROP_OR);
+	GFXDisplayPutString(30, 20, &fontConsolas24h, "OR", WHITE, BLACK);
+	GFXDisplaySetRasterOp(GFX_ROP_AND);
+	GFXDisplayPutString(50, 105, &fontConsolas24h, "AND", BLACK, TRANSPARENT);
+	GFXDisplayLineDrawV(100, 0, 127, BLACK, 3);
+	GFXDisplaySetRasterOp(GFX_ROP_CLEAR);
+	GFXDisplayDrawRect(90, 5, 110, 15, BLACK);
+	GFXDisplaySetRasterOp(GFX_ROP_SET);
+}
+
+/**
+ * @brief	The screen on banded displays of a few band heights has to reach the panel as the full frame buffer holds it
+ */
+static bool checkBanded(void)
+{
+	static GFX_DISPLAY refLcd, bandLcd;
+	static uint8_t band[GFX_FB_SIZE(DISP_HOR_RESOLUTION, 64)], list[2048], dirty[(GFX_FB_CANVAS_H + 7) / 8], refDirty[(GFX_FB_CANVAS_H + 7) / 8];
+	const uint16_t bands[] = {1, 7, 16, 64};
+	bool ok = true;
+
+	memset(refBuffer, 0xFF, sizeof(refBuffer));
+	GFXDisplayInit(&refLcd, &GFX_DISPLAY_DESC_DEFAULT, refBuffer, refDirty, NULL);
+	GFXDisplaySelect(&refLcd);
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+	drawScreen();
+
+	for(uint16_t i = 0; i < sizeof(bands) / sizeof(bands[0]); i++)
+	{
+		uint16_t dropped;
+
+		GFXDisplayInitBanded(&bandLcd, &GFX_DISPLAY_DESC_DEFAULT, band, bands[i], list, sizeof(list), dirty, NULL);
+		GFXDisplaySelect(&bandLcd);
+		GFXDisplayAllClear();
+		GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+		drawScreen();
+		GFXDisplayFlush();
+		GFXDisplayGetBandListUsed(&dropped);
+
+		if(!panelShows(&refLcd, &bandLcd) || dropped)
+		{
+			printf("banded display of %u lines differs\n", bands[i]);
+			ok = false;
+		}
+	}
+	GFXDisplaySelect(&lcd);
+	return ok;
+}
+
+/**
+ * @brief	A menu row highlighted and restored with GFX_ROP_NOT against drawing it again inverted and back
+ */
+static bool compareHighlight(void)
+{
+	const uint16_t W = GFXDisplayGetLCDWidth(), rowH = GFXDisplayGetFontHeight(&fontConsolas24h);
+	const uint16_t rows = MIN(GFXDisplayGetLCDHeight() / rowH, 8);
+	const char *items[8] = {"Measure", "History", "Alarms", "Units", "Bluetooth", "Display", "Battery", "About"};
+	const uint16_t top = rowH;			//second row
+	const int repeat = 20000;
+	SIM_COUNTERS c;
+	bool ok = true;
+
+	memset(lcdBuffer, 0xFF, FB_SIZE);
+	for(uint16_t r = 0; r < rows; r++)
+		GFXDisplayPutString(4, (uint16_t)(r * rowH), &fontConsolas24h, items[r], BLACK, TRANSPARENT);
+	GFXDisplayFlush();
+
+	GFXDisplaySetRasterOp(GFX_ROP_NOT);		//the same frame buffer both ways
+	GFXDisplayDrawRect(0, top, W - 1, top + rowH - 1, BLACK);
+	memcpy(refBuffer, lcdBuffer, FB_SIZE);
+	GFXDisplayDrawRect(0, top, W - 1, top + rowH - 1, BLACK);
+	GFXDisplaySetRasterOp(GFX_ROP_SET);
+	GFXDisplayDrawRect(0, top, W - 1, top + rowH - 1, BLACK);
+	GFXDisplayPutString(4, top, &fontConsolas24h, items[1], WHITE, TRANSPARENT);
+	ok &= (memcmp(lcdBuffer, refBuffer, FB_SIZE) == 0);
+	GFXDisplayDrawRect(0, top, W - 1, top + rowH - 1, WHITE);
+	GFXDisplayPutString(4, top, &fontConsolas24h, items[1], BLACK, TRANSPARENT);
+	GFXDisplayFlush();
+
+	double t0 = nowNs();
+	for(int i = 0; i < repeat; i++)
+	{
+		GFXDisplayDrawRect(0, top, W - 1, top + rowH - 1, (i & 1) ? WHITE : BLACK);
+		GFXDisplayPutString(4, top, &fontConsolas24h, items[1], (i & 1) ? BLACK : WHITE, TRANSPARENT);
+	}
+	double redrawNs = (nowNs() - t0) / repeat;
+
+	GFXDisplaySetRasterOp(GFX_ROP_NOT);
+	t0 = nowNs();
+	for(int i = 0; i < repeat; i++)
+		GFXDisplayDrawRect(0, top, W - 1, top + rowH - 1, BLACK);
+	double ropNs = (nowNs() - t0) / repeat;
+
+	sim_counters_reset();
+	GFXDisplayDrawRect(0, top, W - 1, top + rowH - 1, BLACK);
+	GFXDisplayFlush();
+	sim_get_counters(&c);
+	GFXDisplaySetRasterOp(GFX_ROP_SET);
+	ok &= (c.linesWritten == rowH) && (c.transactions == 1);
+
+	printf("menu row highlight, %u x %u pixels        ns   lines  transactions\n", W, rowH);
+	printf("%-36s %8.0f\n", "redraw inverted (rect + string)", redrawNs);
+	printf("%-36s %8.0f %7u %13u\n", "GFX_ROP_NOT rect", ropNs, c.linesWritten, c.transactions);
+	return ok;
+}
+
+int main(void)
+{
+	bool ok = true;
+	uint8_t *data = (uint8_t *)malloc(IMAGE_RLE_MAX_SIZE(arrowUp_89x48.width, arrowUp_89x48.height));
+
+	hal_bsp_init();
+	GFXDisplayInit(&lcd, &GFX_DISPLAY_DESC_DEFAULT, lcdBuffer, lcdDirty, NULL);
+	GFXDisplaySelect(&lcd);
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+
+	image_rle_encode(arrowUp_89x48.data, arrowUp_89x48.width, arrowUp_89x48.height, data);	//has 0x80 rows
+	rleImage = arrowUp_89x48;
+	rleImage.data = data;
+	rleImage.compression = TIMAGE_RLE;
+	makeWideFonts();
+
+	ok &= checkOps();
+	ok &= checkBanded();
+	ok &= compareHighlight();
+
+	printf("%s\n", ok ? "ok" : "FAILED");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,275 @@
+/**
+ * @brief	Host check and benchmark of the scroll region of GFXDisplaySetScrollRegion() and GFXDisplayScroll().
+ *			Rectangles, lines, pixels, raw and TIMAGE_RLE images, text and circles are drawn at random positions between
+ *			scrolls of random regions, up and down, filled or wrapped around, in immediate and deferred flush mode. Every
+ *			row of the display has to match a reference display whose rows are moved with memmove(), and the panel has
+ *			to show the same. A log region is timed scrolling by a text line against moving its rows with memmove(), and
+ *			drawing is timed with and without a region across the screen.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/bench/bench_scroll.cpp extras/host/ImageRLE.cpp extras/host/MemoryLCDSim.cpp src/MemoryLCD.cpp \
+ *				src/bfcFontMgr.c examples/BloodPressure_GUI/Consolas24h.c examples/BloodPressure_GUI/arrowUp_89x48.c \
+ *				examples/BloodPressure_GUI/IoT_message.c -lstdc++ -o bench_scroll && ./bench_scroll<br>
+ *			Add -DGFX_SCROLL=0 for frame buffer rows at fixed addresses, GFXDisplayScroll() copying the rows.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+#include "bench_util.h"
+#include "ImageRLE.h"
+
+extern const BFC_FONT fontConsolas24h;
+extern const tImage arrowUp_89x48;
+extern const tImage IoT_message;
+
+#define FB_SIZE		GFX_FB_SIZE(DISP_HOR_RESOLUTION, GFX_FB_CANVAS_H)
+
+static GFX_DISPLAY lcd, ref;	//full frame buffers in every build, GFX_BAND_LINES included
+static uint8_t lcdBuffer[FB_SIZE], lcdDirty[(GFX_FB_CANVAS_H + 7) / 8];
+static uint8_t refBuffer[FB_SIZE], refDirty[(GFX_FB_CANVAS_H + 7) / 8];
+static uint8_t regionCopy[FB_SIZE];
+static tImage rleImage;
+static volatile uint32_t sink;		//keeps results of timed calls alive
+
+//@note Row y of the reference display, GFX_FB_HEADER bytes of each row before its pixels
+#define REF_STRIDE	(GFX_FB_CANVAS_W + GFX_FB_HEADER)
+#define REF_ROW(y)	(refBuffer + GFX_FB_HEADER + (uint32_t)(y)*REF_STRIDE)
+
+/**
+ * @brief	A random drawing call on the selected display, the same for both displays with the same seed
+ */
+static void drawRandom(uint32_t seed)
+{
+	const uint16_t W = GFXDisplayGetLCDWidth(), H = GFXDisplayGetLCDHeight();
+	uint16_t x1, y1, x2, y2;
+	COLOR color;
+
+	srand(seed);
+	x1 = (uint16_t)(rand() % (W + 16));
+	y1 = (uint16_t)(rand() % (H + 8));
+	x2 = (uint16_t)(rand() % (W + 16));
+	y2 = (uint16_t)(rand() % (H + 8));
+	color = (rand() & 1) ? WHITE : BLACK;
+	GFXDisplaySetRasterOp((rand() % 4) ? GFX_ROP_SET : GFX_ROP_XOR);
+
+	switch(rand() % 9)
+	{
+	case 0: GFXDisplayDrawRect(x1, y1, x2, y2, color); break;
+	case 1: GFXDisplayLineDrawH(x1, x2, y1, color, (uint8_t)(y2 % 5 + 1)); break;
+	case 2: GFXDisplayLineDrawV(x1, y1, y2, color, (uint8_t)(x2 % 5 + 1)); break;
+	case 3: GFXDisplayDrawLine(x1, y1, x2, y2, color); break;
+	case 4: GFXDisplayPutPixel(x1, y1, color); break;
+	case 5: GFXDisplayPutImage(x1, y1, (rand() & 1) ? &arrowUp_89x48 : &IoT_message, rand() & 1); break;
+	case 6: GFXDisplayPutImage(x1, y1, &rleImage, rand() & 1); break;		//0x80 rows copy the row above
+	case 7: GFXDisplayPutString(x1, y1, &fontConsolas24h, "Log 42", color, (COLOR)(rand() % 3)); break;
+	case 8: GFXDisplayFillCircle(x1, y1, (uint16_t)(x2 % 40), color); break;
+	}
+	GFXDisplaySetRasterOp(GFX_ROP_SET);
+}
+
+/**
+ * @brief	Scroll rows top~top+n-1 of the reference frame buffer by moving the rows
+ */
+static void refScroll(uint16_t top, uint16_t n, int16_t lines, COLOR fill)
+{
+	const uint16_t W = GFX_FB_CANVAS_W;
+	uint16_t k = (uint16_t)MIN(abs(lines), (int)n);
+
+	for(uint16_t i = 0; i < n; i++)
+		memcpy(regionCopy + (uint32_t)i*W, REF_ROW(top + i), W);
+	for(uint16_t i = 0; i < n; i++)
+	{
+		uint16_t from = (lines > 0) ? (uint16_t)(i + k) : (uint16_t)(i + n - k);	//logical row moved to row i, n and above wrap
+		if((lines > 0) ? (i + k < n) : (i >= k))
+			memcpy(REF_ROW(top + i), regionCopy + (uint32_t)(from % n)*W, W);
+		else if(fill == TRANSPARENT)
+			memcpy(REF_ROW(top + i), regionCopy + (uint32_t)(from % n)*W, W);
+		else
+			memset(REF_ROW(top + i), (fill == WHITE) ? 0xFF : 0x00, W);
+	}
+}
+
+/**
+ * @return	rows whose content differs between the selected display (through its scroll region) and the reference
+ */
+static uint16_t rowsDiffering(void)
+{
+	uint16_t diff = 0;
+
+	for(uint16_t y = 0; y < GFXDisplayGetLCDHeight(); y++)
+		diff += (memcmp(GFXDisplayGetRow(y), REF_ROW(y), GFX_FB_CANVAS_W) != 0);
+	return diff;
+}
+
+/**
+ * @brief	Random drawing calls, scrolls and region changes against the reference
+ */
+static bool checkScroll(void)
+{
+	const uint16_t H = GFXDisplayGetLCDHeight();
+	uint16_t top = 0, rows = 0;
+	bool ok = true;
+
+	for(uint32_t step = 0; (step < 6000) && ok; step++)
+	{
+		uint32_t action = (uint32_t)rand() % 100;
+
+		if(action < 3)		//a new region, the content stays
+		{
+			top = (uint16_t)(rand() % H);
+			rows = (uint16_t)(rand() % (H - top + 1));
+			ok &= GFXDisplaySetScrollRegion(top, rows);
+			ok &= !GFXDisplaySetScrollRegion(top, H - top + 1);		//past the LCD, nothing changed
+		}
+		else if(action < 25)
+		{
+			int16_t lines = (int16_t)(rand() % (2*H + 1) - H);
+			COLOR fill = (COLOR)(rand() % 3);
+			GFXDisplayScroll(lines, fill);
+			if(rows && lines)
+				refScroll(top, rows, lines, fill);
+		}
+		else
+		{
+			uint32_t seed = (uint32_t)rand();
+			GFXDisplaySelect(&ref);
+			drawRandom(seed);
+			GFXDisplaySelect(&lcd);
+			drawRandom(seed);
+		}
+		if((step % 7) == 0)
+			GFXDisplaySetFlushMode((rand() & 1) ? GFX_FLUSH_IMMEDIATE : GFX_FLUSH_DEFERRED);
+		GFXDisplayFlush();
+
+		uint16_t fb = rowsDiffering(), panel = sim_compare_framebuffer();
+		if(fb || panel)
+		{
+			printf("step %u: %u rows differ from the reference, %u from the panel (region %u+%u, start %u)\n", step, fb, panel, top,
+				rows, GFXDisplayGetSelected()->scrollStart);
+			ok = false;
+		}
+	}
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+	return ok;
+}
+
+/**
+ * @brief	A log region scrolled by one text line: ring against memmove(), and the lines sent for it
+ */
+static bool compareLog(void)
+{
+	const uint16_t H = GFXDisplayGetLCDHeight(), W = GFX_FB_CANVAS_W, lineH = GFXDisplayGetFontHeight(&fontConsolas24h);
+	const uint16_t top = 0, rows = (uint16_t)(H / lineH * lineH);
+	const int repeat = 20000;
+	SIM_COUNTERS c;
+	char text[24];
+
+	GFXDisplaySetScrollRegion(top, rows);
+	for(uint16_t i = 0; i < rows / lineH; i++)
+	{
+		snprintf(text, sizeof(text), "%u: sample %u", i, i * 7);
+		GFXDisplayScroll((int16_t)lineH, WHITE);
+		GFXDisplayPutString(0, (uint16_t)(top + rows - lineH), &fontConsolas24h, text, BLACK, WHITE);
+	}
+	GFXDisplayFlush();
+
+	double t0 = nowNs();
+	for(int i = 0; i < repeat; i++)
+		GFXDisplayScroll((int16_t)lineH, (i & 1) ? WHITE : BLACK);
+	double ringNs = (nowNs() - t0) / repeat;
+	memset(lcdDirty, 0x00, sizeof(lcdDirty));
+
+	uint8_t *region = REF_ROW(top);
+	t0 = nowNs();
+	for(int i = 0; i < repeat; i++)		//whole rows of the reference display, headers moved along too with GFX_LINE_HEADERS
+	{
+		memmove(region, region + (uint32_t)lineH*REF_STRIDE, (size_t)(rows - lineH)*REF_STRIDE);
+		memset(region + (uint32_t)(rows - lineH)*REF_STRIDE, (i & 1) ? 0xFF : 0x00, (size_t)lineH*REF_STRIDE);
+		sink += region[0];
+	}
+	double moveNs = (nowNs() - t0) / repeat;
+
+	GFXDisplayScroll((int16_t)lineH, WHITE);
+	GFXDisplayPutString(0, (uint16_t)(top + rows - lineH), &fontConsolas24h, "new line", BLACK, WHITE);
+	sim_counters_reset();
+	uint16_t lines = GFXDisplayFlush();
+	sim_get_counters(&c);
+
+	//bytes written to the frame buffer per scroll, what an MCU without a data cache pays for
+	printf("log of %u rows, %u-row line        ns  fb bytes   lines  transactions\n", rows, lineH);
+	printf("%-32s %8.0f %9u\n", "memmove() + fill", moveNs, (unsigned)rows*W);
+	printf("%-32s %8.0f %9u %7u %13u\n", "GFXDisplayScroll()", ringNs, (unsigned)lineH*W, c.linesWritten, c.transactions);
+	GFXDisplaySetScrollRegion(0, 0);
+	return (lines == rows) && (c.linesWritten == rows) && (sim_compare_framebuffer() == 0);
+}
+
+/**
+ * @return	ns of a screen of drawing calls on the selected display
+ */
+static double timeDrawing(void)
+{
+	const uint16_t W = GFXDisplayGetLCDWidth(), H = GFXDisplayGetLCDHeight();
+	const int repeat = 20;
+
+	double t0 = nowNs();
+	for(int i = 0; i < repeat; i++)
+	{
+		for(uint16_t y = 0; y + 24 <= H; y += 24)
+		{
+			GFXDisplayDrawRect(0, y, W - 1, y + 23, WHITE);
+			GFXDisplayPutString(2, y, &fontConsolas24h, "12:00 sample 42", BLACK, TRANSPARENT);
+			GFXDisplayDrawLine(0, y, W - 1, y + 23, BLACK);
+			GFXDisplayLineDrawV((uint16_t)(W - 4), y, y + 23, BLACK, 2);
+		}
+		GFXDisplayPutImage(10, 10, &IoT_message, false);
+		memset(lcdDirty, 0x00, sizeof(lcdDirty));
+	}
+	return (nowNs() - t0) / repeat;
+}
+
+int main(void)
+{
+	const uint16_t H = GFX_DISPLAY_DESC_DEFAULT.height;
+	static GFX_DISPLAY banded;
+	static uint8_t band[GFX_FB_SIZE(DISP_HOR_RESOLUTION, 16)], list[256], bandDirty[(GFX_FB_CANVAS_H + 7) / 8];
+	uint8_t *data = (uint8_t *)malloc(IMAGE_RLE_MAX_SIZE(arrowUp_89x48.width, arrowUp_89x48.height));
+	bool ok = true;
+
+	hal_bsp_init();
+	image_rle_encode(arrowUp_89x48.data, arrowUp_89x48.width, arrowUp_89x48.height, data);
+	rleImage = arrowUp_89x48;
+	rleImage.data = data;
+	rleImage.compression = TIMAGE_RLE;
+
+	GFXDisplayInitBanded(&banded, &GFX_DISPLAY_DESC_DEFAULT, band, 16, list, sizeof(list), bandDirty, NULL);
+	GFXDisplaySelect(&banded);
+	ok &= !GFXDisplaySetScrollRegion(0, 10);		//no rows to move
+
+	GFXDisplayInit(&ref, &GFX_DISPLAY_DESC_DEFAULT, refBuffer, refDirty, NULL);
+	GFXDisplaySelect(&ref);
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);		//never sent, the panel shows lcd
+	GFXDisplayInit(&lcd, &GFX_DISPLAY_DESC_DEFAULT, lcdBuffer, lcdDirty, NULL);
+	GFXDisplaySelect(&lcd);
+	GFXDisplayAllClear();
+	memset(refBuffer, 0xFF, FB_SIZE);
+
+	srand(3);
+	ok &= checkScroll();
+	ok &= compareLog();
+
+	double plain = 1e30, ring = 1e30;
+	for(int trial = 0; trial < 50; trial++)		//fastest of interleaved trials, the host clock varies
+	{
+		GFXDisplaySetScrollRegion(0, 0);
+		plain = MIN(plain, timeDrawing());
+		GFXDisplaySetScrollRegion(0, H);
+		GFXDisplayScroll(100, TRANSPARENT);		//rows wrap around in the middle of the screen
+		ring = MIN(ring, timeDrawing());
+	}
+	printf("screen of drawing calls, ns: no region %.0f, region across the screen %.0f (%+.1f%%), GFX_SCROLL %u\n", plain, ring,
+		(ring / plain - 1.0) * 100.0, (unsigned)GFX_SCROLL);
+
+	printf("%s\n", ok ? "ok" : "FAILED");
+	return ok ? 0 : 1;
+}
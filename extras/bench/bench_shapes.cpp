@@ -0,0 +1,323 @@
+/**
+ * @brief	Host check and microbenchmark of GFXDisplayDrawLine(), GFXDisplayDrawCircle()/FillCircle() and GFXDisplayDrawEllipse()/FillEllipse().
+ *			Outlines are compared with per-pixel references of the same algorithms, fills with the row extents of the reference
+ *			outlines. The SPI traffic of a diagonal is compared with the drawLine() of the FirstPixel example (one GFXDisplayPutPixel()
+ *			per pixel). Every shape must be drawn at least as fast as by its per-pixel reference.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/bench/bench_shapes.cpp extras/host/MemoryLCDSim.cpp src/MemoryLCD.cpp src/bfcFontMgr.c \
+ *				-lstdc++ -o bench_shapes && ./bench_shapes
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+#include "bench_util.h"
+
+#define BENCH_ROUNDS	5
+
+static uint8_t refBuffer[GFX_FB_CANVAS_H][GFX_FB_CANVAS_W];
+static int32_t rowLeft[GFX_FB_CANVAS_H], rowRight[GFX_FB_CANVAS_H];	//extent of the reference outline per row, before clipping x
+
+/**
+ * @brief	refPutPixel() with signed coordinates, the extent of every row drawn is recorded for refFillRows()
+ */
+static void refPlot(int32_t x, int32_t y, COLOR color)
+{
+	if((y >= 0) && (y < GFX_FB_CANVAS_H))
+	{
+		rowLeft[y] = MIN(rowLeft[y], x);
+		rowRight[y] = MAX(rowRight[y], x);
+	}
+
+	if((x >= 0) && (y >= 0))
+		refPutPixel(refBuffer, (uint16_t)x, (uint16_t)y, color);
+}
+
+static void refResetRows(void)
+{
+	for(int32_t y = 0; y < GFX_FB_CANVAS_H; y++)
+	{
+		rowLeft[y] = 0x7FFFFFFF;
+		rowRight[y] = -0x7FFFFFFF;
+	}
+}
+
+/**
+ * @brief	Per-pixel Bresenham, drawn from the upper end point like GFXDisplayDrawLine()
+ */
+static void refLine(int32_t x1, int32_t y1, int32_t x2, int32_t y2, COLOR color)
+{
+	if(y1 > y2)
+	{
+		int32_t t = x1; x1 = x2; x2 = t;
+		t = y1; y1 = y2; y2 = t;
+	}
+
+	int32_t dx = abs(x2 - x1), dy = y2 - y1, sx = (x1 < x2) ? 1 : -1;
+	int32_t err = dx - dy;
+
+	for(;;)
+	{
+		refPlot(x1, y1, color);
+		if((x1 == x2) && (y1 == y2))
+			break;
+		int32_t e2 = 2*err;
+		if(e2 > -dy) { err -= dy; x1 += sx; }
+		if(e2 < dx)  { err += dx; y1++; }
+	}
+}
+
+static void refCircle(int32_t x0, int32_t y0, int32_t r, COLOR color)
+{
+	int32_t x = r, y = 0, err = 1 - r;
+
+	while(x >= y)
+	{
+		refPlot(x0+x, y0+y, color); refPlot(x0-x, y0+y, color); refPlot(x0+x, y0-y, color); refPlot(x0-x, y0-y, color);
+		refPlot(x0+y, y0+x, color); refPlot(x0-y, y0+x, color); refPlot(x0+y, y0-x, color); refPlot(x0-y, y0-x, color);
+		y++;
+		if(err < 0)
+			err += 2*y + 1;
+		else
+		{
+			x--;
+			err += 2*(y - x) + 1;
+		}
+	}
+}
+
+static void refEllipse(int32_t x0, int32_t y0, int32_t rx, int32_t ry, COLOR color)
+{
+	if(ry == 0)
+	{
+		for(int32_t x = -rx; x <= rx; x++)
+			refPlot(x0+x, y0, color);
+		return;
+	}
+
+	int64_t a2 = (int64_t)rx*rx, b2 = (int64_t)ry*ry;
+	int32_t x = 0, y = ry;
+	int64_t p = 4*b2 - 4*a2*ry + a2;
+
+	while(b2*x < a2*y)
+	{
+		refPlot(x0+x, y0+y, color); refPlot(x0-x, y0+y, color); refPlot(x0+x, y0-y, color); refPlot(x0-x, y0-y, color);
+		x++;
+		if(p < 0)
+			p += 4*(2*b2*x + b2);
+		else
+		{
+			y--;
+			p += 4*(2*b2*x - 2*a2*y + b2);
+		}
+	}
+
+	p = b2*(2*x+1)*(2*x+1) + 4*a2*(int64_t)(y-1)*(y-1) - 4*a2*b2;
+	while(y >= 0)
+	{
+		refPlot(x0+x, y0+y, color); refPlot(x0-x, y0+y, color); refPlot(x0+x, y0-y, color); refPlot(x0-x, y0-y, color);
+		y--;
+		if(p > 0)
+			p += 4*(a2 - 2*a2*y);
+		else
+		{
+			x++;
+			p += 4*(2*b2*x - 2*a2*y + a2);
+		}
+	}
+}
+
+/**
+ * @brief	Fill every row of refBuffer between the leftmost and rightmost pixel of the last reference outline, the expected result of a fill
+ */
+static void refFillRows(void)
+{
+	for(int32_t y = 0; y < GFX_FB_CANVAS_H; y++)
+		for(int32_t x = MAX(rowLeft[y], (int32_t)0); x <= MIN(rowRight[y], (int32_t)(GFX_FB_CANVAS_W*8-1)); x++)
+			refPlot(x, y, BLACK);
+}
+
+static bool compare(const char *label, int i)
+{
+	if(sim_compare_rows(&refBuffer[0][0]) == 0)
+		return true;
+	printf("Mismatch: %s, case %d\n", label, i);
+	return false;
+}
+
+static bool checkAgainstReference(void)
+{
+	const int32_t W = GFX_FB_CANVAS_W*8, H = GFX_FB_CANVAS_H;
+
+	srand(1);
+	for(int i = 0; i < 3000; i++)
+	{
+		uint16_t x1 = rand() % (W + 40), y1 = rand() % (H + 40), x2 = rand() % (W + 40), y2 = rand() % (H + 40);
+		if(i % 7 == 0) y2 = y1;		//flat and upright lines too
+		if(i % 11 == 0) x2 = x1;
+
+		memset(frameBuffer, 0xFF, sizeof(frameBuffer)); memset(refBuffer, 0xFF, sizeof(refBuffer));
+		GFXDisplayDrawLine(x1, y1, x2, y2, BLACK);
+		refLine(x1, y1, x2, y2, BLACK);
+		if(!compare("line", i)) return false;
+	}
+
+	for(int i = 0; i < 2000; i++)
+	{
+		uint16_t x0 = rand() % W, y0 = rand() % H, r = rand() % (H / ((i & 1) ? 2 : 8));
+		uint16_t rx = rand() % W, ry = rand() % (H / 2);
+		if(i % 5 == 0) { rx = rand() % 4; ry = rand() % 4; }	//tiny and degenerate shapes
+
+		memset(frameBuffer, 0xFF, sizeof(frameBuffer)); memset(refBuffer, 0xFF, sizeof(refBuffer));
+		refResetRows();
+		GFXDisplayDrawCircle(x0, y0, r, BLACK);
+		refCircle(x0, y0, r, BLACK);
+		if(!compare("circle", i)) return false;
+
+		memset(frameBuffer, 0xFF, sizeof(frameBuffer));
+		GFXDisplayFillCircle(x0, y0, r, BLACK);
+		refFillRows();
+		if(!compare("filled circle", i)) return false;
+
+		memset(frameBuffer, 0xFF, sizeof(frameBuffer)); memset(refBuffer, 0xFF, sizeof(refBuffer));
+		refResetRows();
+		GFXDisplayDrawEllipse(x0, y0, rx, ry, BLACK);
+		refEllipse(x0, y0, rx, ry, BLACK);
+		if(!compare("ellipse", i)) return false;
+
+		memset(frameBuffer, 0xFF, sizeof(frameBuffer));
+		GFXDisplayFillEllipse(x0, y0, rx, ry, BLACK);
+		refFillRows();
+		if(!compare("filled ellipse", i)) return false;
+	}
+	return true;
+}
+
+/**
+ * @brief	drawLine() of the FirstPixel example, one GFXDisplayPutPixel() and line update per pixel
+ */
+static void firstPixelDrawLine(int32_t x1, int32_t y1, int32_t x2, int32_t y2, COLOR color)
+{
+	int32_t dx = abs(x2 - x1), dy = abs(y2 - y1), sx = (x1 < x2) ? 1 : -1, sy = (y1 < y2) ? 1 : -1;
+	int32_t err = dx - dy;
+
+	for(;;)
+	{
+		GFXDisplayPutPixel(x1, y1, color);
+		if((x1 == x2) && (y1 == y2))
+			break;
+		int32_t e2 = 2*err;
+		if(e2 > -dy) { err -= dy; x1 += sx; }
+		if(e2 < dx)  { err += dx; y1 += sy; }
+	}
+}
+
+static void traffic(const char *label, void (*pfcn)(void))
+{
+	SIM_COUNTERS cnt;
+
+	GFXDisplaySetFlushMode(GFX_FLUSH_IMMEDIATE);
+	sim_counters_reset();
+	pfcn();
+	sim_get_counters(&cnt);
+	printf("%-36s %8u %8u %8u %10.2f\n", label, cnt.transactions, cnt.linesWritten, cnt.bytes, cnt.busTimeNs / 1e6);
+}
+
+static void diagonalsPerPixel(void)
+{
+	uint16_t w = GFXDisplayGetLCDWidth(), h = GFXDisplayGetLCDHeight();
+	firstPixelDrawLine(0, 0, w-1, h-1, BLACK);
+	firstPixelDrawLine(w-1, 0, 0, h-1, BLACK);
+}
+
+static void diagonalsDrawLine(void)
+{
+	uint16_t w = GFXDisplayGetLCDWidth(), h = GFXDisplayGetLCDHeight();
+	GFXDisplayDrawLine(0, 0, w-1, h-1, BLACK);
+	GFXDisplayDrawLine(w-1, 0, 0, h-1, BLACK);
+}
+
+static void circleAndEllipse(void)
+{
+	uint16_t w = GFXDisplayGetLCDWidth(), h = GFXDisplayGetLCDHeight();
+	GFXDisplayFillCircle(w/2, h/2, h/4, BLACK);
+	GFXDisplayDrawEllipse(w/2, h/2, w/2 - 1, h/2 - 1, BLACK);
+}
+
+/**
+ * @return	speedup of pfcnNew over pfcnRef, the best of BENCH_ROUNDS alternated rounds of each
+ */
+static double bench(const char *label, void (*pfcnRef)(int), void (*pfcnNew)(int), int repeat)
+{
+	double refNs = 1e30, newNs = 1e30;
+
+	for(int round = 0; round < BENCH_ROUNDS; round++)
+	{
+		double t0 = nowNs();
+		for(int i = 0; i < repeat; i++) pfcnRef(i);
+		refNs = MIN(refNs, (nowNs() - t0) / repeat);
+
+		t0 = nowNs();
+		for(int i = 0; i < repeat; i++) pfcnNew(i);
+		newNs = MIN(newNs, (nowNs() - t0) / repeat);
+	}
+
+	printf("%-36s %12.0f %12.0f %7.1fx\n", label, refNs, newNs, refNs/newNs);
+	return refNs/newNs;
+}
+
+static void refDiagonal(int i)		{ refLine(0, 0, GFX_FB_CANVAS_W*8-1, GFX_FB_CANVAS_H-1, (i & 1) ? WHITE : BLACK); }
+static void newDiagonal(int i)		{ GFXDisplayDrawLine(0, 0, GFX_FB_CANVAS_W*8-1, GFX_FB_CANVAS_H-1, (i & 1) ? WHITE : BLACK); }
+static void refFlat(int i)			{ refLine(0, 10, GFX_FB_CANVAS_W*8-1, 30, (i & 1) ? WHITE : BLACK); }
+static void newFlat(int i)			{ GFXDisplayDrawLine(0, 10, GFX_FB_CANVAS_W*8-1, 30, (i & 1) ? WHITE : BLACK); }
+static void refCircle100(int i)		{ refCircle(GFX_FB_CANVAS_H/2, GFX_FB_CANVAS_H/2, GFX_FB_CANVAS_H/2 - 1, (i & 1) ? WHITE : BLACK); }
+static void newCircle100(int i)		{ GFXDisplayDrawCircle(GFX_FB_CANVAS_H/2, GFX_FB_CANVAS_H/2, GFX_FB_CANVAS_H/2 - 1, (i & 1) ? WHITE : BLACK); }
+static void refFillCircle(int i)
+{
+	int32_t r = GFX_FB_CANVAS_H/2 - 1, c = GFX_FB_CANVAS_H/2;
+	for(int32_t y = -r; y <= r; y++)		//per-pixel fill, the way a sketch does it with GFXDisplayPutPixel()
+		for(int32_t x = -r; x <= r; x++)
+			if(x*x + y*y <= r*r)
+				refPlot(c+x, c+y, (i & 1) ? WHITE : BLACK);
+}
+static void newFillCircle(int i)	{ GFXDisplayFillCircle(GFX_FB_CANVAS_H/2, GFX_FB_CANVAS_H/2, GFX_FB_CANVAS_H/2 - 1, (i & 1) ? WHITE : BLACK); }
+static void refEllipseFull(int i)	{ refEllipse(GFX_FB_CANVAS_W*4, GFX_FB_CANVAS_H/2, GFX_FB_CANVAS_W*4-1, GFX_FB_CANVAS_H/2-1, (i & 1) ? WHITE : BLACK); }
+static void newEllipseFull(int i)	{ GFXDisplayDrawEllipse(GFX_FB_CANVAS_W*4, GFX_FB_CANVAS_H/2, GFX_FB_CANVAS_W*4-1, GFX_FB_CANVAS_H/2-1, (i & 1) ? WHITE : BLACK); }
+
+int main(void)
+{
+	hal_bsp_init();
+	GFXDisplayPowerOn();
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+
+	if(!checkAgainstReference())
+		return 1;
+
+	bool ok = true;
+	printf("%-36s %12s %12s %8s\n", "frame buffer, deferred mode", "per-pixel ns", "span ns", "speedup");
+	ok &= (bench("diagonal", refDiagonal, newDiagonal, 5000) >= 1.0);
+	ok &= (bench("flat line, 20 rows", refFlat, newFlat, 5000) >= 1.0);
+	ok &= (bench("circle outline", refCircle100, newCircle100, 5000) >= 1.0);
+	ok &= (bench("filled circle", refFillCircle, newFillCircle, 500) >= 1.0);
+	ok &= (bench("ellipse outline, full screen", refEllipseFull, newEllipseFull, 5000) >= 1.0);
+	if(!ok)
+	{
+		printf("Slower than the per-pixel reference\n");
+		return 1;
+	}
+
+	GFXDisplayAllClear();
+	printf("\n%-36s %8s %8s %8s %10s\n", "SPI traffic, immediate mode", "trans", "lines", "bytes", "bus ms");
+	traffic("2 diagonals, FirstPixel drawLine()", diagonalsPerPixel);
+	GFXDisplayAllClear();
+	traffic("2 diagonals, GFXDisplayDrawLine()", diagonalsDrawLine);
+	traffic("FillCircle + DrawEllipse", circleAndEllipse);
+
+	if(sim_compare_framebuffer() != 0)
+	{
+		printf("Panel and frame buffer differ\n");
+		return 1;
+	}
+	return 0;
+}
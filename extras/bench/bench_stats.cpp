@@ -0,0 +1,88 @@
+/**
+ * @brief	Host check of the flush statistics: the counters of GFXDisplayGetStats() are compared with the SPI traffic decoded by
+ *			the simulated panel for every API function that sends to the LCD, then a screen is redrawn to count redundant lines.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -DGFX_STATS=1 -DGFX_SHADOW=2 -Isrc -Iextras/host extras/bench/bench_stats.cpp extras/host/MemoryLCDSim.cpp \
+ *				src/MemoryLCD.cpp src/bfcFontMgr.c examples/HelloWorld/Consolas24h.c examples/HelloWorld_v2/run_64x64.c \
+ *				-lstdc++ -o bench_stats && ./bench_stats<br>
+ *			The cost of the counters shows in bench_api.cpp built with and without -DGFX_STATS=1.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+
+#if !GFX_STATS
+#error "build with -DGFX_STATS=1"
+#endif
+
+extern const BFC_FONT fontConsolas24h;
+extern const tImage run_64x64;
+
+static uint8_t xfer[GFX_TRANSFER_SIZE(LS027B7DH01) * 4];	//large enough for every default model
+
+static void drawScreen(void)
+{
+	GFXDisplayDrawRect(10, 10, 120, 60, BLACK);
+	GFXDisplayLineDrawH(0, GFXDisplayGetLCDWidth() - 1, 70, BLACK, 2);
+	GFXDisplayPutString(4, 80, &fontConsolas24h, "Stats", BLACK, WHITE);
+	GFXDisplayPutImage(0, 20, &run_64x64, false);
+	GFXDisplayPutPixel(2, 2, BLACK);
+}
+
+/**
+ * @brief	Run one step and check its statistics against the simulator counters
+ */
+static bool checkStep(const char *label, void (*pfcn)(void))
+{
+	SIM_COUNTERS sim;
+	GFX_DISPLAY_STATS stats;
+
+	sim_counters_reset();
+	GFXDisplayResetStats();
+	pfcn();
+	GFXDisplayFlushWait();
+	sim_get_counters(&sim);
+	GFXDisplayGetStats(&stats);
+
+	bool ok = (stats.transactions == sim.transactions) && (stats.linesSent == sim.linesWritten) &&
+			  (stats.payloadBytes == sim.payloadBytes) && (stats.headerBytes == sim.headerBytes) &&
+			  (stats.dummyBytes == sim.dummyBytes);
+
+	printf("%-22s %6u %6u %8u %7u %6u %8u %10u  %s\n", label, stats.transactions, stats.linesSent, stats.payloadBytes,
+		stats.headerBytes, stats.dummyBytes, stats.delayUs, stats.redundantLines, ok ? "ok" : "MISMATCH");
+	return ok;
+}
+
+static void stepAllClear(void)		{ GFXDisplayAllClear(); }
+static void stepTestPattern(void)	{ GFXDisplayTestPattern(0xF0, NULL); }
+static void stepImmediate(void)		{ GFXDisplaySetFlushMode(GFX_FLUSH_IMMEDIATE); drawScreen(); }
+static void stepRedraw(void)		{ GFXDisplaySetFlushMode(GFX_FLUSH_IMMEDIATE); drawScreen(); }
+static void stepDeferred(void)		{ GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED); GFXDisplayDrawRect(0, 0, 40, 40, BLACK); drawScreen(); GFXDisplayFlush(); }
+static void stepAsync(void)			{ GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED); GFXDisplayDrawRect(0, 0, 40, 40, WHITE); drawScreen(); GFXDisplayFlushAsync(NULL); }
+
+int main(void)
+{
+	bool ok = true;
+
+	hal_bsp_init();
+	GFXDisplayPowerOn();
+	sim_dma_enable(true);
+	GFXDisplaySetTransferBuffer(xfer, sizeof(xfer));
+
+	printf("%-22s %6s %6s %8s %7s %6s %8s %10s\n", "step", "trans", "lines", "payload", "header", "dummy", "delayUs", "redundant");
+	ok &= checkStep("TestPattern", stepTestPattern);
+	ok &= checkStep("AllClear", stepAllClear);
+	ok &= checkStep("screen, immediate", stepImmediate);
+	ok &= checkStep("same screen again", stepRedraw);
+	ok &= checkStep("screen, deferred", stepDeferred);
+	ok &= checkStep("screen, async", stepAsync);
+
+	if(sim_compare_framebuffer() != 0)
+	{
+		printf("Panel and frame buffer differ\n");
+		ok = false;
+	}
+	return ok ? 0 : 1;
+}
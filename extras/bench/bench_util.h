@@ -0,0 +1,51 @@
+/**
+ * @brief	Helpers shared by the host benchmarks of this folder: the clock the timings are taken with, the per-pixel
+ *			reference the frame buffer routines are checked against and the check of the simulated panel.
+ * @note	Header only, the benches are built from the library folder with -Isrc -Iextras/host as given in their headers.
+ */
+
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include <time.h>
+#include "MemoryLCDSim.h"
+
+/**
+ * @return	monotonic time in ns
+ */
+static inline double nowNs(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief	Per-pixel reference, the same bounds check and mask computation GFXDisplayPutPixel_FB() does for every pixel
+ * @param	ref is GFX_FB_CANVAS_H rows of GFX_FB_CANVAS_W bytes without line headers, compared with sim_compare_rows()
+ */
+static inline void refPutPixel(uint8_t ref[][GFX_FB_CANVAS_W], uint16_t x, uint16_t y, COLOR color)
+{
+	if(y>(GFX_FB_CANVAS_H-1)||((x>>3)>(GFX_FB_CANVAS_W-1)))
+		return;
+
+	uint8_t maskBit = 0x01 << (x & 0x07);
+
+	if(color == WHITE)
+		ref[y][(x >> 3)] |= maskBit;
+	else
+		ref[y][(x >> 3)] &= (maskBit ^ 0xFF);
+}
+
+/**
+ * @return	true if the simulated panel shows the frame buffer of pRef, pLcd is selected again on return
+ */
+static inline bool panelShows(GFX_DISPLAY *pRef, GFX_DISPLAY *pLcd)
+{
+	GFXDisplaySelect(pRef);
+	bool ok = (sim_compare_framebuffer() == 0);
+	GFXDisplaySelect(pLcd);
+	return ok;
+}
+
+#endif	//BENCH_UTIL_H
@@ -0,0 +1,75 @@
+/**
+ * @brief	Host check of serial VCOM (GFX_VCOM_SERIAL): the simulated panel takes VCOM from the M1 bit (EXTMODE low) and the
+ *			longest time it is driven with one polarity is measured while the application is idle (display mode commands from
+ *			GFXDisplayVcomService()) and while it updates the screen (M1 of the updates, no extra command).
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -DGFX_VCOM=1 -Isrc -Iextras/host extras/bench/bench_vcom.cpp extras/host/MemoryLCDSim.cpp src/MemoryLCD.cpp \
+ *				src/bfcFontMgr.c -lstdc++ -o bench_vcom && ./bench_vcom
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+
+#if (GFX_VCOM != GFX_VCOM_SERIAL)
+#error "build with -DGFX_VCOM=1"
+#endif
+
+#define RUN_MS		10000
+
+/**
+ * @brief	Run the main loop for RUN_MS of simulated time, waking up every wakeMs
+ * @return	longest VCOM polarity in ms seen at the wakeups
+ */
+static uint32_t runLoop(const char *label, uint32_t wakeMs, bool draw)
+{
+	SIM_COUNTERS cnt;
+	uint64_t maxAgeNs = 0;
+	uint32_t serviced = 0;
+
+	sim_counters_reset();
+	for(uint32_t t = 0; t < RUN_MS; t += wakeMs)
+	{
+		if(draw)
+			GFXDisplayPutPixel(t % GFXDisplayGetLCDWidth(), 0, (t / wakeMs) & 1 ? BLACK : WHITE);
+		if(GFXDisplayVcomService())
+			serviced++;
+		if(sim_vcom_age_ns() > maxAgeNs)
+			maxAgeNs = sim_vcom_age_ns();
+		hal_delayMs(wakeMs);
+		if(sim_vcom_age_ns() > maxAgeNs)
+			maxAgeNs = sim_vcom_age_ns();
+	}
+	sim_get_counters(&cnt);
+
+	printf("%-28s inversions %3u  display modes %3u  VCOM bytes/s %5.1f  EXTCOMIN edges %u  longest polarity %4u ms%s\n",
+		label, cnt.vcomInversions, cnt.displayModes, (cnt.displayModes * 2) * 1000.0 / RUN_MS, cnt.extcominEdges,
+		(uint32_t)(maxAgeNs / 1000000ULL), cnt.protocolErrors ? "  PROTOCOL ERROR" : "");
+	return (uint32_t)(maxAgeNs / 1000000ULL);
+}
+
+int main(void)
+{
+	bool ok = true;
+	SIM_COUNTERS cnt;
+
+	hal_bsp_init();
+	sim_set_extmode(false);		//EXTMODE low, VCOM from the M1 bit
+	GFXDisplayPowerOn();
+	sim_get_counters(&cnt);
+	ok &= (cnt.extcominEdges == 0);
+
+	printf("GFX_VCOM_PERIOD_MS %u\n", GFX_VCOM_PERIOD_MS);
+	ok &= runLoop("idle, wake every 100 ms", 100, false) <= GFX_VCOM_PERIOD_MS + 100;
+	ok &= runLoop("idle, wake every 500 ms", 500, false) <= GFX_VCOM_PERIOD_MS + 500;
+	ok &= runLoop("drawing every 50 ms", 50, true) <= GFX_VCOM_PERIOD_MS + 50;
+
+	sim_counters_reset();
+	GFXDisplayPowerOff();
+	sim_get_counters(&cnt);
+	ok &= (cnt.extcominEdges == 0) && (sim_compare_framebuffer() == 0);
+
+	printf("%s\n", ok ? "ok" : "FAILED");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,326 @@
+/**
+ * @brief	Host check and benchmark of the retained widget tree (GFXWidgetRender()).
+ *			The screen of BloodPressure_GUI is built as a widget tree and run through value changes at 20 Hz, an unchanged
+ *			frame, a label moved and hidden over an image, and a message shown and hidden. After every frame the panel has to
+ *			match a full repaint of the tree done the simple way, and the lines sent are reported against repainting and
+ *			sending the whole screen. The same frames run on a banded display. A number counting on its own is timed against
+ *			clearing its field and drawing the string at every tick.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/bench/bench_widget.cpp extras/host/MemoryLCDSim.cpp src/MemoryLCD.cpp src/bfcFontMgr.c \
+ *				examples/BloodPressure_GUI/Arial_Rounded_MT_Bold55h.c examples/BloodPressure_GUI/Consolas24h.c \
+ *				examples/BloodPressure_GUI/arrowUp_89x48.c examples/BloodPressure_GUI/arrowDown_89x48.c \
+ *				examples/BloodPressure_GUI/battery_46x26.c examples/BloodPressure_GUI/pulseRate_icon.c \
+ *				examples/BloodPressure_GUI/IoT_message.c -lstdc++ -o bench_widget && ./bench_widget
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+#include "bench_util.h"
+
+extern const BFC_FONT fontArial_Rounded_MT_Bold55h;
+extern const BFC_FONT fontConsolas24h;
+extern const tImage arrowUp_89x48;
+extern const tImage arrowDown_89x48;
+extern const tImage battery_46x26;
+extern const tImage pulseRate_icon;
+extern const tImage IoT_message;
+
+#define VALUE_LEFT		100
+#define LABEL_LEFT		200
+#define VALUE_TOP		50
+
+static GFX_WIDGET screen, values, sys, dia, pul, battery, arrowUp, arrowDown, heart, message, status;
+static GFX_WIDGET labels[5];
+static const char *labelText[5] = {"SYS.", "mmHg", "DIA.", "mmHg", "PUL."};
+
+static GFX_DISPLAY refLcd;
+static uint8_t refBuffer[GFX_FB_SIZE(DISP_HOR_RESOLUTION, GFX_FB_CANVAS_H)], refDirty[(GFX_FB_CANVAS_H + 7) / 8];
+
+static void buildTree(void)
+{
+	uint16_t valueH = GFXDisplayGetFontHeight(&fontArial_Rounded_MT_Bold55h), labelH = GFXDisplayGetFontHeight(&fontConsolas24h);
+
+	GFXWidgetInitGroup(&screen, 0, 0, GFXDisplayGetLCDWidth(), GFXDisplayGetLCDHeight(), WHITE);
+	GFXWidgetInitImage(&battery, LABEL_LEFT + 100, 5, &battery_46x26, false);
+	GFXWidgetInitImage(&arrowUp, LABEL_LEFT + 80, VALUE_TOP, &arrowUp_89x48, false);
+	GFXWidgetInitImage(&arrowDown, LABEL_LEFT + 80, VALUE_TOP + valueH, &arrowDown_89x48, false);
+	GFXWidgetInitImage(&heart, LABEL_LEFT + 100, VALUE_TOP + 2 * valueH, &pulseRate_icon, false);
+	GFXWidgetAdd(&screen, &battery);
+	GFXWidgetAdd(&screen, &arrowUp);
+	GFXWidgetAdd(&screen, &arrowDown);
+	GFXWidgetAdd(&screen, &heart);
+
+	const uint16_t labelTop[5] = {VALUE_TOP + 5, (uint16_t)(VALUE_TOP + 5 + labelH), (uint16_t)(VALUE_TOP + 5 + valueH),
+								  (uint16_t)(VALUE_TOP + 5 + valueH + labelH), (uint16_t)(VALUE_TOP + 10 + 2 * valueH + labelH)};
+	for(uint16_t i = 0; i < 5; i++)
+	{
+		GFXWidgetInitLabel(&labels[i], LABEL_LEFT, labelTop[i], &fontConsolas24h, labelText[i], BLACK, WHITE);
+		GFXWidgetAdd(&screen, &labels[i]);
+	}
+
+	GFXWidgetInitGroup(&values, 0, 0, 0, 0, TRANSPARENT);
+	GFXWidgetInitNumber(&sys, VALUE_LEFT, VALUE_TOP, &fontArial_Rounded_MT_Bold55h, 3, 70, BLACK, WHITE);
+	GFXWidgetInitNumber(&dia, VALUE_LEFT, VALUE_TOP + valueH, &fontArial_Rounded_MT_Bold55h, 3, 60, BLACK, WHITE);
+	GFXWidgetInitNumber(&pul, VALUE_LEFT, VALUE_TOP + 2 * valueH, &fontArial_Rounded_MT_Bold55h, 3, 60, BLACK, WHITE);
+	GFXWidgetAdd(&screen, &values);
+	GFXWidgetAdd(&values, &sys);
+	GFXWidgetAdd(&values, &dia);
+	GFXWidgetAdd(&values, &pul);
+
+	GFXWidgetInitLabel(&status, LABEL_LEFT + 60, VALUE_TOP + 10, &fontConsolas24h, "Hi", BLACK, TRANSPARENT);	//over arrowUp
+	GFXWidgetAdd(&screen, &status);
+
+	GFXWidgetInitImage(&message, (GFXDisplayGetLCDWidth() - IoT_message.width) / 2, 20, &IoT_message, false);
+	GFXWidgetSetVisible(&message, false);
+	GFXWidgetAdd(&screen, &message);
+}
+
+/**
+ * @brief	Reference: paint the shown nodes of the tree in order into the reference frame buffer, without damage tracking
+ */
+static void refPaint(const GFX_WIDGET *pWidget, bool parentShown)
+{
+	for(; pWidget != NULL; pWidget = pWidget->next)
+	{
+		bool shown = parentShown && (pWidget->flags & GFX_WIDGET_VISIBLE);
+		if(!shown)
+			continue;
+
+		uint16_t right = pWidget->left + pWidget->width - 1, bottom = pWidget->top + pWidget->height - 1;
+		const BFC_FONT *pFont = (const BFC_FONT *)pWidget->ptr;
+		char buf[16];
+
+		switch(pWidget->type)
+		{
+		case GFX_WIDGET_GROUP:
+			if((pWidget->bg != TRANSPARENT) && pWidget->width && pWidget->height)
+				GFXDisplayDrawRect(pWidget->left, pWidget->top, right, bottom, pWidget->bg);
+			break;
+		case GFX_WIDGET_RECT:
+			GFXDisplayDrawRect(pWidget->left, pWidget->top, right, bottom, pWidget->color);
+			break;
+		case GFX_WIDGET_LABEL:
+			GFXDisplayPutString(pWidget->left, pWidget->top, pFont, pWidget->text, pWidget->color, pWidget->bg);
+			break;
+		case GFX_WIDGET_IMAGE:
+			GFXDisplayPutImage(pWidget->left, pWidget->top, (const tImage *)pWidget->ptr, pWidget->value != 0);
+			break;
+		case GFX_WIDGET_NUMBER:		//characters right aligned in cells of width / digits, the leftmost ones cut off
+		{
+			int len = snprintf(buf, sizeof(buf), "%d", (int)pWidget->value), cell = pWidget->width / pWidget->digits;
+			if(pWidget->bg != TRANSPARENT)
+				GFXDisplayDrawRect(pWidget->left, pWidget->top, right, bottom, pWidget->bg);
+			for(int k = MAX(0, len - pWidget->digits); k < len; k++)
+				GFXDisplayPutChar(pWidget->left + (pWidget->digits - len + k + 1) * cell - GFXDisplayGetCharWidth(pFont, buf[k]), pWidget->top,
+								  pFont, buf[k], pWidget->color, pWidget->bg);
+			break;
+		}
+		}
+		refPaint(pWidget->child, shown);
+	}
+}
+
+/**
+ * @return	true if the panel shows the tree as painted from scratch
+ */
+static bool panelMatches(GFX_DISPLAY *pLcd)
+{
+	memset(refBuffer, 0xFF, sizeof(refBuffer));
+	GFXDisplaySelect(&refLcd);
+	refPaint(&screen, true);
+	return panelShows(&refLcd, pLcd);
+}
+
+typedef struct
+{
+	uint32_t frames, lines, transactions;
+	uint64_t busNs;
+	double cpuNs;
+} FRAME_STATS;
+
+/**
+ * @brief	Render a frame, check it and add its counters
+ * @return	true if the panel is right and the lines sent are within maxLines
+ */
+static bool frame(GFX_DISPLAY *pLcd, const char *label, uint16_t maxLines, FRAME_STATS *pStats)
+{
+	SIM_COUNTERS cnt;
+
+	sim_counters_reset();
+	double t0 = nowNs();
+	uint16_t lines = GFXWidgetRender(&screen);
+	double ns = nowNs() - t0;
+	sim_get_counters(&cnt);
+
+	bool ok = panelMatches(pLcd) && (lines <= maxLines) && (cnt.linesWritten <= lines) && (cnt.transactions <= ((pLcd->bandLines) ? cnt.transactions : 1u)) &&
+			  (cnt.protocolErrors == 0);
+	if(!ok)
+		printf("%s: FAILED, %u lines (at most %u), %u transactions\n", label, lines, maxLines, cnt.transactions);
+
+	pStats->frames++;
+	pStats->lines += cnt.linesWritten;
+	pStats->transactions += cnt.transactions;
+	pStats->busNs += cnt.busTimeNs;
+	pStats->cpuNs += ns;
+	return ok;
+}
+
+static void report(const char *label, const FRAME_STATS *pStats)
+{
+	printf("%-32s %6u %10.1f %10.1f %10.2f %10.1f\n", label, pStats->frames, (double)pStats->lines / pStats->frames,
+		(double)pStats->transactions / pStats->frames, pStats->busNs / 1e6 / pStats->frames, pStats->cpuNs / 1e3 / pStats->frames);
+}
+
+static bool runScenario(GFX_DISPLAY *pLcd, const char *name)
+{
+	const uint16_t H = GFXDisplayGetLCDHeight(), valueH = GFXDisplayGetFontHeight(&fontArial_Rounded_MT_Bold55h);
+	FRAME_STATS first = {}, counting = {}, idle = {}, all = {}, overlap = {}, popup = {}, full = {};
+	bool ok = true;
+
+	GFXDisplaySelect(pLcd);
+	GFXDisplayAllClear();
+	buildTree();
+	printf("\n%s\n%-32s %6s %10s %10s %10s %10s\n", name, "", "frames", "lines", "trans", "bus ms", "cpu us");
+
+	ok &= frame(pLcd, "first frame", H, &first);
+	report("first frame, whole screen", &first);
+
+	for(int32_t v = 70; v < 120; v++)	//one number counting, its rows only
+	{
+		GFXWidgetSetValue(&sys, v);
+		ok &= frame(pLcd, "SYS counting", valueH, &counting);
+	}
+	report("one number changing", &counting);
+
+	for(uint16_t i = 0; i < 20; i++)		//values set to what they are
+	{
+		GFXWidgetSetValue(&sys, 119);
+		ok &= frame(pLcd, "no change", 0, &idle);
+	}
+	report("values unchanged", &idle);
+
+	for(int32_t c = 0; c < 30; c++)
+	{
+		GFXWidgetSetValue(&sys, 90 + c);
+		GFXWidgetSetValue(&dia, 52 + c);
+		GFXWidgetSetValue(&pul, (c & 1) ? 66 : 9);	//digits dropping off the field
+		if(c >= 25)
+			GFXWidgetSetValue(&dia, (c & 1) ? -7 : 1234);	//minus sign, wider than the field
+		ok &= frame(pLcd, "three numbers", 3 * valueH, &all);
+	}
+	report("three numbers changing", &all);
+
+	for(uint16_t i = 0; i < 10; i++)	//transparent label over an image: the image is repainted below it
+	{
+		GFXWidgetSetText(&status, (i & 1) ? "Hi" : "Hello");
+		GFXWidgetMove(&status, LABEL_LEFT + 60 + i, VALUE_TOP + 10 + i);
+		GFXWidgetSetVisible(&status, i != 9);
+		ok &= frame(pLcd, "label over image", H, &overlap);
+	}
+	report("label moved over an image", &overlap);
+
+	GFXWidgetSetVisible(&message, true);	//message over everything, then gone
+	ok &= frame(pLcd, "message shown", H, &popup);
+	GFXWidgetSetVisible(&message, false);
+	ok &= frame(pLcd, "message hidden", H, &popup);
+	report("message shown and hidden", &popup);
+
+	for(int32_t v = 70; v < 80; v++)	//the same number change with the whole screen painted and sent
+	{
+		GFXWidgetSetValue(&sys, v);
+		GFXWidgetInvalidate(&screen);
+		ok &= frame(pLcd, "whole screen", H, &full);
+	}
+	report("one number, whole screen sent", &full);
+
+	ok &= (counting.lines <= counting.frames * valueH) && (idle.lines == 0) && (idle.transactions == 0);
+	return ok;
+}
+
+/**
+ * @brief	A number counting on its own: a number node as the root, against clearing the field and drawing the string
+ *			at every tick as BloodPressure_GUI did before
+ */
+static bool compareField(void)
+{
+	static GFX_WIDGET field;
+	const BFC_FONT *pFont = &fontArial_Rounded_MT_Bold55h;
+	const uint16_t H = GFXDisplayGetFontHeight(pFont);
+	SIM_COUNTERS cnt;
+	uint32_t lines[2] = {0, 0}, glyphs = 0;
+	double ns[2] = {0, 0};
+	char buf[12];
+	bool ok = true;
+
+	GFXDisplayAllClear();
+	GFXWidgetInitNumber(&field, VALUE_LEFT, VALUE_TOP, pFont, 3, 0, BLACK, WHITE);
+	GFXWidgetRender(&field);
+
+	for(int32_t v = 1; v < 1000; v++)
+	{
+		char prev[12];
+		snprintf(prev, sizeof(prev), "%3d", (int)(v - 1));
+		snprintf(buf, sizeof(buf), "%3d", (int)v);
+		for(uint16_t i = 0; i < 3; i++)
+			glyphs += (buf[i] != prev[i]);
+
+		sim_counters_reset();
+		double t0 = nowNs();
+		GFXWidgetSetValue(&field, v);
+		GFXWidgetRender(&field);
+		ns[0] += nowNs() - t0;
+		sim_get_counters(&cnt);
+		lines[0] += cnt.linesWritten;
+		ok &= (cnt.linesWritten <= H) && ((cnt.transactions <= 1) || GFXDisplayGetSelected()->bandLines);
+	}
+
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+	for(int32_t v = 1; v < 1000; v++)
+	{
+		uint16_t w, x;
+
+		sim_counters_reset();
+		double t0 = nowNs();
+		snprintf(buf, sizeof(buf), "%d", (int)v);
+		w = GFXDisplayGetStringWidth(pFont, buf);
+		x = VALUE_LEFT + field.width - w;
+		if(x > VALUE_LEFT)
+			GFXDisplayDrawRect(VALUE_LEFT, VALUE_TOP, x - 1, VALUE_TOP + H - 1, WHITE);
+		GFXDisplayPutString(x, VALUE_TOP, pFont, buf, BLACK, WHITE);
+		GFXDisplayFlush();
+		ns[1] += nowNs() - t0;
+		sim_get_counters(&cnt);
+		lines[1] += cnt.linesWritten;
+	}
+
+	printf("\nnumber counting 1 to 999 on its own  lines/tick  cpu us/tick\n");
+	printf("%-36s %10.1f %12.2f   (%.2f of 3 digits drawn)\n", "number node, changed digits", lines[0] / 999.0, ns[0] / 999e3, glyphs / 999.0);
+	printf("%-36s %10.1f %12.2f\n", "field cleared, string drawn", lines[1] / 999.0, ns[1] / 999e3);
+	return ok;
+}
+
+int main(void)
+{
+	static GFX_DISPLAY bandLcd;
+	static uint8_t band[GFX_FB_SIZE(DISP_HOR_RESOLUTION, 16)], list[2048], bandDirty[(GFX_FB_CANVAS_H + 7) / 8];
+	bool ok = true;
+
+	hal_bsp_init();
+	GFXDisplayInit(&refLcd, &GFX_DISPLAY_DESC_DEFAULT, refBuffer, refDirty, NULL);
+	refLcd.flushMode = GFX_FLUSH_DEFERRED;		//painted to compare with the panel, never sent
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+
+	GFXDisplayPowerOn();
+	printf("%s %ux%u, BloodPressure_GUI screen as a widget tree", GFXDisplayGetDesc()->name, GFXDisplayGetLCDWidth(), GFXDisplayGetLCDHeight());
+	ok &= runScenario(GFXDisplayGetSelected(), "full frame buffer");
+	ok &= compareField();
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+
+	GFXDisplayInitBanded(&bandLcd, &GFX_DISPLAY_DESC_DEFAULT, band, 16, list, sizeof(list), bandDirty, NULL);
+	ok &= runScenario(&bandLcd, "banded, 16 lines");
+
+	printf("%s\n", ok ? "ok" : "FAILED");
+	return ok ? 0 : 1;
+}
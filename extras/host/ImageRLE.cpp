@@ -0,0 +1,218 @@
+/**
+ * @brief	Host side TIMAGE_RLE encoder and image loaders, see ImageRLE.h
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "ImageRLE.h"
+
+/**
+ * @brief	Local function to append a literal run of len bytes
+ */
+static size_t rleLiteral(const uint8_t *src, size_t len, uint8_t *out)
+{
+	out[0] = (uint8_t)(len - 1);
+	memcpy(&out[1], src, len);
+	return len + 1;
+}
+
+size_t image_rle_encode(const uint8_t *raw, uint16_t width, uint16_t height, uint8_t *out)
+{
+	const uint16_t bytesPerLine = (width+7)/8;
+	size_t size = 0;
+
+	for(uint16_t y = 0; y < height; y++, raw += bytesPerLine)
+	{
+		uint16_t i = 0, litStart = 0;
+
+		if(y && (memcmp(raw, raw - bytesPerLine, bytesPerLine) == 0))
+		{
+			out[size++] = 0x80;		//same as the row above
+			continue;
+		}
+
+		while(i < bytesPerLine)
+		{
+			uint16_t run = 1;
+			while((i + run < bytesPerLine) && (raw[i + run] == raw[i]) && (run < 128))
+				run++;
+
+			//a repeat run of 2 only pays off when no literal run is open
+			if((run >= 3) || ((run == 2) && (litStart == i)))
+			{
+				if(litStart < i)
+					size += rleLiteral(&raw[litStart], i - litStart, &out[size]);
+				out[size++] = (uint8_t)(1 - run);
+				out[size++] = raw[i];
+				i += run;
+				litStart = i;
+			}
+			else
+			{
+				i++;
+				if(i - litStart == 128)
+				{
+					size += rleLiteral(&raw[litStart], 128, &out[size]);
+					litStart = i;
+				}
+			}
+		}
+		if(litStart < i)
+			size += rleLiteral(&raw[litStart], i - litStart, &out[size]);
+	}
+	return size;
+}
+
+size_t image_rle_size(const uint8_t *data, uint16_t width, uint16_t height)
+{
+	const uint16_t bytesPerLine = (width+7)/8;
+	size_t size = 0;
+
+	for(uint16_t y = 0; y < height; y++)
+	{
+		if(data[size] == 0x80)
+		{
+			if(y == 0)		//no row above to repeat
+				return 0;
+			size++;
+			continue;
+		}
+		for(uint16_t i = 0; i < bytesPerLine; )
+		{
+			int8_t n = (int8_t)data[size++];
+			if(n >= 0)
+			{
+				size += n + 1;
+				i += n + 1;
+			}
+			else if(n != -128)
+			{
+				size++;
+				i += 1 - n;
+			}
+			else	//only valid as the first byte of a row
+				return 0;
+			if(i > bytesPerLine)	//a run across two rows
+				return 0;
+		}
+	}
+	return size;
+}
+
+static uint32_t bmpU32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+static uint16_t bmpU16(const uint8_t *p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+
+uint8_t* image_load_bmp(const char *path, uint16_t *pWidth, uint16_t *pHeight)
+{
+	FILE *fp = fopen(path, "rb");
+	if(fp == NULL)
+		return NULL;
+
+	fseek(fp, 0, SEEK_END);
+	long fileSize = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	uint8_t *file = (uint8_t *)malloc(fileSize);
+	bool ok = (file != NULL) && (fread(file, 1, fileSize, fp) == (size_t)fileSize) && (fileSize > 62) &&
+			  (file[0] == 'B') && (file[1] == 'M');
+	fclose(fp);
+
+	uint8_t *raw = NULL;
+	if(ok && (bmpU16(&file[28]) == 1) && (bmpU32(&file[30]) == 0))		//1-bpp, no compression
+	{
+		uint32_t offset = bmpU32(&file[10]), dibSize = bmpU32(&file[14]);
+		int32_t width = (int32_t)bmpU32(&file[18]), height = (int32_t)bmpU32(&file[22]);
+		bool bottomUp = (height > 0);
+		height = bottomUp ? height : -height;
+
+		uint32_t stride = ((width + 31) / 32) * 4, bytesPerLine = (width + 7) / 8;
+		const uint8_t *palette = &file[14 + dibSize];
+		bool white[2];
+		for(uint8_t i = 0; i < 2; i++)
+			white[i] = (palette[4*i] + palette[4*i+1] + palette[4*i+2]) >= 3*128;
+
+		if((width > 0) && (width <= 0xFFFF) && (height <= 0xFFFF) && (offset + stride * height <= (uint32_t)fileSize))
+		{
+			raw = (uint8_t *)malloc(bytesPerLine * height);
+			memset(raw, 0xFF, bytesPerLine * height);	//padding bits of the last byte stay white
+			for(int32_t y = 0; y < height; y++)
+			{
+				const uint8_t *src = &file[offset + stride * (bottomUp ? (height - 1 - y) : y)];
+				for(int32_t x = 0; x < width; x++)
+				{
+					if(!white[(src[x >> 3] >> (7 - (x & 7))) & 0x01])
+						raw[y * bytesPerLine + (x >> 3)] &= (uint8_t)~(0x80 >> (x & 7));
+				}
+			}
+			*pWidth = (uint16_t)width;
+			*pHeight = (uint16_t)height;
+		}
+	}
+	free(file);
+	return raw;
+}
+
+uint8_t* image_load_c(const char *path, uint16_t *pWidth, uint16_t *pHeight, char *name, size_t nameSize)
+{
+	FILE *fp = fopen(path, "rb");
+	if(fp == NULL)
+		return NULL;
+
+	fseek(fp, 0, SEEK_END);
+	long fileSize = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	char *text = (char *)calloc(fileSize + 1, 1);
+	size_t len = fread(text, 1, fileSize, fp);
+	fclose(fp);
+
+	uint8_t *raw = NULL;
+	char *data = strstr(text, "image_data_");
+	char *image = strstr(text, "const tImage ");
+	unsigned width = 0, height = 0;
+	char tag[128];
+
+	if((len == (size_t)fileSize) && (data != NULL) && (image != NULL) &&
+	   (sscanf(image, "const tImage %127s = { %*[^,], %u, %u", tag, &width, &height) == 3) && width && height)
+	{
+		uint32_t bytesPerLine = (width + 7) / 8, count = 0, size = bytesPerLine * height;
+		char *p = strchr(data, '{');
+
+		raw = (uint8_t *)malloc(size);
+		for(; (p != NULL) && (*p != '}') && (count < size); p++)
+		{
+			if((p[0] == '0') && ((p[1] == 'x') || (p[1] == 'X')))
+			{
+				raw[count++] = (uint8_t)strtoul(p, &p, 16);
+				p--;
+			}
+		}
+		if(count != size)
+		{
+			free(raw);
+			raw = NULL;
+		}
+		else
+		{
+			*pWidth = (uint16_t)width;
+			*pHeight = (uint16_t)height;
+			snprintf(name, nameSize, "%s", tag);
+		}
+	}
+	free(text);
+	return raw;
+}
+
+void image_rle_write_c(FILE *fp, const char *name, const char *source, const uint8_t *data, size_t size, uint16_t width, uint16_t height)
+{
+	fprintf(fp, "/*******************************************************************************\n");
+	fprintf(fp, "* generated by extras/host/image_rle.cpp from %s\n", source);
+	fprintf(fp, "* image: %s, %ux%u\n", name, width, height);
+	fprintf(fp, "* TIMAGE_RLE: PackBits per row, %u bytes, %u bytes uncompressed\n", (unsigned)size, (unsigned)((width + 7) / 8 * height));
+	fprintf(fp, "*******************************************************************************/\n\n");
+	fprintf(fp, "#include <stdint.h>\n#include <tImage.h>\n\n");
+	fprintf(fp, "static const uint8_t image_data_%s[%u] = {", name, (unsigned)size);
+	for(size_t i = 0; i < size; i++)
+		fprintf(fp, "%s0x%02x%s", (i % 16) ? " " : "\n    ", data[i], (i + 1 < size) ? "," : "");
+	fprintf(fp, "\n};\n");
+	fprintf(fp, "const tImage %s = { image_data_%s, %u, %u,\n    8, TIMAGE_RLE };\n", name, name, width, height);
+	fprintf(fp, "\n");
+}
@@ -0,0 +1,57 @@
+/**
+ * @brief	Host side TIMAGE_RLE encoder and image loaders used by image_rle.cpp and the benchmarks.
+ *			Raw images are rows of (width+7)/8 bytes, leftmost pixel in the MSB and bit set for white, the same as
+ *			tImage.data generated by lcd-image-converter.
+ * @note	PackBits format of TIMAGE_RLE is described in src/tImage.h.
+ */
+
+#ifndef IMAGE_RLE_H
+#define IMAGE_RLE_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include "tImage.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//@note Worst case size of a compressed image, one header byte for every 128 bytes of a row more than the raw data
+#define IMAGE_RLE_MAX_SIZE(width, height)	((size_t)(height) * ((((width)+7)/8) + ((((width)+7)/8)+127)/128))
+
+/**
+ * @brief	Compress a raw image
+ * @param	*out receives the TIMAGE_RLE data, at least IMAGE_RLE_MAX_SIZE(width, height) bytes
+ * @return	number of bytes written to out
+ */
+size_t image_rle_encode(const uint8_t *raw, uint16_t width, uint16_t height, uint8_t *out);
+
+/**
+ * @return	number of bytes of TIMAGE_RLE data, 0 if the data is not valid for the image size
+ */
+size_t image_rle_size(const uint8_t *data, uint16_t width, uint16_t height);
+
+/**
+ * @brief	Load a 1-bpp .bmp file, palette entries brighter than mid grey are white
+ * @return	malloc'ed raw image, NULL if the file cannot be read or is not 1-bpp
+ */
+uint8_t* image_load_bmp(const char *path, uint16_t *pWidth, uint16_t *pHeight);
+
+/**
+ * @brief	Load the first image of a .c file generated by lcd-image-converter (tImage, 8-bit blocks, split to rows)
+ * @param	*name receives the tImage name, nameSize bytes
+ * @return	malloc'ed raw image, NULL if the file cannot be parsed
+ */
+uint8_t* image_load_c(const char *path, uint16_t *pWidth, uint16_t *pHeight, char *name, size_t nameSize);
+
+/**
+ * @brief	Write a .c file defining a TIMAGE_RLE tImage
+ * @param	*source is named in the file header
+ */
+void image_rle_write_c(FILE *fp, const char *name, const char *source, const uint8_t *data, size_t size, uint16_t width, uint16_t height);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,575 @@
+/**
+ * @brief	Host HAL backend and Memory LCD protocol simulator, see MemoryLCDSim.h
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "MemoryLCDSim.h"
+
+//@note Largest transaction is a full screen update: header + payload per line and 2 dummy bytes
+#define SIM_TRANSACTION_SIZE	(SIM_MAX_LINES * (SIM_MAX_LINE_BYTES + 2) + 16)
+
+typedef enum
+{
+	SIM_IDLE = 0,		//SCS low
+	SIM_MODE,			//waiting for the first byte (mode bits)
+	SIM_ADDRESS,		//waiting for the 2nd header byte of a line
+	SIM_PAYLOAD,		//receiving pixel data of a line
+	SIM_NEXT_HEADER,	//waiting for the 1st byte of the next line header or the 1st dummy byte
+	SIM_NEXT_ADDRESS,	//waiting for the 2nd byte of the next line header or the 2nd dummy byte
+	SIM_DUMMY,			//trailing dummy bytes only
+} SIM_STATE;
+
+static uint8_t panel[SIM_MAX_LINES][SIM_MAX_LINE_BYTES];	//pixel memory of the virtual panel, same bit order as frameBuffer
+static const GFX_DISPLAY_DESC *pPanelDesc;	//geometry of the panel, taken from the selected display on SCS rising edge
+static SIM_COUNTERS counters;
+static uint64_t timeNs;
+static bool scs, disp, extcomin, vcom;
+static bool extMode = true;		//EXTMODE pin: true = VCOM from EXTCOMIN, false = VCOM from the M1 bit
+static uint64_t vcomChangeNs;	//simulated time of the last VCOM inversion
+
+static SIM_STATE state = SIM_IDLE;
+static uint8_t headerByte;		//1st byte of the current line header
+static uint16_t lineIndex;		//0-based panel row receiving payload
+static uint16_t payloadCount;
+
+static uint8_t transaction[SIM_TRANSACTION_SIZE];
+static uint32_t transactionLen;
+static uint8_t lastTransaction[SIM_TRANSACTION_SIZE];
+static uint32_t lastTransactionLen;
+
+static SIM_EDGE edgeLog[SIM_EDGE_LOG_SIZE];
+static uint16_t edgeCount;		//edges stored, up to SIM_EDGE_LOG_SIZE
+static uint16_t edgeNext;		//next slot to write
+
+static FILE *traceFp = NULL;
+
+static bool dmaEnabled = true;
+static bool dmaPending = false;
+static const uint8_t *dmaBuf;
+static uint32_t dmaLen;
+static void (*dmaDone)(void);
+
+static void simVcom(bool level)
+{
+	if(level == vcom)
+		return;
+	vcom = level;
+	vcomChangeNs = timeNs;
+	counters.vcomInversions++;
+}
+
+static void simEdge(uint8_t pin, bool level)
+{
+	bool *pState;
+	uint32_t *pCount;
+
+	if(pin == GFX_DISPLAY_SCS)
+	{
+		pState = &scs; pCount = &counters.scsEdges;
+	}
+	else if(pin == GFX_DISPLAY_DISP)
+	{
+		pState = &disp; pCount = &counters.dispEdges;
+	}
+	else if(pin == GFX_DISPLAY_EXTCOMIN)
+	{
+		pState = &extcomin; pCount = &counters.extcominEdges;
+	}
+	else
+	{
+		return;
+	}
+
+	if(*pState == level)
+		return;
+
+	*pState = level;
+	(*pCount)++;
+
+	if(pin == GFX_DISPLAY_EXTCOMIN && level && extMode)
+		simVcom(!vcom);	//EXTCOMIN mode: VCOM inverts on every rising edge
+
+	edgeLog[edgeNext].timeNs = timeNs;
+	edgeLog[edgeNext].pin = pin;
+	edgeLog[edgeNext].level = level;
+	edgeNext = (edgeNext + 1) % SIM_EDGE_LOG_SIZE;
+	if(edgeCount < SIM_EDGE_LOG_SIZE)
+		edgeCount++;
+
+	if(traceFp)
+		fprintf(traceFp, "%12llu ns  pin %u -> %u\n", (unsigned long long)timeNs, pin, level ? 1 : 0);
+}
+
+/**
+ * @brief	Gate address of a 2-byte line header, 8-bit or 10-bit (AG0:AG1 in bits 7:6 of the 1st byte for LS032B7DD02 and LS018B7DH02)
+ */
+static uint16_t simGateAddress(uint8_t first, uint8_t second)
+{
+	if(pPanelDesc->addressBits == 10)
+		return (uint16_t)((first >> 6) | ((uint16_t)second << 2));
+	return second;
+}
+
+/**
+ * @brief	Start receiving a line, or the trailer when the address is 0
+ */
+static void simLineAddress(uint16_t address)
+{
+	if(address == 0)
+	{
+		counters.dummyBytes += 2;
+		state = SIM_DUMMY;
+		return;
+	}
+
+	counters.headerBytes += 2;
+
+	if(address > pPanelDesc->height)
+	{
+		counters.protocolErrors++;
+		state = SIM_DUMMY;
+		return;
+	}
+
+	lineIndex = address - 1;
+	payloadCount = 0;
+	state = SIM_PAYLOAD;
+}
+
+static void simByte(uint8_t val)
+{
+	counters.bytes++;
+	timeNs += 8ULL * 1000000000ULL / SIM_SPI_HZ;
+	counters.busTimeNs += 8ULL * 1000000000ULL / SIM_SPI_HZ;
+
+	if(transactionLen < SIM_TRANSACTION_SIZE)
+		transaction[transactionLen++] = val;
+
+	switch(state)
+	{
+	case SIM_IDLE:
+		counters.protocolErrors++;	//data clocked with SCS low is ignored by the panel
+		break;
+
+	case SIM_MODE:
+		if(!extMode)
+			simVcom((val & 0x02) != 0);	//M1
+		headerByte = val;
+		if(val & 0x01)				//M0 = data update
+		{
+			state = SIM_ADDRESS;
+		}
+		else if(val & 0x04)			//M2 = all clear
+		{
+			memset(panel, 0xFF, sizeof(panel));
+			counters.allClears++;
+			counters.headerBytes++;
+			state = SIM_DUMMY;
+		}
+		else						//display mode, VCOM maintenance only
+		{
+			counters.displayModes++;
+			counters.headerBytes++;
+			state = SIM_DUMMY;
+		}
+		break;
+
+	case SIM_ADDRESS:
+		simLineAddress(simGateAddress(headerByte, val));
+		if(state == SIM_DUMMY)		//address 0 right after the mode byte
+			counters.protocolErrors++;
+		break;
+
+	case SIM_PAYLOAD:
+		panel[lineIndex][payloadCount++] = val;
+		counters.payloadBytes++;
+		if(payloadCount == pPanelDesc->bytesPerLine)
+		{
+			counters.linesWritten++;
+			state = SIM_NEXT_HEADER;
+		}
+		break;
+
+	case SIM_NEXT_HEADER:
+		headerByte = val;
+		state = SIM_NEXT_ADDRESS;
+		break;
+
+	case SIM_NEXT_ADDRESS:
+		simLineAddress(simGateAddress(headerByte, val));
+		break;
+
+	case SIM_DUMMY:
+		counters.dummyBytes++;
+		break;
+	}
+}
+
+/**
+ * @brief	Reset the counters, e.g. before an API call to measure
+ */
+void sim_counters_reset(void)
+{
+	memset(&counters, 0, sizeof(counters));
+}
+
+/**
+ * @brief	Copy the counters accumulated since the last sim_counters_reset()
+ */
+void sim_get_counters(SIM_COUNTERS *pCounters)
+{
+	*pCounters = counters;
+}
+
+/**
+ * @brief	Print counters in one line
+ */
+void sim_print_counters(FILE *fp, const char *label, const SIM_COUNTERS *pCounters)
+{
+	fprintf(fp, "%-60.60s tx %4u  lines %4u  bytes %6u (hdr %5u data %6u dmy %4u)  calls %6u  bus %8.3f ms%s\n",
+			label, pCounters->transactions, pCounters->linesWritten, pCounters->bytes,
+			pCounters->headerBytes, pCounters->payloadBytes, pCounters->dummyBytes, pCounters->writeCalls,
+			pCounters->busTimeNs / 1e6, pCounters->protocolErrors ? "  PROTOCOL ERROR" : "");
+}
+
+/**
+ * @brief	Simulated time since start in nanosec
+ */
+uint64_t sim_time_ns(void)
+{
+	return timeNs;
+}
+
+/**
+ * @brief	Current level of GFX_DISPLAY_SCS, GFX_DISPLAY_DISP or GFX_DISPLAY_EXTCOMIN
+ */
+bool sim_pin_level(uint8_t pin)
+{
+	if(pin == GFX_DISPLAY_SCS) return scs;
+	if(pin == GFX_DISPLAY_DISP) return disp;
+	if(pin == GFX_DISPLAY_EXTCOMIN) return extcomin;
+	return false;
+}
+
+/**
+ * @brief	Current VCOM polarity seen by the panel, from the M1 bit or EXTCOMIN rising edges
+ */
+bool sim_vcom(void)
+{
+	return vcom;
+}
+
+/**
+ * @brief	Simulated time since the last VCOM inversion, the time the panel has been driven with one polarity
+ */
+uint64_t sim_vcom_age_ns(void)
+{
+	return timeNs - vcomChangeNs;
+}
+
+/**
+ * @brief	Select how the virtual panel takes VCOM, the same as wiring the EXTMODE pin
+ * @param	high is true for EXTCOMIN (default), false for the M1 bit of the serial data
+ */
+void sim_set_extmode(bool high)
+{
+	extMode = high;
+}
+
+/**
+ * @brief	Access the edge log
+ * @param	**ppLog receives the ring buffer of SIM_EDGE_LOG_SIZE entries
+ * @param	*pFirst receives the index of the oldest entry
+ * @return	number of valid entries
+ */
+uint16_t sim_edge_log(const SIM_EDGE **ppLog, uint16_t *pFirst)
+{
+	*ppLog = edgeLog;
+	*pFirst = (edgeCount < SIM_EDGE_LOG_SIZE) ? 0 : edgeNext;
+	return edgeCount;
+}
+
+/**
+ * @brief	Bytes of the last complete transaction (SCS high to SCS low)
+ */
+const uint8_t* sim_last_transaction(uint32_t *pLen)
+{
+	*pLen = lastTransactionLen;
+	return lastTransaction;
+}
+
+/**
+ * @brief	Print every edge and transaction to fp, NULL to stop tracing
+ */
+void sim_trace(FILE *fp)
+{
+	traceFp = fp;
+}
+
+/**
+ * @brief	Pixel of the virtual panel, true for white
+ */
+bool sim_get_pixel(uint16_t x, uint16_t y)
+{
+	const GFX_DISPLAY_DESC *pDesc = GFXDisplayGetDesc();
+
+	if(y > (pDesc->height-1) || (x >> 3) > (pDesc->bytesPerLine-1))
+		return false;
+	return (panel[y][x >> 3] >> (x & 0x07)) & 0x01;
+}
+
+/**
+ * @brief	Row y (0-based) of the virtual panel in frameBuffer layout
+ */
+const uint8_t* sim_panel_line(uint16_t y)
+{
+	return panel[y];
+}
+
+/**
+ * @brief	Compare the virtual panel with the frame buffer of the selected display
+ * @return	number of lines that differ, e.g. lines still waiting for GFXDisplayFlush(). 0xFFFF for a banded display, it
+ *			has no frame buffer of the whole screen: compare with a display of the same model drawn the same way instead.
+ */
+uint16_t sim_compare_framebuffer(void)
+{
+	const GFX_DISPLAY *pDisplay = GFXDisplayGetSelected();
+	const GFX_DISPLAY_DESC *pDesc = pDisplay->pDesc;
+	uint16_t diff = 0;
+
+	if(pDisplay->bandLines)
+		return 0xFFFF;
+
+	for(uint16_t y = 0; y < pDesc->height; y++)
+	{
+		if(memcmp(panel[y], GFXDisplayGetRow(y), pDesc->bytesPerLine) != 0)	//through the scroll region
+			diff++;
+	}
+	return diff;
+}
+
+/**
+ * @brief	Compare the frame buffer of the selected display with a reference drawn by hand
+ * @param	*ref is pDesc->height rows of pDesc->bytesPerLine bytes one after the other, whatever the frame buffer layout
+ * @return	number of rows that differ, 0xFFFF for a banded display
+ */
+uint16_t sim_compare_rows(const uint8_t *ref)
+{
+	const GFX_DISPLAY *pDisplay = GFXDisplayGetSelected();
+	const GFX_DISPLAY_DESC *pDesc = pDisplay->pDesc;
+	uint16_t diff = 0;
+
+	if(pDisplay->bandLines)
+		return 0xFFFF;
+
+	for(uint16_t y = 0; y < pDesc->height; y++, ref += pDesc->bytesPerLine)
+	{
+		if(memcmp(ref, GFXDisplayGetRow(y), pDesc->bytesPerLine) != 0)
+			diff++;
+	}
+	return diff;
+}
+
+/**
+ * @brief	Dump the virtual panel as a binary PBM (P4) image, black pixels written as 1
+ */
+bool sim_write_pbm(const char *path)
+{
+	FILE *fp = fopen(path, "wb");
+
+	if(fp == NULL)
+		return false;
+
+	const GFX_DISPLAY_DESC *pDesc = GFXDisplayGetDesc();
+
+	fprintf(fp, "P4\n%u %u\n", pDesc->width, pDesc->height);
+	for(uint16_t y = 0; y < pDesc->height; y++)
+	{
+		for(uint16_t col = 0; col < (pDesc->width + 7) / 8; col++)
+		{
+			uint8_t b = panel[y][col], out = 0;
+
+			for(uint8_t bit = 0; bit < 8; bit++)	//LSB is the leftmost pixel on the panel, MSB in PBM
+				out |= ((b >> bit) & 0x01) << (7 - bit);
+			fputc(out ^ 0xFF, fp);
+		}
+	}
+	fclose(fp);
+	return true;
+}
+
+/**
+ * @brief	Run the EXTCOMIN timer callback once, the host has no timer interrupt
+ */
+void sim_extcom_tick(void)
+{
+	hal_extcom_toggle();
+}
+
+/**
+ * @brief	Emulate a platform with or without DMA transport
+ * @param	enable is true (default) to accept hal_spi_write_dma() transfers, false to make it return false
+ */
+void sim_dma_enable(bool enable)
+{
+	dmaEnabled = enable;
+}
+
+/**
+ * @brief	Return true while a transfer started by hal_spi_write_dma() is waiting for sim_dma_complete()
+ */
+bool sim_dma_pending(void)
+{
+	return dmaPending;
+}
+
+/**
+ * @brief	Complete the pending DMA transfer: its bytes are clocked out as the buffer reads now, then its callback runs
+ * @return	false if no transfer was pending
+ */
+bool sim_dma_complete(void)
+{
+	if(!dmaPending)
+		return false;
+
+	for(uint32_t i = 0; i < dmaLen; i++)
+		simByte(dmaBuf[i]);
+	dmaPending = false;
+	if(dmaDone)
+		dmaDone();
+	return true;
+}
+
+/**
+ * @brief	SPI use by the CPU while a DMA transfer owns the bus
+ */
+static void simBusCheck(void)
+{
+	if(dmaPending)
+		counters.protocolErrors++;
+}
+
+/**
+********************************************************************************************************
+* @note	HAL functions for the host
+********************************************************************************************************
+*/
+void hal_bsp_init(void)
+{
+	memset(panel, 0x00, sizeof(panel));	//pixel memory is undefined at power up, start black to expose lines never written
+	scs = disp = extcomin = vcom = false;
+	state = SIM_IDLE;
+	timeNs = vcomChangeNs = 0;
+	edgeCount = edgeNext = 0;
+	transactionLen = lastTransactionLen = 0;
+	dmaPending = false;
+	sim_counters_reset();
+}
+
+void hal_gpio_write(uint8_t pin, bool level)
+{
+	simEdge(pin, level);
+}
+
+void hal_delayMs(uint32_t ms)
+{
+	timeNs += (uint64_t)ms * 1000000ULL;
+	counters.busTimeNs += (uint64_t)ms * 1000000ULL;
+}
+
+void hal_delayUs(uint32_t us)
+{
+	timeNs += (uint64_t)us * 1000ULL;
+	counters.busTimeNs += (uint64_t)us * 1000ULL;
+}
+
+uint32_t hal_millis(void)
+{
+	return (uint32_t)(timeNs / 1000000ULL);
+}
+
+void hal_spi_start_transaction(void)
+{
+	simBusCheck();
+	if(state != SIM_IDLE)
+		counters.protocolErrors++;
+
+	simEdge(GFX_DISPLAY_SCS, true);
+	counters.transactions++;
+	pPanelDesc = GFXDisplayGetDesc();
+	transactionLen = 0;
+	state = SIM_MODE;
+}
+
+void hal_spi_end_transaction(void)
+{
+	//a transaction must end after its dummy bytes, a data update needs the 16-bit trailer
+	simBusCheck();
+	if(state != SIM_DUMMY && state != SIM_IDLE)
+		counters.protocolErrors++;
+
+	simEdge(GFX_DISPLAY_SCS, false);
+	state = SIM_IDLE;
+
+	memcpy(lastTransaction, transaction, transactionLen);
+	lastTransactionLen = transactionLen;
+
+	if(traceFp)
+	{
+		fprintf(traceFp, "%12llu ns  transaction %u bytes:", (unsigned long long)timeNs, transactionLen);
+		for(uint32_t i = 0; i < transactionLen && i < 64; i++)
+			fprintf(traceFp, " %02X", transaction[i]);
+		fprintf(traceFp, "%s\n", transactionLen > 64 ? " ..." : "");
+	}
+}
+
+void hal_spi_write_byte(uint8_t val)
+{
+	simBusCheck();
+	counters.writeCalls++;
+	simByte(val);
+}
+
+void hal_spi_write_buffer(const uint8_t *buf, uint16_t len)
+{
+	simBusCheck();
+	counters.writeCalls++;
+	while(len--)
+		simByte(*buf++);
+}
+
+bool hal_spi_write_dma(const uint8_t *buf, uint32_t len, void (*pfcnDone)(void))
+{
+	if(!dmaEnabled)
+		return false;
+
+	simBusCheck();
+	counters.writeCalls++;
+	counters.dmaTransfers++;
+	dmaBuf = buf;
+	dmaLen = len;
+	dmaDone = pfcnDone;
+	dmaPending = true;
+	return true;
+}
+
+void hal_spi_dma_wait(void)
+{
+	sim_dma_complete();
+}
+
+void hal_extcom_start(uint8_t hz)
+{
+	(void)hz;	//no timer on the host, call sim_extcom_tick() to toggle EXTCOMIN
+}
+
+void hal_extcom_stop(void)
+{
+	simEdge(GFX_DISPLAY_EXTCOMIN, false);
+}
+
+void hal_extcom_toggle(void)
+{
+	simEdge(GFX_DISPLAY_EXTCOMIN, !extcomin);
+}
@@ -0,0 +1,96 @@
+/**
+ * @brief	Host HAL backend and Memory LCD protocol simulator.
+ *			Link MemoryLCDSim.cpp instead of the Arduino HAL to run src/MemoryLCD.cpp on a Linux/macOS workstation.
+ *			The HAL records the SPI byte stream and the SCS/DISP/EXTCOMIN edges, decodes M0/M1/M2 mode bits and
+ *			8-bit or 10-bit (LS032B7DD02, LS018B7DH02) gate addresses into a virtual panel, and counts bytes/transactions per API call.
+ *			The panel takes the geometry of the display selected with GFXDisplaySelect() at the start of each transaction.
+ *			hal_spi_write_dma() is emulated: the bytes are clocked out when the transfer completes, from sim_dma_complete() or
+ *			hal_spi_dma_wait(), so changes to a buffer still owned by the transfer show on the panel.
+ * @note	Build with the gcc driver so the .c font and image files of the examples compile as C, the default model is selected with -D<br>
+ *			(e.g. -DLS032B7DD02). sim_demo.cpp in this folder shows a complete build command.
+ */
+
+#ifndef MEMORY_LCD_SIM_H
+#define MEMORY_LCD_SIM_H
+
+#include <stdio.h>
+#include "MemoryLCD.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//@note SPI clock used to estimate bus time, the same GFX_SPI_CLOCK_HZ as spiSettings of the Arduino HAL
+#define SIM_SPI_HZ			GFX_SPI_CLOCK_HZ
+//@note Number of SCS/DISP/EXTCOMIN edges kept in the edge log, older edges are overwritten
+#define SIM_EDGE_LOG_SIZE	256
+
+//@note Size of the virtual panel memory, large enough for every model with a GFX_DISPLAY_DESC
+#define SIM_MAX_LINES			1024
+#define SIM_MAX_LINE_BYTES		64
+
+/**
+ * @note	Counters accumulated since the last sim_counters_reset()
+ */
+typedef struct
+{
+	uint32_t transactions;		//SCS high windows
+	uint32_t bytes;				//all bytes clocked out on MOSI
+	uint32_t headerBytes;		//mode and gate address bytes
+	uint32_t payloadBytes;		//pixel data bytes
+	uint32_t dummyBytes;		//trailing dummy bytes
+	uint32_t linesWritten;		//lines decoded by the panel
+	uint32_t allClears;			//M2 commands
+	uint32_t displayModes;		//commands with M0=M2=0 (VCOM maintenance only)
+	uint32_t vcomInversions;	//VCOM polarity changes, from the M1 bit or EXTCOMIN
+	uint32_t writeCalls;		//hal_spi_write_byte() + hal_spi_write_buffer() calls
+	uint32_t protocolErrors;	//malformed or incomplete transactions, SPI use while a DMA transfer is pending
+	uint32_t dmaTransfers;		//hal_spi_write_dma() transfers started
+	uint32_t scsEdges;
+	uint32_t dispEdges;
+	uint32_t extcominEdges;
+	uint64_t busTimeNs;			//SPI clocking at SIM_SPI_HZ plus hal_delayUs()/hal_delayMs() time
+} SIM_COUNTERS;
+
+typedef struct
+{
+	uint64_t timeNs;			//simulated time of the edge
+	uint8_t pin;				//GFX_DISPLAY_SCS, GFX_DISPLAY_DISP or GFX_DISPLAY_EXTCOMIN
+	uint8_t level;
+} SIM_EDGE;
+
+void		sim_counters_reset(void);
+void		sim_get_counters(SIM_COUNTERS *pCounters);
+void		sim_print_counters(FILE *fp, const char *label, const SIM_COUNTERS *pCounters);
+
+uint64_t	sim_time_ns(void);
+bool		sim_pin_level(uint8_t pin);
+bool		sim_vcom(void);
+uint64_t	sim_vcom_age_ns(void);
+void		sim_set_extmode(bool high);
+uint16_t	sim_edge_log(const SIM_EDGE **ppLog, uint16_t *pFirst);
+const uint8_t* sim_last_transaction(uint32_t *pLen);
+void		sim_trace(FILE *fp);
+
+bool		sim_get_pixel(uint16_t x, uint16_t y);
+const uint8_t* sim_panel_line(uint16_t y);
+uint16_t	sim_compare_framebuffer(void);
+uint16_t	sim_compare_rows(const uint8_t *ref);
+bool		sim_write_pbm(const char *path);
+void		sim_extcom_tick(void);
+
+void		sim_dma_enable(bool enable);
+bool		sim_dma_pending(void);
+bool		sim_dma_complete(void);
+
+/**
+ * @note	Run an API call and print the bytes and transactions it caused, e.g.
+ *			SIM_REPORT(GFXDisplayPutString(0,0,&fontConsolas24h,"Hello",BLACK,WHITE));
+ */
+#define SIM_REPORT(call)	do { SIM_COUNTERS _c; sim_counters_reset(); call; sim_get_counters(&_c); sim_print_counters(stdout, #call, &_c); } while(0)
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,60 @@
+/**
+ * @brief	Convert a 1-bpp .bmp image or a .c image generated by lcd-image-converter into a TIMAGE_RLE tImage.
+ *			The .c file is written to stdout, sizes before and after compression to stderr.
+ * @note	Build and run from the library folder on a Linux/macOS host:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/host/image_rle.cpp extras/host/ImageRLE.cpp -lstdc++ -o image_rle<br>
+ *			./image_rle examples/HelloWorld_v2/qr_code_248x248.bmp qr_code_248x248_rle > examples/HelloWorld_v2/qr_code_248x248_rle.c<br>
+ *			The tImage is named after the file (.bmp) or the tImage in it (.c) with _rle appended, unless a name is given.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ImageRLE.h"
+
+int main(int argc, char *argv[])
+{
+	if(argc < 2)
+	{
+		fprintf(stderr, "usage: %s <image.bmp|image.c> [name] > image_rle.c\n", argv[0]);
+		return 2;
+	}
+
+	const char *path = argv[1], *ext = strrchr(path, '.');
+	const char *base = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+	uint16_t width = 0, height = 0;
+	char name[128];
+	uint8_t *raw;
+
+	if((ext != NULL) && (strcmp(ext, ".c") == 0))
+	{
+		raw = image_load_c(path, &width, &height, name, sizeof(name) - 4);
+	}
+	else
+	{
+		snprintf(name, sizeof(name) - 4, "%.*s", (int)(ext ? (ext - base) : strlen(base)), base);
+		raw = image_load_bmp(path, &width, &height);
+	}
+	if(raw == NULL)
+	{
+		fprintf(stderr, "%s: not a 1-bpp .bmp or an lcd-image-converter .c image\n", path);
+		return 1;
+	}
+
+	if(argc > 2)
+		snprintf(name, sizeof(name), "%s", argv[2]);
+	else
+		strcat(name, "_rle");
+
+	uint8_t *rle = (uint8_t *)malloc(IMAGE_RLE_MAX_SIZE(width, height));
+	size_t size = image_rle_encode(raw, width, height, rle);
+	size_t rawSize = (size_t)(width + 7) / 8 * height;
+
+	image_rle_write_c(stdout, name, base, rle, size, width, height);
+	fprintf(stderr, "%s: %ux%u, %u bytes raw, %u bytes TIMAGE_RLE (%.1f%%)%s\n", name, width, height, (unsigned)rawSize,
+			(unsigned)size, 100.0 * size / rawSize, (size >= rawSize) ? ", keep the raw image" : "");
+
+	free(rle);
+	free(raw);
+	return 0;
+}
@@ -0,0 +1,47 @@
+/**
+ * @brief	Run the HelloWorld drawing calls on the host simulator, print bytes and transactions per call and dump the panel.
+ * @note	Build and run from the library folder:<br>
+ *			gcc -O2 -Isrc -Iextras/host extras/host/sim_demo.cpp extras/host/MemoryLCDSim.cpp src/MemoryLCD.cpp src/bfcFontMgr.c \
+ *				examples/HelloWorld/Consolas24h.c examples/HelloWorld/Arial_Rounded_MT_Bold55h.c examples/HelloWorld/SimHei_35h.c \
+ *				examples/HelloWorld/qr_code_248x248.c -lstdc++ -o sim_demo && ./sim_demo panel.pbm<br>
+ *			Add -DLS032B7DD02 (or any other model) to simulate another panel.
+ */
+
+#include <stdio.h>
+#include "MemoryLCDSim.h"
+
+extern const BFC_FONT fontConsolas24h;
+extern const BFC_FONT fontArial_Rounded_MT_Bold55h;
+extern const BFC_FONT fontSimHei_35h;
+extern const tImage qr_code_248x248;
+
+const uint16_t hello_japanese[]={0x3053, 0x3093, 0x306B, 0x3061, 0x306F, '\0'};
+
+int main(int argc, char *argv[])
+{
+	hal_bsp_init();
+
+	SIM_REPORT(GFXDisplayPowerOn());
+	SIM_REPORT(GFXDisplayPutPixel(10, 10, BLACK));
+	SIM_REPORT(GFXDisplayLineDrawH(0, GFXDisplayGetLCDWidth()-1, 20, BLACK, 3));
+	SIM_REPORT(GFXDisplayLineDrawV(10, 0, GFXDisplayGetLCDHeight()-1, BLACK, 3));
+	SIM_REPORT(GFXDisplayDrawRect(30, 30, 120, 60, BLACK));
+	SIM_REPORT(GFXDisplayPutString(0, 70, &fontArial_Rounded_MT_Bold55h, "@123:{Hello}", BLACK, WHITE));
+	SIM_REPORT(GFXDisplayPutWString(10, 130, &fontSimHei_35h, hello_japanese, BLACK, WHITE));
+	SIM_REPORT(GFXDisplayPutString(10, 170, &fontConsolas24h, "Memory LCD simulator", BLACK, TRANSPARENT));
+	SIM_REPORT(GFXDisplayTestPattern(0xF0, NULL));
+	SIM_REPORT(GFXDisplayAllClear());
+	SIM_REPORT(GFXDisplayPutImage((GFXDisplayGetLCDWidth()-248)/2, 0, &qr_code_248x248, false));
+	SIM_REPORT(sim_extcom_tick());
+
+	uint16_t diff = sim_compare_framebuffer();
+	printf("Lines differing between panel and frameBuffer: %u\n", diff);
+
+	if(argc > 1 && !sim_write_pbm(argv[1]))
+	{
+		printf("Cannot write %s\n", argv[1]);
+		return 1;
+	}
+
+	return diff ? 1 : 0;
+}
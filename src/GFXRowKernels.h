@@ -0,0 +1,282 @@
+/**
+ * @brief	Frame buffer row kernels of the Memory LCD driver: fill, invert, copy, OR/AND/XOR merge and compare of a span
+ *			of whole bytes. Masked partial bytes at the ends of a span stay with the caller.<br>
+ *			Every kernel is written once over a word policy, the same way the drawing code is written over a geometry:<br>
+ *				GFXRowBytes = one byte at a time, the reference<br>
+ *				GFXRowWords = 32-bit words (SWAR) on word aligned addresses, for MCUs without unaligned loads<br>
+ *				GFXRowSSE2, GFXRowAVX2, GFXRowNEON = one vector register at a time, for hosts running the driver<br>
+ *			The kernels are checked against GFXRowBytes by extras/bench/bench_kernels.cpp, GFXRowNEON on hosts without NEON
+ *			too with the intrinsics it uses emulated.<br>
+ *			A policy handles the bulk of a span and hands what is left to its Tail policy, down to GFXRowBytes.
+ *			Fill and copy of the vector policies are left to memset() and memcpy(), which host C libraries already run on
+ *			vectors with tuned stores; the small C libraries of MCUs often store a byte at a time, GFXRowWords does not.
+ *			Rows of LS018B7DH02 (30 bytes) and other models whose rows are not a multiple of the word size start at any
+ *			address, so the byte head before the first aligned word is part of every kernel.
+ * @note	Internal to MemoryLCD.cpp and the host benchmarks in extras/bench, not part of the public API.
+ */
+
+#ifndef GFX_ROW_KERNELS_H
+#define GFX_ROW_KERNELS_H
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined (__AVX2__)
+	#include <immintrin.h>
+#endif
+#if defined (__SSE2__)
+	#include <emmintrin.h>
+#endif
+#if defined (__ARM_NEON) || defined (__ARM_NEON__)
+	#include <arm_neon.h>
+	#define GFX_ROW_NEON_TARGET	1
+	#define GFX_ROW_HAS_NEON	1	//defined by extras/bench/bench_kernels.cpp as well, with the intrinsics emulated on other hosts
+#endif
+
+struct GFXRowBytes
+{
+	typedef uint8_t Word;
+	typedef GFXRowBytes Tail;
+	enum { align = 1, libc = 0 };
+	static inline Word load(const uint8_t *p)		{ return *p; }
+	static inline void store(uint8_t *p, Word w)	{ *p = w; }
+	static inline Word splat(uint8_t b)				{ return b; }
+	static inline Word bitOr(Word a, Word b)		{ return a | b; }
+	static inline Word bitAnd(Word a, Word b)		{ return a & b; }
+	static inline Word bitXor(Word a, Word b)		{ return a ^ b; }
+	static inline bool isZero(Word w)				{ return w == 0; }
+};
+
+struct GFXRowWords
+{
+	typedef uint32_t __attribute__((__may_alias__)) Word;	//frame buffer bytes read and written as words
+	typedef GFXRowBytes Tail;
+	enum { align = 4, libc = 0 };
+	static inline Word load(const uint8_t *p)		{ return *(const Word *)p; }
+	static inline void store(uint8_t *p, Word w)	{ *(Word *)p = w; }
+	static inline Word splat(uint8_t b)				{ return 0x01010101UL * b; }
+	static inline Word bitOr(Word a, Word b)		{ return a | b; }
+	static inline Word bitAnd(Word a, Word b)		{ return a & b; }
+	static inline Word bitXor(Word a, Word b)		{ return a ^ b; }
+	static inline bool isZero(Word w)				{ return w == 0; }
+};
+
+#if defined (__SSE2__)
+struct GFXRowSSE2
+{
+	typedef __m128i Word;
+	typedef GFXRowWords Tail;
+	enum { align = 1, libc = 1 };		//unaligned loads and stores, fill and copy by the C library
+	static inline Word load(const uint8_t *p)		{ return _mm_loadu_si128((const __m128i *)p); }
+	static inline void store(uint8_t *p, Word w)	{ _mm_storeu_si128((__m128i *)p, w); }
+	static inline Word splat(uint8_t b)				{ return _mm_set1_epi8((char)b); }
+	static inline Word bitOr(Word a, Word b)		{ return _mm_or_si128(a, b); }
+	static inline Word bitAnd(Word a, Word b)		{ return _mm_and_si128(a, b); }
+	static inline Word bitXor(Word a, Word b)		{ return _mm_xor_si128(a, b); }
+	static inline bool isZero(Word w)				{ return _mm_movemask_epi8(_mm_cmpeq_epi8(w, _mm_setzero_si128())) == 0xFFFF; }
+};
+#endif
+
+#if defined (__AVX2__)
+struct GFXRowAVX2
+{
+	typedef __m256i Word;
+	typedef GFXRowSSE2 Tail;
+	enum { align = 1, libc = 1 };
+	static inline Word load(const uint8_t *p)		{ return _mm256_loadu_si256((const __m256i *)p); }
+	static inline void store(uint8_t *p, Word w)	{ _mm256_storeu_si256((__m256i *)p, w); }
+	static inline Word splat(uint8_t b)				{ return _mm256_set1_epi8((char)b); }
+	static inline Word bitOr(Word a, Word b)		{ return _mm256_or_si256(a, b); }
+	static inline Word bitAnd(Word a, Word b)		{ return _mm256_and_si256(a, b); }
+	static inline Word bitXor(Word a, Word b)		{ return _mm256_xor_si256(a, b); }
+	static inline bool isZero(Word w)				{ return _mm256_testz_si256(w, w) != 0; }
+};
+#endif
+
+#if defined (GFX_ROW_HAS_NEON)
+struct GFXRowNEON
+{
+	typedef uint8x16_t Word;
+	typedef GFXRowWords Tail;
+	enum { align = 1, libc = 1 };
+	static inline Word load(const uint8_t *p)		{ return vld1q_u8(p); }
+	static inline void store(uint8_t *p, Word w)	{ vst1q_u8(p, w); }
+	static inline Word splat(uint8_t b)				{ return vdupq_n_u8(b); }
+	static inline Word bitOr(Word a, Word b)		{ return vorrq_u8(a, b); }
+	static inline Word bitAnd(Word a, Word b)		{ return vandq_u8(a, b); }
+	static inline Word bitXor(Word a, Word b)		{ return veorq_u8(a, b); }
+	static inline bool isZero(Word w)
+	{
+		uint64x2_t w64 = vreinterpretq_u64_u8(w);
+		return (vgetq_lane_u64(w64, 0) | vgetq_lane_u64(w64, 1)) == 0;
+	}
+};
+#endif
+
+//@note Widest vector policy of the host compiler, GFXRowWords where there is none
+#if defined (__AVX2__)
+typedef GFXRowAVX2 GFXRowVectors;
+#elif defined (__SSE2__)
+typedef GFXRowSSE2 GFXRowVectors;
+#elif defined (GFX_ROW_NEON_TARGET)
+typedef GFXRowNEON GFXRowVectors;
+#else
+typedef GFXRowWords GFXRowVectors;
+#endif
+
+//@note Bytes before the first address of dst the policy K can store a word to
+template <class K>
+static inline uint32_t GFXRowHead(const uint8_t *dst, uint32_t len)
+{
+	uint32_t head = (uint32_t)(-(uintptr_t)dst & (K::align - 1));
+	return (head < len) ? head : len;
+}
+
+/**
+ * @brief	Set len bytes at dst to fill, e.g. 0x00 to clear to BLACK, 0xFF to WHITE
+ */
+template <class K>
+static inline void GFXRowFill(uint8_t *dst, uint8_t fill, uint32_t len)
+{
+	const uint32_t S = sizeof(typename K::Word);
+
+	if(K::libc)
+	{
+		memset(dst, fill, len);
+		return;
+	}
+	for(uint32_t head = GFXRowHead<K>(dst, len); head; head--, len--)
+		*dst++ = fill;
+	typename K::Word w = K::splat(fill);
+	for(; len >= S; len -= S, dst += S)
+		K::store(dst, w);
+	if(len && (S > 1))
+		GFXRowFill<typename K::Tail>(dst, fill, len);
+}
+
+/**
+ * @brief	Set len bytes at dst to fill like GFXRowFill()
+ * @return	true if a byte was different before
+ */
+template <class K>
+static inline bool GFXRowFillChanged(uint8_t *dst, uint8_t fill, uint32_t len)
+{
+	const uint32_t S = sizeof(typename K::Word);
+	uint8_t diffHead = 0;
+
+	for(uint32_t head = GFXRowHead<K>(dst, len); head; head--, len--, dst++)
+	{
+		diffHead |= *dst ^ fill;
+		*dst = fill;
+	}
+	typename K::Word w = K::splat(fill), diff = K::splat(0);
+	for(; len >= S; len -= S, dst += S)
+	{
+		diff = K::bitOr(diff, K::bitXor(K::load(dst), w));
+		K::store(dst, w);
+	}
+	bool changed = (diffHead != 0) || !K::isZero(diff);
+	if(len && (S > 1))
+		changed |= GFXRowFillChanged<typename K::Tail>(dst, fill, len);
+	return changed;
+}
+
+/**
+ * @brief	Invert len bytes at dst, BLACK pixels become WHITE and the other way round
+ */
+template <class K>
+static inline void GFXRowInvert(uint8_t *dst, uint32_t len)
+{
+	const uint32_t S = sizeof(typename K::Word);
+
+	for(uint32_t head = GFXRowHead<K>(dst, len); head; head--, len--, dst++)
+		*dst = (uint8_t)~*dst;
+	typename K::Word ones = K::splat(0xFF);
+	for(; len >= S; len -= S, dst += S)
+		K::store(dst, K::bitXor(K::load(dst), ones));
+	if(len && (S > 1))
+		GFXRowInvert<typename K::Tail>(dst, len);
+}
+
+//@note Operations of GFXRowMerge()
+struct GFXRowOpCopy { template <class K> static inline typename K::Word apply(typename K::Word, typename K::Word s) { return s; } };
+struct GFXRowOpOr   { template <class K> static inline typename K::Word apply(typename K::Word d, typename K::Word s) { return K::bitOr(d, s); } };
+struct GFXRowOpAnd  { template <class K> static inline typename K::Word apply(typename K::Word d, typename K::Word s) { return K::bitAnd(d, s); } };
+struct GFXRowOpXor  { template <class K> static inline typename K::Word apply(typename K::Word d, typename K::Word s) { return K::bitXor(d, s); } };
+
+/**
+ * @brief	Merge len bytes at src into dst with Op: dst = Op(dst, src). The spans must not overlap.
+ * @note	A policy with aligned words only works word by word when dst and src sit at the same offset to a word,
+ *			other spans go to its tail policy.
+ */
+template <class K, class Op>
+static inline void GFXRowMerge(uint8_t *dst, const uint8_t *src, uint32_t len)
+{
+	const uint32_t S = sizeof(typename K::Word);
+
+	if((S > 1) && (((uintptr_t)dst ^ (uintptr_t)src) & (K::align - 1)))
+	{
+		GFXRowMerge<typename K::Tail, Op>(dst, src, len);
+		return;
+	}
+	for(uint32_t head = GFXRowHead<K>(dst, len); head; head--, len--, dst++, src++)
+		*dst = Op::template apply<GFXRowBytes>(*dst, *src);
+	for(; len >= S; len -= S, dst += S, src += S)
+		K::store(dst, Op::template apply<K>(K::load(dst), K::load(src)));
+	if(len && (S > 1))
+		GFXRowMerge<typename K::Tail, Op>(dst, src, len);
+}
+
+/**
+ * @brief	Copy len bytes at src to dst, the spans must not overlap
+ */
+template <class K>
+static inline void GFXRowCopy(uint8_t *dst, const uint8_t *src, uint32_t len)
+{
+	if(K::libc)
+		memcpy(dst, src, len);
+	else
+		GFXRowMerge<K, GFXRowOpCopy>(dst, src, len);
+}
+
+template <class K> static inline void GFXRowOr(uint8_t *dst, const uint8_t *src, uint32_t len)   { GFXRowMerge<K, GFXRowOpOr>(dst, src, len); }
+template <class K> static inline void GFXRowAnd(uint8_t *dst, const uint8_t *src, uint32_t len)  { GFXRowMerge<K, GFXRowOpAnd>(dst, src, len); }
+template <class K> static inline void GFXRowXor(uint8_t *dst, const uint8_t *src, uint32_t len)  { GFXRowMerge<K, GFXRowOpXor>(dst, src, len); }
+
+/**
+ * @brief	Write len bytes at dst as dst = (dst & a) ^ x, any raster op with one source byte for the whole span
+ */
+template <class K>
+static inline void GFXRowAndXor(uint8_t *dst, uint8_t a, uint8_t x, uint32_t len)
+{
+	const uint32_t S = sizeof(typename K::Word);
+
+	for(uint32_t head = GFXRowHead<K>(dst, len); head; head--, len--, dst++)
+		*dst = (uint8_t)((*dst & a) ^ x);
+	typename K::Word wa = K::splat(a), wx = K::splat(x);
+	for(; len >= S; len -= S, dst += S)
+		K::store(dst, K::bitXor(K::bitAnd(K::load(dst), wa), wx));
+	if(len && (S > 1))
+		GFXRowAndXor<typename K::Tail>(dst, a, x, len);
+}
+
+/**
+ * @return	true if len bytes at a and b are the same
+ */
+template <class K>
+static inline bool GFXRowEqual(const uint8_t *a, const uint8_t *b, uint32_t len)
+{
+	const uint32_t S = sizeof(typename K::Word);
+
+	if((S > 1) && (((uintptr_t)a ^ (uintptr_t)b) & (K::align - 1)))
+		return GFXRowEqual<typename K::Tail>(a, b, len);
+	for(uint32_t head = GFXRowHead<K>(a, len); head; head--, len--)
+		if(*a++ != *b++)
+			return false;
+	for(; len >= S; len -= S, a += S, b += S)
+		if(!K::isZero(K::bitXor(K::load(a), K::load(b))))
+			return false;
+	return (len && (S > 1)) ? GFXRowEqual<typename K::Tail>(a, b, len) : true;
+}
+
+#endif	//GFX_ROW_KERNELS_H
@@ -4,6 +4,8 @@
 */
 
 #include "MemoryLCD.h"
+#include "GFXRowKernels.h"
+#include <string.h>	//for memset
 
 #if defined (ARDUINO)
 #include "Arduino.h"
@@ -13,11 +15,218 @@
   #else if defined (ESP32)
 	hw_timer_t* timer = NULL;
   #endif
-static SPISettings spiSettings(2000000, LSBFIRST, SPI_MODE0); //send data with 2MHz SPI clock with data sent from LSB first
+static SPISettings spiSettings(GFX_SPI_CLOCK_HZ, LSBFIRST, SPI_MODE0); //send data with 2MHz SPI clock (default) with data sent from LSB first
 static SPIClass *_SPI;
+static volatile bool extcomLevel = false;	//EXTCOMIN level written last, hal_extcom_toggle() needs no digitalRead()
 #endif  //#if defined (ARDUINO)
 
-uint8_t frameBuffer[GFX_FB_CANVAS_H][GFX_FB_CANVAS_W];
+const GFX_DISPLAY_DESC gfxDescLS027B7DH01 = {"LS027B7DH01", LS027B7DH01_HOR_RESOLUTION, LS027B7DH01_VER_RESOLUTION, (LS027B7DH01_HOR_RESOLUTION+7)/8, 8, 3, 1};
+const GFX_DISPLAY_DESC gfxDescLS032B7DD02 = {"LS032B7DD02", LS032B7DD02_HOR_RESOLUTION, LS032B7DD02_VER_RESOLUTION, (LS032B7DD02_HOR_RESOLUTION+7)/8, 10, 3, 1};
+const GFX_DISPLAY_DESC gfxDescLS044Q7DH01 = {"LS044Q7DH01", LS044Q7DH01_HOR_RESOLUTION, LS044Q7DH01_VER_RESOLUTION, (LS044Q7DH01_HOR_RESOLUTION+7)/8, 8, 3, 1};
+const GFX_DISPLAY_DESC gfxDescLS006B7DH03 = {"LS006B7DH03", LS006B7DH03_HOR_RESOLUTION, LS006B7DH03_VER_RESOLUTION, (LS006B7DH03_HOR_RESOLUTION+7)/8, 8, 3, 1};
+const GFX_DISPLAY_DESC gfxDescLS011B7DH03 = {"LS011B7DH03", LS011B7DH03_HOR_RESOLUTION, LS011B7DH03_VER_RESOLUTION, (LS011B7DH03_HOR_RESOLUTION+7)/8, 8, 3, 1};
+const GFX_DISPLAY_DESC gfxDescLS013B7DH03 = {"LS013B7DH03", LS013B7DH03_HOR_RESOLUTION, LS013B7DH03_VER_RESOLUTION, (LS013B7DH03_HOR_RESOLUTION+7)/8, 8, 3, 1};
+const GFX_DISPLAY_DESC gfxDescLS018B7DH02 = {"LS018B7DH02", LS018B7DH02_HOR_RESOLUTION, LS018B7DH02_VER_RESOLUTION, (LS018B7DH02_HOR_RESOLUTION+7)/8, 10, 3, 1};
+
+#if GFX_LINE_HEADERS
+uint8_t frameBuffer[GFX_FB_SIZE(DISP_HOR_RESOLUTION, GFX_FB_ROWS)];
+#else
+uint8_t frameBuffer[GFX_FB_ROWS][GFX_FB_CANVAS_W];
+#endif
+
+static uint8_t dirtyLines[(GFX_FB_CANVAS_H + 7) / 8];	//one bit per LCD row waiting for GFXDisplayFlush()
+GFX_SHADOW_STORAGE(shadowStorage, DISP_HOR_RESOLUTION, DISP_VER_RESOLUTION)	//lines as last sent to the LCD (GFX_SHADOW)
+
+#if GFX_BAND_LINES
+static uint8_t bandList[GFX_BAND_LIST_SIZE];			//display list of the default display in banded mode
+static GFX_DISPLAY defaultDisplay = {&GFX_DISPLAY_DESC_DEFAULT, (uint8_t *)frameBuffer, dirtyLines, GFX_SHADOW_ADDR(shadowStorage), GFX_FLUSH_DEFERRED, GFX_ROP_SET, false,
+									 GFX_FB_ROWS, 0, 0, bandList, GFX_BAND_LIST_SIZE, 0, 0, 0, 0, 0};
+#else
+static GFX_DISPLAY defaultDisplay = {&GFX_DISPLAY_DESC_DEFAULT, (uint8_t *)frameBuffer, dirtyLines, GFX_SHADOW_ADDR(shadowStorage), GFX_FLUSH_IMMEDIATE, GFX_ROP_SET, false,
+									 0, 0, 0, NULL, 0, 0, 0, 0, 0, 0};
+#endif
+static GFX_DISPLAY *gfx = &defaultDisplay;	//display the API functions work on, see GFXDisplaySelect()
+
+static uint8_t *xferBuffer = NULL;			//transfer buffer of GFXDisplayFlushAsync(), owned by the transport while xferBusy
+static uint32_t xferSize = 0;
+static volatile bool xferBusy = false;
+static uint16_t xferLines;
+static uint8_t xferHoldUs;
+static void (*xferDone)(uint16_t lines) = NULL;
+#if GFX_LINE_HEADERS
+static uint8_t *xferTrailer = NULL;			//header after the lines sent from the frame buffer, dummy bytes while they are sent
+static uint8_t xferTrailerSaved[2];
+#endif
+
+#if (GFX_VCOM == GFX_VCOM_SERIAL)
+static uint8_t vcomBit = 0;				//M1 bit of the commands sent, VCOM polarity of the LCD
+static uint32_t vcomToggleMs = 0;		//hal_millis() of the last polarity change
+#else
+static const uint8_t vcomBit = 0;		//VCOM comes from EXTCOMIN, M1 stays low
+#endif
+
+#if GFX_STATS
+static GFX_DISPLAY_STATS gfxStats;		//SPI traffic counters, see GFXDisplayGetStats()
+#define GFX_STATS_ADD(field, n)	(gfxStats.field += (n))
+#else
+#define GFX_STATS_ADD(field, n)	((void)0)
+#endif
+
+/**
+ * @brief	Local function to map LCD row y to its row in the frame buffer of the selected display
+ * @note	Rows of the scroll region are a ring starting at scrollTop+scrollStart. Other rows, and every row with GFX_SCROLL 0,
+ *			map to themselves. A single unsigned compare tells them apart, rows above scrollTop wrap to large values.
+ */
+static inline uint16_t GFXDisplayScrollRow(uint16_t y)
+{
+#if GFX_SCROLL
+	uint16_t i = (uint16_t)(y - gfx->scrollTop);
+
+	if(i < gfx->scrollRows)
+	{
+		i += gfx->scrollStart;
+		return gfx->scrollTop + ((i >= gfx->scrollRows) ? (uint16_t)(i - gfx->scrollRows) : i);
+	}
+#endif
+	return y;
+}
+
+/**
+ * @note	Geometry of the selected display seen by the frame buffer kernels and the line updaters.<br>
+ *			GFXModelGeometry folds the model selected in MemoryLCD.h into constants, GFXDescGeometry reads the GFX_DISPLAY_DESC.
+ *			Both are instantiated and GFX_GEOMETRY_CALL() picks one per call, so a display of the default model runs the
+ *			same code as a single-model build and other models only pay for the descriptor loads once per call.<br>
+ *			Rows firstRow()~height()-1 are held in the frame buffer, firstRow() at its start. That is the whole LCD except
+ *			for a banded display while a band is rendered, which always goes through GFXDescGeometry.<br>
+ *			row(y) is the frame buffer row of LCD row y, its bytesPerLine() bytes of pixels. Rows are stride() bytes apart, the
+ *			GFX_FB_HEADER bytes of command header in between with GFX_LINE_HEADERS. They are not across the edges of a scroll
+ *			region, so the kernels look up every row they write instead of stepping from the first one, with GFXRowMap in loops.
+ */
+struct GFXModelGeometry
+{
+	static inline uint16_t firstRow(void)     { return 0; }
+	static inline uint16_t height(void)       { return GFX_FB_CANVAS_H; }
+	static inline uint16_t bytesPerLine(void) { return GFX_FB_CANVAS_W; }
+	static inline uint16_t stride(void)       { return GFX_FB_CANVAS_W + GFX_FB_HEADER; }
+	static inline uint8_t  addressBits(void)  { return GFX_ADDRESS_BITS; }
+	static inline uint8_t* row(uint16_t y)    { return gfx->frameBuffer + GFX_FB_HEADER + (uint32_t)GFXDisplayScrollRow(y)*stride(); }
+};
+
+struct GFXDescGeometry
+{
+	static inline uint16_t firstRow(void)     { return gfx->bandTop; }
+	static inline uint16_t height(void)       { return gfx->bandLines ? gfx->bandEnd : gfx->pDesc->height; }
+	static inline uint16_t bytesPerLine(void) { return gfx->pDesc->bytesPerLine; }
+	static inline uint16_t stride(void)       { return gfx->pDesc->bytesPerLine + GFX_FB_HEADER; }
+	static inline uint8_t  addressBits(void)  { return gfx->pDesc->addressBits; }
+	static inline uint8_t* row(uint16_t y)    { return gfx->frameBuffer + GFX_FB_HEADER + (uint32_t)(GFXDisplayScrollRow(y) - gfx->bandTop)*stride(); }
+};
+
+/**
+ * @note	Frame buffer rows of the selected display for the row loops of a kernel call: at(y) is G::row(y) with the display
+ *			fields copied into locals once. Every byte stored into a row may alias them, so G::row() in a loop would load them
+ *			again for each row. Rows y~last(y) are stride bytes apart, loops writing a byte or two per row step through them.
+ */
+template <class G>
+struct GFXRowMap
+{
+	uint8_t		*fb;
+	uint16_t	stride, first, top, rows, start;
+
+	inline GFXRowMap(void) : fb(gfx->frameBuffer + GFX_FB_HEADER), stride(G::stride()), first(G::firstRow()), top(gfx->scrollTop),
+							 rows(gfx->scrollRows), start(gfx->scrollStart) {}
+
+	inline uint8_t* at(uint16_t y) const
+	{
+#if GFX_SCROLL
+		uint16_t i = (uint16_t)(y - top);
+		if(i < rows)
+		{
+			i += start;
+			y = top + ((i >= rows) ? (uint16_t)(i - rows) : i);
+		}
+#endif
+		return fb + (uint32_t)(y - first)*stride;
+	}
+
+	inline uint16_t last(uint16_t y) const
+	{
+#if GFX_SCROLL
+		if(rows)
+		{
+			if(y < top)
+				return top - 1;
+			if((uint16_t)(y - top) < rows)
+			{
+				uint16_t i = (uint16_t)(y - top + start);	//up to the last row of the ring, or of the region once wrapped
+				return (i < rows) ? (uint16_t)(y + rows - 1 - i) : (uint16_t)(top + rows - 1);
+			}
+		}
+#else
+		(void)y;
+#endif
+		return 0xFFFF;
+	}
+};
+
+#if GFX_BAND_LINES	//the default display is banded, GFXModelGeometry is never used
+#define GFX_GEOMETRY_CALL(fcn, ...)	fcn<GFXDescGeometry>(__VA_ARGS__)
+#else
+#define GFX_GEOMETRY_CALL(fcn, ...)	(((gfx->pDesc == &GFX_DISPLAY_DESC_DEFAULT) && (gfx->bandLines == 0)) ? \
+									 fcn<GFXModelGeometry>(__VA_ARGS__) : fcn<GFXDescGeometry>(__VA_ARGS__))
+#endif
+
+//@note Row kernel policy of every fill, copy and compare of frame buffer rows, see GFX_ROW_KERNEL
+#if (GFX_ROW_KERNEL == GFX_ROW_KERNEL_BYTE)
+typedef GFXRowBytes GFXRowKernel;
+#elif (GFX_ROW_KERNEL == GFX_ROW_KERNEL_SIMD)
+typedef GFXRowVectors GFXRowKernel;
+#else
+typedef GFXRowWords GFXRowKernel;
+#endif
+
+/**
+ * @note	Every raster op writes a frame buffer byte as dst = (dst & AND) ^ XOR over the pixels covered. AND and XOR are
+ *			0x00 or 0xFF per source bit: *0 where the source bit is clear (BLACK), *1 where it is set (WHITE).
+ */
+typedef struct
+{
+	uint8_t		and0, and1, xor0, xor1;
+} GFX_ROP_MASKS;
+
+static const GFX_ROP_MASKS ropMasks[] =
+{
+	{0x00, 0x00, 0x00, 0xFF},	//GFX_ROP_SET	: source
+	{0x00, 0x00, 0xFF, 0xFF},	//GFX_ROP_CLEAR	: WHITE
+	{0xFF, 0xFF, 0x00, 0xFF},	//GFX_ROP_XOR	: dst ^ source
+	{0xFF, 0x00, 0x00, 0xFF},	//GFX_ROP_OR	: dst | source
+	{0x00, 0xFF, 0x00, 0x00},	//GFX_ROP_AND	: dst & source
+	{0xFF, 0xFF, 0xFF, 0xFF}	//GFX_ROP_NOT	: ~dst
+};
+
+/**
+ * @brief	Local function to merge the pixels mask of a source byte into a frame buffer byte with raster op r
+ */
+static inline uint8_t GFXRopByte(GFX_ROP_MASKS r, uint8_t dst, uint8_t src, uint8_t mask)
+{
+	uint8_t a = r.and0 ^ ((r.and0 ^ r.and1) & src);
+	uint8_t x = r.xor0 ^ ((r.xor0 ^ r.xor1) & src);
+	return (dst & (a | (uint8_t)~mask)) ^ (x & mask);
+}
+
+/**
+ * @brief	Local function to write len whole bytes as dst = (dst & a) ^ x with the row kernels. A solid source turns every
+ *			raster op into a fill, an inversion or nothing, a run of one image byte into any (a, x) pair.
+ */
+static void GFXRopSpan(uint8_t *dst, uint8_t a, uint8_t x, uint32_t len)
+{
+	if(a == 0x00)
+		GFXRowFill<GFXRowKernel>(dst, x, len);
+	else if((a == 0xFF) && (x == 0xFF))
+		GFXRowInvert<GFXRowKernel>(dst, len);
+	else if((a != 0xFF) || (x != 0x00))
+		GFXRowAndXor<GFXRowKernel>(dst, a, x, len);
+}
 
 /**
  * @brief	Local function to write a pixel to the frame buffer. No display on LCD yet.
@@ -30,576 +239,3785 @@ uint8_t frameBuffer[GFX_FB_CANVAS_H][GFX_FB_CANVAS_W];
 				WHITE,
 				TRANSPARENT	//means leaving original color
 			} COLOR;
+ * @param	rop is the raster op, GFX_ROP_SET to write color
  */
-static void GFXDisplayPutPixel_FB(uint16_t x, uint16_t y, COLOR color)
+template <class G>
+static void GFXDisplayPutPixel_FB(uint16_t x, uint16_t y, COLOR color, GFX_ROP rop)
 {
-	if(y>(GFX_FB_CANVAS_H-1)||((x>>3)>(GFX_FB_CANVAS_W-1)))//avoid running outside array index
+	const uint16_t W = G::bytesPerLine();
+
+	if((y<G::firstRow())||(y>(G::height()-1))||((x>>3)>(W-1)))//avoid running outside array index
         return;
 		
+	uint8_t *row = G::row(y);
 	uint8_t maskBit;
 	
 	//maskBit = 0x80 >> (x & 0x07);	//SPI data sent with MSB first
 	maskBit = 0x01 << (x & 0x07);	//SPI data sent with LSB first
 	
-	if(color == WHITE)
-        frameBuffer[y][(x >> 3)] |= maskBit;    //frameBuffer[y][(x>>1)] &= (maskBit^0xFF); frameBuffer[y][(x>>1)] |= color;
-    else
-        frameBuffer[y][(x >> 3)] &= (maskBit ^ 0xFF);
+	row[(x >> 3)] = GFXRopByte(ropMasks[rop], row[(x >> 3)], (color == WHITE) ? 0xFF : 0x00, maskBit);
 }
 
-static void GFXDisplayUpdateLine(uint16_t line, uint8_t *buf);
-static void GFXDisplayUpdateBlock(uint16_t start_line, uint16_t end_line, uint8_t *buf);
-static uint16_t bfc_DrawChar_RowRowUnpacked(uint16_t x0, uint16_t y0, const BFC_FONT *pFont, uint16_t ch, COLOR color, COLOR bg);
-
 /**
- * @brief Clear memory internal data and writes white for all pixels
+ * @brief	Local function to fill a rectangle in the frame buffer with one color. No display on LCD yet.
+ *			Each row is one byte span: the partial bytes at both ends are masked, the full bytes in between are set with GFXRowFill().
+ *			A rectangle within a single byte column (e.g. a vertical line) applies one column mask down the rows.
+ * @param	(x1,y1) is the top left corner, (x2,y2) the bottom right corner, both inclusive with x1<=x2 and y1<=y2
+ * @param	color is BLACK/WHITE. Anything but WHITE is drawn BLACK the same way as GFXDisplayPutPixel_FB() does
+ * @param	rop is the raster op, GFX_ROP_SET to fill with color. GFX_ROP_NOT and GFX_ROP_XOR with WHITE invert the rows with GFXRowInvert().
+ * @note	Coordinates outside the frame buffer are clipped.
  */
-void GFXDisplayAllClear(void)
+template <class G>
+static void GFXDisplayFillRect_FB(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, COLOR color, GFX_ROP rop)
 {
-  hal_spi_start_transaction();
-  hal_delayUs(3); //SCS setup time of tsSCS (refer to datasheet for timing details)
-  hal_spi_write_byte(0x04); //M0="L", M2="H" with LSB sent first
-  hal_spi_write_byte(0x00);
-  hal_delayUs(1); //SCS hold time of thSCS (refer to datasheet for timing details)
-  hal_spi_end_transaction();  
+	const uint16_t H = G::height(), W = G::bytesPerLine(), first = G::firstRow();
 
-  memset((void *)&frameBuffer, 0xFF, sizeof(frameBuffer));  //clear SRAM of the MCU
-}
+	if((x1 > x2) || (y1 > y2) || (y1 > (H-1)) || (y2 < first) || ((x1>>3) > (W-1)))
+		return;
 
-/**
- * @brief Power-on sequence with 5V0 enabled, clear pixel memory (x2), DISP pin set high, and EXTCOMIN pulse started<br>
- *        Normal operation after this function executed. EXTCOMIN_FREQ indicates the pulse frequency defined in MemoryLCD.h
- */
-void GFXDisplayPowerOn(void)
-{
-  //hal_gpio_write(GFX_5V0_EN, HIGH); //turn ON TPS60140 for 5V0, only useful when a gpio wired to EN pin of TPS60140
-  //hal_delayMs(10); 		//stablize 5V0, allow more time for it otherwise there is startup problem.
-  GFXDisplayAllClear();	//need to do it twice for clear pixel memory (somehow); otherwise, pixel memory not always cleared!!!
-  GFXDisplayAllClear();
+	if(y1 < first)
+		y1 = first;
+	if(y2 > (H-1))
+		y2 = H-1;
+	if((x2>>3) > (W-1))
+		x2 = (W<<3)-1;
 
-  GFXDisplayOn(); //DISP = '1'
-  hal_delayUs(30);
-  hal_extcom_start(EXTCOMIN_FREQ); //turn on EXTCOMIN pulse
-  hal_delayUs(30);
-  //normal operation after this...
+	uint16_t firstByte = x1 >> 3;
+	uint16_t lastByte  = x2 >> 3;
+	uint8_t leftMask   = (uint8_t)(0xFF << (x1 & 0x07));		//SPI data sent with LSB first, pixel x1 at bit (x1 & 0x07)
+	uint8_t rightMask  = (uint8_t)(0xFF >> (7 - (x2 & 0x07)));
+	uint8_t a          = (color == WHITE) ? ropMasks[rop].and1 : ropMasks[rop].and0;	//dst = (dst & a) ^ x
+	uint8_t x          = (color == WHITE) ? ropMasks[rop].xor1 : ropMasks[rop].xor0;
+	const GFXRowMap<G> rows;
+
+	if(firstByte == lastByte)
+	{
+		leftMask &= rightMask;
+		for(uint16_t y = y1; y <= y2; )
+		{
+			uint8_t *col = rows.at(y) + firstByte;
+			for(uint16_t last = MIN(y2, rows.last(y)); y <= last; y++, col += rows.stride)
+				*col = (*col & (a | (uint8_t)~leftMask)) ^ (x & leftMask);
+		}
+		return;
+	}
+
+	uint16_t midBytes = lastByte - firstByte - 1;
+	for(uint16_t y = y1; y <= y2; y++)
+	{
+		uint8_t *row = rows.at(y);
+		row[firstByte] = (row[firstByte] & (a | (uint8_t)~leftMask)) ^ (x & leftMask);
+		if(midBytes)
+			GFXRopSpan(&row[firstByte+1], a, x, midBytes);
+		row[lastByte] = (row[lastByte] & (a | (uint8_t)~rightMask)) ^ (x & rightMask);
+	}
 }
 
 /**
- * @brief	Display OFF with DISP pin set '1'
+ * @note	Bit order reversal of a byte. Image data is stored with the leftmost pixel in the MSB while
+ *			frameBuffer holds the leftmost pixel in the LSB (SPI data sent with LSB first).
  */
-void GFXDisplayOn(void)
+static const uint8_t bitReverse[256] =
 {
-	hal_gpio_write(GFX_DISPLAY_DISP, HIGH); //DISP = '1'
-}
+	0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0,
+	0x08, 0x88, 0x48, 0xC8, 0x28, 0xA8, 0x68, 0xE8, 0x18, 0x98, 0x58, 0xD8, 0x38, 0xB8, 0x78, 0xF8,
+	0x04, 0x84, 0x44, 0xC4, 0x24, 0xA4, 0x64, 0xE4, 0x14, 0x94, 0x54, 0xD4, 0x34, 0xB4, 0x74, 0xF4,
+	0x0C, 0x8C, 0x4C, 0xCC, 0x2C, 0xAC, 0x6C, 0xEC, 0x1C, 0x9C, 0x5C, 0xDC, 0x3C, 0xBC, 0x7C, 0xFC,
+	0x02, 0x82, 0x42, 0xC2, 0x22, 0xA2, 0x62, 0xE2, 0x12, 0x92, 0x52, 0xD2, 0x32, 0xB2, 0x72, 0xF2,
+	0x0A, 0x8A, 0x4A, 0xCA, 0x2A, 0xAA, 0x6A, 0xEA, 0x1A, 0x9A, 0x5A, 0xDA, 0x3A, 0xBA, 0x7A, 0xFA,
+	0x06, 0x86, 0x46, 0xC6, 0x26, 0xA6, 0x66, 0xE6, 0x16, 0x96, 0x56, 0xD6, 0x36, 0xB6, 0x76, 0xF6,
+	0x0E, 0x8E, 0x4E, 0xCE, 0x2E, 0xAE, 0x6E, 0xEE, 0x1E, 0x9E, 0x5E, 0xDE, 0x3E, 0xBE, 0x7E, 0xFE,
+	0x01, 0x81, 0x41, 0xC1, 0x21, 0xA1, 0x61, 0xE1, 0x11, 0x91, 0x51, 0xD1, 0x31, 0xB1, 0x71, 0xF1,
+	0x09, 0x89, 0x49, 0xC9, 0x29, 0xA9, 0x69, 0xE9, 0x19, 0x99, 0x59, 0xD9, 0x39, 0xB9, 0x79, 0xF9,
+	0x05, 0x85, 0x45, 0xC5, 0x25, 0xA5, 0x65, 0xE5, 0x15, 0x95, 0x55, 0xD5, 0x35, 0xB5, 0x75, 0xF5,
+	0x0D, 0x8D, 0x4D, 0xCD, 0x2D, 0xAD, 0x6D, 0xED, 0x1D, 0x9D, 0x5D, 0xDD, 0x3D, 0xBD, 0x7D, 0xFD,
+	0x03, 0x83, 0x43, 0xC3, 0x23, 0xA3, 0x63, 0xE3, 0x13, 0x93, 0x53, 0xD3, 0x33, 0xB3, 0x73, 0xF3,
+	0x0B, 0x8B, 0x4B, 0xCB, 0x2B, 0xAB, 0x6B, 0xEB, 0x1B, 0x9B, 0x5B, 0xDB, 0x3B, 0xBB, 0x7B, 0xFB,
+	0x07, 0x87, 0x47, 0xC7, 0x27, 0xA7, 0x67, 0xE7, 0x17, 0x97, 0x57, 0xD7, 0x37, 0xB7, 0x77, 0xF7,
+	0x0F, 0x8F, 0x4F, 0xCF, 0x2F, 0xAF, 0x6F, 0xEF, 0x1F, 0x9F, 0x5F, 0xDF, 0x3F, 0xBF, 0x7F, 0xFF
+};
 
 /**
- * @brief Power-off sequence with all pixels set white, DISP pin set low, EXTCOMIN pulse stopped, and 5V0 disabled.<br>
- *        Need to run GFXDisplayPowerOn() after this function if we need to write to Memory LCD again.
+ * @note	Whole-byte operation merging the inner bytes of a bitmap or glyph row, the bytes between its masked edges:
+ *			dst = op(dst, src ^ flip) with src the source bytes shifted into place. Every raster op of a bitmap, and of
+ *			a glyph with or without background, comes down to one of them, see GFXMergeOf().
  */
-void GFXDisplayPowerOff(void)
+enum
 {
-   GFXDisplayAllClear();
-   GFXDisplayOff(); 	//DISP = '0'
-   hal_extcom_stop();  	//stop EXTCOMIN pulse
-   hal_delayUs(30);
-   //hal_gpio_write(GFX_5V0_EN, LOW); //turn OFF TPS60140 for 5V0, only useful if a GPIO is wired to EN pin of TPS60140
-}
+	GFX_MERGE_NONE = 0,
+	GFX_MERGE_COPY,
+	GFX_MERGE_OR,
+	GFX_MERGE_AND,
+	GFX_MERGE_XOR,
+	GFX_MERGE_FILL,		//dst = fill, the source is not read
+	GFX_MERGE_INVERT,	//dst = ~dst
+	GFX_MERGE_BYTES		//dst = GFXRopByte(r, dst, src ^ flip, 0xFF), for mask sets no ropMasks entry has
+};
 
-/**
- * @brief	Display OFF with DISP pin set '0'
- */
-void GFXDisplayOff(void)
+#define GFX_MERGE_MIN_BYTES		8	//inner bytes of a row below which the byte loop is faster than the kernel calls
+
+typedef struct
 {
-	hal_gpio_write(GFX_DISPLAY_DISP, LOW); //DISP = '0'
-}
+	uint8_t		op, flip, fill;
+	GFX_ROP_MASKS r;
+} GFX_MERGE;
 
 /**
- * @brief	Print a single pixel
- * @param	(x,y) indicate the position
- * @param	color is BLACK/WHITE
+ * @brief	Local function to find the operation of GFX_MERGE for the inner bytes of a row
+ * @param	r is the raster op
+ * @param	flip is XORed into the source bytes first, e.g. 0xFF to invert an image
+ * @param	maskBySource is false when the source bytes are the pixel values, every pixel written (bitmap, glyph on a
+ *			background); true when the set source bits are the pixels written, in color (glyph on TRANSPARENT)
+ * @param	color is the color of the pixels when maskBySource
  */
-void GFXDisplayPutPixel(uint16_t x, uint16_t y, COLOR color)
+static GFX_MERGE GFXMergeOf(GFX_ROP_MASKS r, uint8_t flip, bool maskBySource, COLOR color)
 {
-	GFXDisplayPutPixel_FB(x, y, color);
-	GFXDisplayUpdateLine(y+1, (uint8_t *)&frameBuffer[y]);	//Update on screen. Line counts from 1 thats why y+1
+	GFX_MERGE m = {GFX_MERGE_BYTES, flip, 0x00, r};
+
+	if(maskBySource)	//dst = (dst & (a | ~src)) ^ (x & src) with the solid masks of color
+	{
+		uint8_t a = (color == WHITE) ? r.and1 : r.and0, x = (color == WHITE) ? r.xor1 : r.xor0;
+		m.op = (a == 0x00) ? (x ? GFX_MERGE_OR : GFX_MERGE_AND) : (x ? GFX_MERGE_XOR : GFX_MERGE_NONE);
+		if((a == 0x00) && !x)
+			m.flip ^= 0xFF;		//dst & ~src
+		return m;
+	}
+
+	if(r.and0 == r.and1)		//dst = (dst & a) ^ x(src)
+	{
+		if(r.xor0 == r.xor1)
+		{
+			m.op = (r.and0 == 0x00) ? GFX_MERGE_FILL : (r.xor0 ? GFX_MERGE_INVERT : GFX_MERGE_NONE);
+			m.fill = r.xor0;
+		}
+		else
+		{
+			m.op = (r.and0 == 0x00) ? GFX_MERGE_COPY : GFX_MERGE_XOR;
+			m.flip ^= r.xor0;	//x(src) is src or ~src
+		}
+	}
+	else if((r.and0 == 0x00) && (r.xor0 == 0x00) && (r.xor1 == 0x00))
+		m.op = GFX_MERGE_AND;	//dst & src
+	else if((r.and0 == 0xFF) && (r.xor0 == 0x00) && (r.xor1 == 0xFF))
+		m.op = GFX_MERGE_OR;	//(dst & ~src) ^ src
+	return m;
 }
 
 /**
- * @brief	Draw a horizontal line 
- * @param	x1 is the starting coordinate(0~DISP_HOR_RESOLUTION-1)
- * @param	x2 is the ending coordinate(0~DISP_HOR_RESOLUTION-1)
- * @param	y is the line position (0~DISP_VER_RESOLUTION-1)
- * @param	color is BLACK/WHITE
- * @param	thick is the thickness in pixels ranges 1~255
+ * @brief	Local function to merge source bytes i~end-1 of a bitmap or glyph row into the frame buffer row with m.
+ *			The source is shifted into place, bit reversed for the MSB first bitmaps, in chunks on the stack and handed
+ *			to the row kernels. Aligned glyphs with the leftmost pixel in the LSB are merged from the source itself.
+ * @param	*row is the frame buffer byte of source byte 0
+ * @param	*data is the source row, bytesPerLine bytes; bytes past it are 0
+ * @param	shift, carry are the left & 0x07 and the pixels shifted out of byte i-1
+ * @param	reverse is true for sources with the leftmost pixel in the MSB
+ * @return	the pixels shifted out of byte end-1, carry of the next byte
  */
-void GFXDisplayLineDrawH(uint16_t x1, uint16_t x2, uint16_t y, COLOR color, uint8_t thick)
+static uint16_t GFXDisplayMergeRow(uint8_t *row, const uint8_t *data, uint16_t bytesPerLine, uint16_t i, uint16_t end, uint8_t shift,
+								   uint16_t carry, bool reverse, const GFX_MERGE *pMerge)
 {
-	if(thick==0) return;
-	
-	uint16_t _y, x, x_left, x_right;
-	
-	if(x1 > x2)
+	uint8_t chunk[32];
+
+	if(pMerge->op >= GFX_MERGE_FILL)
 	{
-		x_right = x1; x_left = x2;
+		if(pMerge->op == GFX_MERGE_FILL)
+			GFXRowFill<GFXRowKernel>(&row[i], pMerge->fill, end - i);
+		else if(pMerge->op == GFX_MERGE_INVERT)
+			GFXRowInvert<GFXRowKernel>(&row[i], end - i);
+		else
+		{
+			for(uint16_t k = i; k < end; k++)
+			{
+				uint16_t bits = (k < bytesPerLine) ? (reverse ? bitReverse[data[k]] : data[k]) : 0;
+				row[k] = GFXRopByte(pMerge->r, row[k], (uint8_t)((bits << shift) | carry) ^ pMerge->flip, 0xFF);
+				carry = bits >> (8 - shift);
+			}
+			return carry;
+		}
+		uint16_t bits = (end - 1 < bytesPerLine) ? (reverse ? bitReverse[data[end-1]] : data[end-1]) : 0;
+		return bits >> (8 - shift);
 	}
-	else
+	if(pMerge->op == GFX_MERGE_NONE)
 	{
-		x_right = x2; x_left = x1;
+		uint16_t bits = (end - 1 < bytesPerLine) ? (reverse ? bitReverse[data[end-1]] : data[end-1]) : 0;
+		return bits >> (8 - shift);
 	}
-		 
-	for(_y = y; _y < (y+thick); _y++)
+
+	const uint8_t *src = &data[i];
+	while(i < end)
 	{
-		for(x = x_left; x <= x_right; x++)
+		uint16_t n = MIN((uint32_t)(end - i), (uint32_t)sizeof(chunk));
+
+		if(reverse || shift || pMerge->flip || (i + n > bytesPerLine))
 		{
-			GFXDisplayPutPixel_FB(x, _y, color);
-		}		
-	}
+			for(uint16_t k = 0; k < n; k++)
+			{
+				uint16_t bits = (i + k < bytesPerLine) ? (reverse ? bitReverse[data[i+k]] : data[i+k]) : 0;
+				chunk[k] = (uint8_t)((bits << shift) | carry) ^ pMerge->flip;
+				carry = bits >> (8 - shift);
+			}
+			src = chunk;
+		}
+		else
+			src = &data[i];		//already in frame buffer order, carry stays 0
 
-	GFXDisplayUpdateBlock(y+1, y+thick, (uint8_t *)frameBuffer[y]);
+		switch(pMerge->op)
+		{
+		case GFX_MERGE_COPY:	GFXRowCopy<GFXRowKernel>(&row[i], src, n); break;
+		case GFX_MERGE_OR:		GFXRowOr<GFXRowKernel>(&row[i], src, n); break;
+		case GFX_MERGE_AND:		GFXRowAnd<GFXRowKernel>(&row[i], src, n); break;
+		default:				GFXRowXor<GFXRowKernel>(&row[i], src, n); break;
+		}
+		i += n;
+	}
+	return carry;
 }
 
 /**
- * @brief	Draw a vertical line
- * @param	x is the horizontal position (0~DISP_HOR_RESOLUTION-1)
- * @param	y1 is the starting y position (0~DISP_VER_RESOLUTION-1)
- * @param	y2 is the ending y position (0~DISP_VER_RESOLUTION-1)
- * @param	color is BLACK/WHITE
- * @param	thick is the thickness in pixels ranges 1~255
+ * @brief	Local function to copy a 1-bpp bitmap (leftmost pixel in MSB, bit set for WHITE) into the frame buffer. No display on LCD yet.
+ *			Whole source bytes are merged into each frame buffer row with a shift for unaligned left, the left and right
+ *			edges are masked so pixels around the bitmap are kept. Clipping is done once for the whole bitmap.
+ * @param	(left,top) is the top left corner position
+ * @param	*data is a pointer to the bitmap rows, bytesPerLine apart
+ * @param	width, height are the bitmap size in pixels
+ * @param	invert is true to XOR every pixel for negative effect
+ * @param	rop is the raster op merging the bitmap, GFX_ROP_SET to copy it
  */
-void GFXDisplayLineDrawV(uint16_t x, uint16_t y1, uint16_t y2, COLOR color, uint8_t thick)
+template <class G>
+static void GFXDisplayBlit_FB(uint16_t left, uint16_t top, const uint8_t *data, uint16_t width, uint16_t height, uint16_t bytesPerLine, bool invert,
+							  GFX_ROP rop)
 {
-	if(thick==0) return;
-	
-	uint16_t _x, y, y_top, y_bottom;
-	
-	if(y1 > y2)
+	const uint16_t H = G::height(), W = G::bytesPerLine(), first = G::firstRow();
+
+	if((top > (H-1)) || ((uint32_t)top + height <= first) || ((left>>3) > (W-1)))
+		return;
+
+	uint32_t right  = MIN((uint32_t)left + width - 1, (uint32_t)(W<<3) - 1);		//clip once for all rows
+	uint16_t bottom = MIN((uint32_t)top + height - 1, (uint32_t)H - 1);
+	if(top < first)
 	{
-		y_bottom = y1; y_top = y2;
+		data += (uint32_t)(first - top)*bytesPerLine;
+		top = first;
 	}
-	else
+	uint16_t firstByte = left >> 3;
+	uint16_t lastByte  = right >> 3;
+	uint8_t shift      = left & 0x07;
+	uint8_t leftMask   = (uint8_t)(0xFF << shift);
+	uint8_t rightMask  = (uint8_t)(0xFF >> (7 - (right & 0x07)));
+	uint8_t xorMask    = invert ? 0xFF : 0x00;
+	uint16_t srcBytes  = lastByte - firstByte + 1;	//source bytes feeding the row, the last one may be past the bitmap when shifted
+	const GFX_ROP_MASKS r = ropMasks[rop];
+	const GFX_MERGE merge = GFXMergeOf(r, xorMask, false, BLACK);
+	const bool kernels = (srcBytes >= GFX_MERGE_MIN_BYTES + 2);
+	const GFXRowMap<G> rows;
+
+	if(firstByte == lastByte)
+		leftMask &= rightMask;
+
+	for(uint16_t y = top; y <= bottom; y++, data += bytesPerLine)
 	{
-		y_bottom = y2; y_top = y1;
+		uint8_t *row = rows.at(y) + firstByte;
+		uint16_t carry = 0;		//source pixels shifted out of the previous byte
+
+		for(uint16_t i = 0; i < srcBytes; i++)
+		{
+			if((i == 1) && kernels)	//inner bytes by the row kernels
+			{
+				carry = GFXDisplayMergeRow(row, data, bytesPerLine, 1, srcBytes - 1, shift, carry, true, &merge);
+				i = srcBytes - 1;
+			}
+
+			uint16_t bits = (i < bytesPerLine) ? bitReverse[data[i]] : 0;
+			uint8_t val = (uint8_t)((bits << shift) | carry) ^ xorMask;
+			carry = bits >> (8 - shift);
+
+			if(i == 0)
+				row[i] = GFXRopByte(r, row[i], val, leftMask);
+			else if(i == srcBytes-1)
+				row[i] = GFXRopByte(r, row[i], val, rightMask);
+			else if(rop == GFX_ROP_SET)
+				row[i] = val;
+			else
+				row[i] = GFXRopByte(r, row[i], val, 0xFF);
+		}
 	}
-	
-	for(y = y_top; y<= y_bottom; y++)
+}
+
+/**
+ * @note	State of a frame buffer row filled by GFXDisplayBlitRLE_FB(), source bytes arrive one run at a time
+ */
+typedef struct
+{
+	uint8_t		*row;			//frame buffer byte of the first source byte
+	uint16_t	srcBytes;		//source bytes feeding the row, the same as in GFXDisplayBlit_FB()
+	uint16_t	carry;			//source pixels shifted out of the previous byte
+	uint8_t		shift, leftMask, rightMask, xorMask;
+	GFX_ROP		rop;
+} GFX_RLE_ROW;
+
+/**
+ * @brief	Local function to merge count source bytes of the same value into a frame buffer row, starting with source byte i
+ * @note	Inside the row a run writes the same rotated byte again and again, so only its first byte and the row edges
+ *			go through the shift and mask path.
+ */
+static void GFXDisplayRLERun(GFX_RLE_ROW *pRow, uint16_t i, uint16_t count, uint8_t data)
+{
+	uint16_t bits = bitReverse[data], end = MIN((uint32_t)i + count, (uint32_t)pRow->srcBytes);
+	uint8_t *row = pRow->row;
+	const GFX_ROP_MASKS r = ropMasks[pRow->rop];
+
+	for(; i < end; i++)
 	{
-		for(_x = x; _x < (x+thick); _x++)
+		uint8_t val = (uint8_t)((bits << pRow->shift) | pRow->carry) ^ pRow->xorMask;
+		pRow->carry = bits >> (8 - pRow->shift);
+
+		if(i == 0)
+			row[i] = GFXRopByte(r, row[i], val, pRow->leftMask);
+		else if(i == pRow->srcBytes-1)
+			row[i] = GFXRopByte(r, row[i], val, pRow->rightMask);
+		else
 		{
-			GFXDisplayPutPixel_FB(_x, y, color);
+			row[i] = GFXRopByte(r, row[i], val, 0xFF);
+
+			uint16_t inner = MIN((uint32_t)end, (uint32_t)pRow->srcBytes - 1);	//row[i+1]~row[inner-1] take the same byte
+			if(inner > i + 1)
+			{
+				val = (uint8_t)((bits << pRow->shift) | pRow->carry) ^ pRow->xorMask;
+				GFXRopSpan(&row[i+1], r.and0 ^ ((r.and0 ^ r.and1) & val), r.xor0 ^ ((r.xor0 ^ r.xor1) & val), inner - i - 1);
+				i = inner - 1;
+			}
 		}
 	}
-	
-	GFXDisplayUpdateBlock(y_top+1, y_bottom+1, (uint8_t *)frameBuffer[y_top]);
 }
 
 /**
- * @brief	Draw a rectangle
- * @param	left is the starting position from left (0~DISP_HOR_RESOLUTION-1)
- * @param	top is the starting position from top (0~DISP_VER_RESOLUTION-1)
- * @param	right is the ending position to the right (0~DISP_HOR_RESOLUTION-1)
- * @param	bottom is the ending position to the bottom (0~DISP_HOR_RESOLUTION-1)
- * @param	color is BLACK/WHITE
+ * @brief	Local function to merge count literal source bytes into a frame buffer row, starting with source byte i
  */
-void GFXDisplayDrawRect(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, COLOR color)
+static void GFXDisplayRLELiteral(GFX_RLE_ROW *pRow, uint16_t i, uint16_t count, const uint8_t *data)
 {
-	uint16_t _left=left, _top=top, _right=right, _bottom=bottom;
-	
-	if(left > right)
+	uint16_t end = MIN((uint32_t)i + count, (uint32_t)pRow->srcBytes);
+	uint8_t *row = pRow->row;
+
+	for(; i < end; i++)
 	{
-		_left = right; _right = left;
-	}	
-	
-	if(top > bottom)
+		uint16_t bits = bitReverse[*data++];
+		uint8_t val = (uint8_t)((bits << pRow->shift) | pRow->carry) ^ pRow->xorMask;
+		pRow->carry = bits >> (8 - pRow->shift);
+
+		if(i == 0)
+			row[i] = GFXRopByte(ropMasks[pRow->rop], row[i], val, pRow->leftMask);
+		else if(i == pRow->srcBytes-1)
+			row[i] = GFXRopByte(ropMasks[pRow->rop], row[i], val, pRow->rightMask);
+		else
+			row[i] = GFXRopByte(ropMasks[pRow->rop], row[i], val, 0xFF);
+	}
+}
+
+/**
+ * @brief	Local function to draw a 0x80 row by copying the row above from the frame buffer, edges masked
+ */
+static void GFXDisplayRLECopyRow(GFX_RLE_ROW *pRow, const uint8_t *above)
+{
+	uint8_t *row = pRow->row;
+	uint16_t last = pRow->srcBytes - 1;
+
+	row[0] = (row[0] & ~pRow->leftMask) | (above[0] & pRow->leftMask);
+	if(last)
 	{
-		_top = bottom; _bottom = top;
+		GFXRowCopy<GFXRowKernel>(&row[1], &above[1], last - 1);
+		row[last] = (row[last] & ~pRow->rightMask) | (above[last] & pRow->rightMask);
 	}
-	
-	for(uint16_t y = _top; y <= _bottom; y++)
+}
+
+/**
+ * @return	pointer to the TIMAGE_RLE row after the one data points to, not a 0x80 row
+ */
+static const uint8_t* GFXDisplayRLESkipRow(const uint8_t *data, uint16_t bytesPerLine)
+{
+	for(uint16_t i = 0; i < bytesPerLine; )
 	{
-		for(uint16_t x = _left; x <= _right; x++)
+		int8_t header = (int8_t)*data++;
+		if(header >= 0)
+		{
+			data += header + 1;
+			i += header + 1;
+		}
+		else
 		{
-			GFXDisplayPutPixel_FB(x,y,color);	//update the framebuffer first
+			data++;
+			i += 1 - header;
 		}
 	}
-	
-	GFXDisplayUpdateBlock(_top+1, _bottom+1, (uint8_t *)frameBuffer[_top]);
+	return data;
 }
 
 /**
- * @brief 	Print a picture with byte array created by a shareware LCD Assistant (http://en.radzio.dxp.pl/bitmap_converter/)
- * @note	Option in LCD Assistant: Byte orientation = Horizontal, Other = Include size, endianness=Little<, Pixels/byte=8<br>
- *			This fcn for reference only.
- * @param	left is the top left corner position
- * @param	top is the top line position
- * @param	*data is a pointer to data array in Flash space
- * @param	invert is a boolean flag for negative effect (true for negative, false for normal display)
+ * @brief	Local function to copy a TIMAGE_RLE bitmap into the frame buffer. No display on LCD yet.
+ *			PackBits runs are decoded straight into the frame buffer rows, same clipping and masking as GFXDisplayBlit_FB().
+ * @param	(left,top) is the top left corner position
+ * @param	*data is a pointer to the compressed rows
+ * @param	width, height are the bitmap size in pixels
+ * @param	invert is true to XOR every pixel for negative effect
+ * @param	rop is the raster op merging the bitmap. Only GFX_ROP_SET and GFX_ROP_CLEAR copy 0x80 rows from the row above,
+ *			the others decode them again since the row above depends on what was under it.
  */
- /*
-void GFXDisplayPutPicture(uint16_t left, uint16_t top, const uint8_t* data, bool invert)
+template <class G>
+static void GFXDisplayBlitRLE_FB(uint16_t left, uint16_t top, const uint8_t *data, uint16_t width, uint16_t height, bool invert, GFX_ROP rop)
 {
-	uint16_t imgHeight=0, imgWidth=0;
-	const uint8_t *pdata;
-	uint16_t x, y, _x, _y;
-	uint8_t pixel, bit;
-	COLOR _color;
-	
+	const uint16_t H = G::height(), W = G::bytesPerLine(), first = G::firstRow();
+	const uint16_t bytesPerLine = (width+7)/8;
+
+	if((top > (H-1)) || ((uint32_t)top + height <= first) || ((left>>3) > (W-1)))
+		return;
+
+	uint32_t right  = MIN((uint32_t)left + width - 1, (uint32_t)(W<<3) - 1);
+	uint16_t bottom = MIN((uint32_t)top + height - 1, (uint32_t)H - 1);
+	const GFXRowMap<G> rows;
+	GFX_RLE_ROW r;
+
+	r.shift     = left & 0x07;
+	r.leftMask  = (uint8_t)(0xFF << r.shift);
+	r.rightMask = (uint8_t)(0xFF >> (7 - (right & 0x07)));
+	r.xorMask   = invert ? 0xFF : 0x00;
+	r.rop       = rop;
+	r.srcBytes  = (right >> 3) - (left >> 3) + 1;
+	if(r.srcBytes == 1)
+		r.leftMask &= r.rightMask;
+
+	const uint8_t *rowData = data;		//row drawn, the last one that is not a 0x80 row
+	for(uint16_t y = top; y <= bottom; y++)
+	{
+		bool repeat = (*data == 0x80);
+
+		if(repeat)
+			data++;
+		else
+			rowData = data;
+		if(y < first)	//rows above the band are only parsed
+		{
+			if(!repeat)
+				data = GFXDisplayRLESkipRow(data, bytesPerLine);
+			continue;
+		}
+
+		r.row = rows.at(y) + (left >> 3);
+		if(repeat && (y > first) && ((rop == GFX_ROP_SET) || (rop == GFX_ROP_CLEAR)))	//the row above is in the frame buffer already
+		{
+			GFXDisplayRLECopyRow(&r, rows.at(y-1) + (left >> 3));
+			continue;
+		}
+
+		const uint8_t *src = rowData;
+		r.carry = 0;
+		for(uint16_t i = 0, n; i < bytesPerLine; i += n)
+		{
+			int8_t header = (int8_t)*src++;
+			if(header >= 0)
+			{
+				n = header + 1;
+				GFXDisplayRLELiteral(&r, i, n, src);
+				src += n;
+			}
+			else
+			{
+				n = 1 - header;
+				GFXDisplayRLERun(&r, i, n, *src++);
+			}
+		}
+		if(!repeat)
+			data = src;
+		if(r.srcBytes > bytesPerLine)	//pixels shifted past the last source byte
+			GFXDisplayRLERun(&r, bytesPerLine, 1, 0);
+	}
+}
+
+/**
+ * @brief	Local function to copy a tImage into the frame buffer, raw or compressed. No display on LCD yet.
+ */
+template <class G>
+static void GFXDisplayImage_FB(uint16_t left, uint16_t top, const tImage *image, bool invert, GFX_ROP rop)
+{
+	if(image->compression == TIMAGE_RLE)
+		GFXDisplayBlitRLE_FB<G>(left, top, image->data, image->width, image->height, invert, rop);
+	else
+		GFXDisplayBlit_FB<G>(left, top, image->data, image->width, image->height, (image->width+7)/8, invert, rop);
+}
+
+/**
+ * @brief	Local function to draw a 1-bpp glyph (bit set for the stroke) into the frame buffer. No display on LCD yet.
+ *			Works on whole glyph rows the same way as GFXDisplayBlit_FB(): source bytes are shifted into place and merged
+ *			with a mask of the stroke pixels, plus the background pixels unless bg is TRANSPARENT.
+ * @param	(left,top) is the top left corner position
+ * @param	*data is a pointer to the glyph rows, bytesPerLine apart
+ * @param	width, height are the glyph size in pixels
+ * @param	bLittleEndian is true when the leftmost pixel is in the LSB (BFC_LITTLE_ENDIAN), false for the MSB
+ * @param	color is the stroke color BLACK/WHITE, bg is the background color BLACK/WHITE/TRANSPARENT
+ * @param	rop is the raster op merging the stroke and background pixels, GFX_ROP_SET to draw them
+ */
+template <class G>
+static void GFXDisplayGlyph_FB(uint16_t left, uint16_t top, const uint8_t *data, uint16_t width, uint16_t height, uint16_t bytesPerLine,
+								bool bLittleEndian, COLOR color, COLOR bg, GFX_ROP rop)
+{
+	const uint16_t H = G::height(), W = G::bytesPerLine(), first = G::firstRow();
+
+	if((width == 0) || (height == 0) || (top > (H-1)) || ((uint32_t)top + height <= first) || ((left>>3) > (W-1)))
+		return;
+
+	uint32_t right  = MIN((uint32_t)left + width - 1, (uint32_t)(W<<3) - 1);
+	uint16_t bottom = MIN((uint32_t)top + height - 1, (uint32_t)H - 1);
+	if(top < first)
+	{
+		data += (uint32_t)(first - top)*bytesPerLine;
+		top = first;
+	}
+	uint16_t firstByte = left >> 3;
+	uint16_t lastByte  = right >> 3;
+	uint8_t shift      = left & 0x07;
+	uint8_t leftMask   = (uint8_t)(0xFF << shift);
+	uint8_t rightMask  = (uint8_t)(0xFF >> (7 - (right & 0x07)));
+	uint8_t fgSet      = (color == WHITE) ? 0xFF : 0x00;		//anything but WHITE is drawn BLACK as GFXDisplayPutPixel_FB() does
+	uint8_t bgOn       = (bg == TRANSPARENT) ? 0x00 : 0xFF;
+	uint8_t bgSet      = (bg == WHITE) ? 0xFF : 0x00;
+	uint16_t srcBytes  = lastByte - firstByte + 1;
+	const GFX_ROP_MASKS r = ropMasks[rop];
+	const bool kernels = (srcBytes >= GFX_MERGE_MIN_BYTES + 2);
+	const GFXRowMap<G> rows;
+	GFX_MERGE merge;
+
+	if(firstByte == lastByte)
+		leftMask &= rightMask;
+
+	//inner bytes: the stroke, inverted for a BLACK stroke on WHITE, or the stroke pixels alone on TRANSPARENT
+	if(!bgOn)
+		merge = GFXMergeOf(r, 0x00, true, (fgSet ? WHITE : BLACK));
+	else if(fgSet != bgSet)
+		merge = GFXMergeOf(r, (uint8_t)~fgSet, false, BLACK);
+	else		//stroke and background of one color: a rectangle
+	{
+		merge = GFXMergeOf(r, 0x00, false, BLACK);
+		merge.op = (fgSet ? r.and1 : r.and0) ? (((fgSet ? r.xor1 : r.xor0) ? GFX_MERGE_INVERT : GFX_MERGE_NONE)) : GFX_MERGE_FILL;
+		merge.fill = fgSet ? r.xor1 : r.xor0;
+	}
+
+	for(uint16_t y = top; y <= bottom; y++, data += bytesPerLine)
+	{
+		uint8_t *row = rows.at(y) + firstByte;
+		uint16_t carry = 0;
+
+		for(uint16_t i = 0; i < srcBytes; i++)
+		{
+			if((i == 1) && kernels)	//inner bytes by the row kernels
+			{
+				carry = GFXDisplayMergeRow(row, data, bytesPerLine, 1, srcBytes - 1, shift, carry, !bLittleEndian, &merge);
+				i = srcBytes - 1;
+			}
+
+			uint16_t bits = 0;
+			if(i < bytesPerLine)
+				bits = bLittleEndian ? data[i] : bitReverse[data[i]];
+			uint8_t stroke = (uint8_t)((bits << shift) | carry);
+			carry = bits >> (8 - shift);
+
+			uint8_t mask = (i == 0) ? leftMask : ((i == srcBytes-1) ? rightMask : 0xFF);
+			uint8_t fg = stroke & mask;
+			uint8_t bgm = (uint8_t)~stroke & mask & bgOn;
+			row[i] = GFXRopByte(r, row[i], (fg & fgSet) | (bgm & bgSet), fg | bgm);
+		}
+	}
+}
+
+static const uint8_t dummyBytes[2] = {0x00, 0x00};	//16 dummy clocks closing a data update
+
+/**
+ * @brief	Local function to write the pixels x1~x2 (x1<=x2) of a frame buffer row with dst = (dst & a) ^ x, clipped to 0~xMax.
+ *			A row of 0 is outside the frame buffer and nothing is written.
+ */
+static inline void GFXDisplayRowSpan(uint8_t *row, int32_t x1, int32_t x2, int32_t xMax, uint8_t a, uint8_t x)
+{
+	if((row == 0) || (x2 < 0) || (x1 > xMax))
+		return;
+
+	if(x1 < 0)
+		x1 = 0;
+	if(x2 > xMax)
+		x2 = xMax;
+
+	uint16_t firstByte = (uint16_t)(x1 >> 3), lastByte = (uint16_t)(x2 >> 3);
+	uint8_t leftMask  = (uint8_t)(0xFF << (x1 & 0x07));
+	uint8_t rightMask = (uint8_t)(0xFF >> (7 - (x2 & 0x07)));
+
+	if(firstByte == lastByte)	//steep parts of outlines: a few pixels in one byte
+	{
+		leftMask &= rightMask;
+		row[firstByte] = (row[firstByte] & (a | (uint8_t)~leftMask)) ^ (x & leftMask);
+		return;
+	}
+
+	row[firstByte] = (row[firstByte] & (a | (uint8_t)~leftMask)) ^ (x & leftMask);
+	if(lastByte - firstByte > 1)
+		GFXRopSpan(&row[firstByte+1], a, x, lastByte - firstByte - 1);
+	row[lastByte] = (row[lastByte] & (a | (uint8_t)~rightMask)) ^ (x & rightMask);
+}
+
+/**
+ * @brief	Local function to fill the horizontal span x1~x2 (x1<=x2) of row y with byte masks, clipped to the frame buffer. No display on LCD yet.
+ * @note	Strip charts pass GFX_ROP_SET: a trace writes some pixels twice.
+ */
+template <class G>
+static void GFXDisplaySpan_FB(int32_t x1, int32_t x2, int32_t y, COLOR color, GFX_ROP rop)
+{
+	if((y < (int32_t)G::firstRow()) || (y > (G::height()-1)))
+		return;
+
+	GFXDisplayRowSpan(G::row((uint16_t)y), x1, x2, ((int32_t)G::bytesPerLine() << 3) - 1,
+					  (color == WHITE) ? ropMasks[rop].and1 : ropMasks[rop].and0, (color == WHITE) ? ropMasks[rop].xor1 : ropMasks[rop].xor0);
+}
+
+/**
+ * @brief	Frame buffer rows of the outline and fill loops of circles and ellipses: row(y) is the row y given in signed
+ *			coordinates or 0 outside the frame buffer, span() writes a run of it with GFX_ROP_SET. The midpoint steps write
+ *			some pixels twice, so no other raster op is used.
+ */
+template <class G>
+struct GFXShapeRows
+{
+	const GFXRowMap<G> rows;
+	const int32_t yFirst, yLast, xMax;
+	const uint8_t a, x;		//dst = (dst & a) ^ x
+
+	inline GFXShapeRows(COLOR color) : yFirst(G::firstRow()), yLast((int32_t)G::height() - 1), xMax(((int32_t)G::bytesPerLine() << 3) - 1),
+									   a((color == WHITE) ? ropMasks[GFX_ROP_SET].and1 : ropMasks[GFX_ROP_SET].and0),
+									   x((color == WHITE) ? ropMasks[GFX_ROP_SET].xor1 : ropMasks[GFX_ROP_SET].xor0) {}
+
+	inline uint8_t* row(int32_t y) const	{ return ((y < yFirst) || (y > yLast)) ? 0 : rows.at((uint16_t)y); }
+	inline void span(uint8_t *row, int32_t x1, int32_t x2) const	{ GFXDisplayRowSpan(row, x1, x2, xMax, a, x); }
+};
+
+/**
+ * @brief	Local function to draw a line (x1,y1)~(x2,y2) into the frame buffer with Bresenham's algorithm. No display on LCD yet.
+ *			The pixels of a row are collected into a byte mask written once per byte, so a flat line costs a byte write per
+ *			8 pixels and a steep one a byte write per row, with the row pointer moving down instead of being looked up.
+ *			Every pixel is written once, so GFX_ROP_XOR and GFX_ROP_NOT lines drawn twice leave the frame buffer as it was.
+ */
+template <class G>
+static void GFXDisplayLine_FB(int32_t x1, int32_t y1, int32_t x2, int32_t y2, COLOR color, GFX_ROP rop)
+{
+	if(y1 > y2)	//always walk down, one row after the other
+	{
+		int32_t t = x1; x1 = x2; x2 = t;
+		t = y1; y1 = y2; y2 = t;
+	}
+
+	const uint16_t W = G::bytesPerLine();
+	const int32_t xMax = ((int32_t)W << 3) - 1, yEnd = MIN(y2, (int32_t)G::height() - 1), yFirst = G::firstRow();
+
+	if((y1 > yEnd) || (y2 < yFirst))
+		return;
+
+	const int32_t dx = (x2 > x1) ? (x2 - x1) : (x1 - x2);
+	const int32_t dy = y2 - y1;
+	const int32_t sx = (x1 < x2) ? 1 : -1;
+	int32_t err = dx - dy;
+	int32_t x = x1, y = y1;
+
+	const uint8_t a = (color == WHITE) ? ropMasks[rop].and1 : ropMasks[rop].and0;	//dst = (dst & a) ^ x
+	const uint8_t xr = (color == WHITE) ? ropMasks[rop].xor1 : ropMasks[rop].xor0;
+	const GFXRowMap<G> rows;
+	uint8_t *row = rows.at((uint16_t)MAX(y, yFirst));	//stays on the first row until the line reaches it
+	uint16_t last = rows.last((uint16_t)MAX(y, yFirst));
+	int32_t col = 0;	//byte of the pixels collected in bits
+	uint8_t bits = 0;
+
+	for(;;)
+	{
+		if(((uint32_t)x <= (uint32_t)xMax) && (y >= yFirst))
+		{
+			if((x >> 3) != col)
+			{
+				if(bits)
+					row[col] = (row[col] & (a | (uint8_t)~bits)) ^ (xr & bits);
+				bits = 0;
+				col = x >> 3;
+			}
+			bits |= (uint8_t)(0x01 << (x & 0x07));
+		}
+		if((x == x2) && (y == y2))
+			break;
+
+		int32_t e2 = 2*err;
+		if(e2 > -dy)
+		{
+			err -= dy;
+			x += sx;
+		}
+		if(e2 < dx)
+		{
+			err += dx;
+			if(bits)	//the row is complete
+				row[col] = (row[col] & (a | (uint8_t)~bits)) ^ (xr & bits);
+			bits = 0;
+			if(++y > yEnd)
+				return;
+			if((y > yFirst) && (y <= last))
+				row += rows.stride;
+			else if(y > yFirst)
+			{
+				row = rows.at((uint16_t)y);
+				last = rows.last((uint16_t)y);
+			}
+		}
+	}
+	if(bits)
+		row[col] = (row[col] & (a | (uint8_t)~bits)) ^ (xr & bits);
+}
+
+/**
+ * @brief	Local function to draw (fill=false) or fill (fill=true) a circle into the frame buffer with the midpoint algorithm. No display on LCD yet.
+ *			The rows y0+-y and y0+-x of a step are looked up once. The octants close to the top and bottom are drawn as
+ *			horizontal runs, the others as single pixels, a fill is one span per row.
+ */
+template <class G>
+static void GFXDisplayCircle_FB(int32_t x0, int32_t y0, int32_t r, COLOR color, bool fill)
+{
+	const GFXShapeRows<G> fb(color);
+	int32_t x = r, y = 0, err = 1 - r, runStart = 0;
+
+	while(x >= y)
+	{
+		uint8_t *below = fb.row(y0+y), *above = fb.row(y0-y);
+		if(fill)
+		{
+			fb.span(below, x0-x, x0+x);
+			fb.span(above, x0-x, x0+x);
+		}
+		else
+		{
+			fb.span(below, x0+x, x0+x); fb.span(below, x0-x, x0-x);
+			fb.span(above, x0+x, x0+x); fb.span(above, x0-x, x0-x);
+		}
+
+		int32_t xLast = x, yLast = y;
+		y++;
+		if(err < 0)
+			err += 2*y + 1;
+		else
+		{
+			x--;
+			err += 2*(y - x) + 1;
+		}
+
+		if((x != xLast) || (x < y))	//rows y0+-xLast are complete: columns runStart~yLast on both sides
+		{
+			below = fb.row(y0+xLast); above = fb.row(y0-xLast);
+			if(fill)
+			{
+				fb.span(below, x0-yLast, x0+yLast);
+				fb.span(above, x0-yLast, x0+yLast);
+			}
+			else
+			{
+				fb.span(below, x0+runStart, x0+yLast); fb.span(below, x0-yLast, x0-runStart);
+				fb.span(above, x0+runStart, x0+yLast); fb.span(above, x0-yLast, x0-runStart);
+			}
+			runStart = y;
+		}
+	}
+}
+
+/**
+ * @brief	Local function to write the pixels (x0+-x1~x0+-x2, y0+-y) of an ellipse quadrant pair, or the span x0-x2~x0+x2 of the rows for a fill
+ */
+template <class G>
+static inline void GFXDisplayEllipseRows_FB(const GFXShapeRows<G> &fb, int32_t x0, int32_t y0, int32_t x1, int32_t x2, int32_t y, bool fill)
+{
+	uint8_t *below = fb.row(y0+y), *above = y ? fb.row(y0-y) : 0;
+
+	if(fill)
+	{
+		fb.span(below, x0-x2, x0+x2);
+		fb.span(above, x0-x2, x0+x2);
+		return;
+	}
+
+	fb.span(below, x0+x1, x0+x2);
+	fb.span(below, x0-x2, x0-x1);
+	fb.span(above, x0+x1, x0+x2);
+	fb.span(above, x0-x2, x0-x1);
+}
+
+/**
+ * @brief	Local function to draw (fill=false) or fill (fill=true) an ellipse into the frame buffer with the midpoint algorithm. No display on LCD yet.
+ *			Decision variables are scaled by 4 to stay in integers. In the flat region every row is one run, in the steep region one pixel.
+ * @note	rx and ry up to 0x3FFF keep the decision variables within 64 bits.
+ */
+template <class G>
+static void GFXDisplayEllipse_FB(int32_t x0, int32_t y0, int32_t rx, int32_t ry, COLOR color, bool fill)
+{
+	const GFXShapeRows<G> fb(color);
+
+	if(ry == 0)	//flat ellipse, the midpoint steps below would only reach the center
+	{
+		fb.span(fb.row(y0), x0-rx, x0+rx);
+		return;
+	}
+
+	const int64_t a2 = (int64_t)rx*rx, b2 = (int64_t)ry*ry;
+	int32_t x = 0, y = ry, runStart = 0;
+	int64_t p = 4*b2 - 4*a2*ry + a2;
+	int64_t px = 0, py = 2*a2*ry;	//2*b2*x and 2*a2*y, stepped along with x and y
+
+	while(px < py)	//region 1, slope above -1: x steps every time
+	{
+		int32_t xLast = x, yLast = y;
+		x++;
+		px += 2*b2;
+		if(p < 0)
+			p += 4*(px + b2);
+		else
+		{
+			y--;
+			py -= 2*a2;
+			p += 4*(px - py + b2);
+		}
+		if(y != yLast)
+		{
+			GFXDisplayEllipseRows_FB<G>(fb, x0, y0, runStart, xLast, yLast, fill);
+			runStart = x;
+		}
+	}
+	if(x > runStart)	//pending run of the last row in region 1
+		GFXDisplayEllipseRows_FB<G>(fb, x0, y0, runStart, x-1, y, fill);
+
+	p = b2*(2*x+1)*(2*x+1) + 4*a2*(int64_t)(y-1)*(y-1) - 4*a2*b2;
+	while(y >= 0)		//region 2, y steps every time
+	{
+		GFXDisplayEllipseRows_FB<G>(fb, x0, y0, x, x, y, fill);
+		y--;
+		py -= 2*a2;
+		if(p > 0)
+			p += 4*(a2 - py);
+		else
+		{
+			x++;
+			px += 2*b2;
+			p += 4*(px - py + a2);
+		}
+	}
+}
+
+template <class G> static void GFXDisplayLineHeader(uint16_t line, uint8_t *header);
+static void GFXDisplayVcomUpdate(void);
+template <class G> static bool GFXDisplayLineChanged(uint16_t line, const uint8_t *buf);
+#if (GFX_SHADOW == GFX_SHADOW_HASH)
+static uint32_t GFXDisplayLineHash(const uint8_t *buf, uint16_t len);
+#endif
+template <class G> static void GFXDisplayUpdateLine(uint16_t line);
+template <class G> static void GFXDisplayUpdateBlock(uint16_t start_line, uint16_t end_line);
+template <class G> static uint16_t GFXDisplayUpdateDirty(uint16_t top, uint16_t end);
+static uint16_t bfc_DrawChar_RowRowUnpacked(uint16_t x0, uint16_t y0, const BFC_FONT *pFont, uint16_t ch, COLOR color, COLOR bg, GFX_ROP rop);
+static uint16_t GFXDisplayBandRender(void);
+
+/**
+ * @note	Drawing calls recorded in the display list of a banded display
+ */
+enum
+{
+	GFX_BAND_RECT = 0,
+	GFX_BAND_LINE,
+	GFX_BAND_CIRCLE,
+	GFX_BAND_ELLIPSE,
+	GFX_BAND_IMAGE,
+	GFX_BAND_TEXT
+};
+
+/**
+ * @note	Display list entry, copied in and out with memcpy() since the list is a byte array. GFX_BAND_TEXT entries are
+ *			followed by len 16-bit characters.
+ */
+typedef struct
+{
+	const void	*ptr;			//GFX_BAND_IMAGE: tImage, GFX_BAND_TEXT: BFC_FONT
+	uint16_t	x1, y1, x2, y2;	//bounding box clipped to the LCD, its rows pick the bands the entry is replayed in
+	uint16_t	p[4];			//arguments of the drawing call
+	uint8_t		op;				//GFX_BAND_* in bits 0~3, GFX_ROP of the call in bits 4~7
+	uint8_t		color;			//COLOR, GFX_BAND_TEXT: background in bits 4~7, GFX_BAND_ELLIPSE: fill in bit 4
+	uint16_t	len;			//GFX_BAND_TEXT: characters following the entry
+} GFX_BAND_ENTRY;
+
+/**
+ * @brief	Local function to append a drawing call to the display list of the selected (banded) display. No display on LCD yet.
+ * @param	*pEntry has ptr, p[], op, color and len set, the bounding box is filled in here
+ * @param	x1,y1,x2,y2 is the bounding box of the pixels drawn, it may reach outside the LCD
+ * @param	opaque is true when the call writes every pixel of its box. Entries inside the box are hidden then and removed,
+ *			unless the raster op merges the call with what is below.
+ * @param	*text or *wtext are the len characters of GFX_BAND_TEXT, NULL otherwise
+ * @note	A call that does not fit into the list is dropped and counted in bandDropped. The raster op of the display is
+ *			recorded with the call, circles and ellipses are always drawn with GFX_ROP_SET.
+ */
+static void GFXDisplayBandAdd(GFX_BAND_ENTRY *pEntry, int32_t x1, int32_t y1, int32_t x2, int32_t y2, bool opaque,
+							  const char *text, const uint16_t *wtext)
+{
+	const int32_t xMax = ((int32_t)gfx->pDesc->bytesPerLine << 3) - 1, yMax = (int32_t)gfx->pDesc->height - 1;
+
+	if((x1 > x2) || (y1 > y2) || (x2 < 0) || (y2 < 0) || (x1 > xMax) || (y1 > yMax))
+		return;		//nothing on the LCD
+
+	GFX_ROP rop = ((pEntry->op == GFX_BAND_CIRCLE) || (pEntry->op == GFX_BAND_ELLIPSE)) ? GFX_ROP_SET : gfx->rop;
+	pEntry->op |= (uint8_t)(rop << 4);
+	opaque = opaque && ((rop == GFX_ROP_SET) || (rop == GFX_ROP_CLEAR));
+
+	pEntry->x1 = (uint16_t)MAX(x1, (int32_t)0);
+	pEntry->y1 = (uint16_t)MAX(y1, (int32_t)0);
+	pEntry->x2 = (uint16_t)MIN(x2, xMax);
+	pEntry->y2 = (uint16_t)MIN(y2, yMax);
+
+	uint8_t *list = gfx->bandList;
+	uint32_t size = sizeof(GFX_BAND_ENTRY) + (uint32_t)pEntry->len*sizeof(uint16_t);
+	GFX_BAND_ENTRY e;
+
+	for(uint32_t off = 0; opaque && (off < gfx->bandListLen); )		//drop what the new call paints over
+	{
+		memcpy(&e, &list[off], sizeof(e));
+		uint32_t eSize = sizeof(GFX_BAND_ENTRY) + (uint32_t)e.len*sizeof(uint16_t);
+
+		if((e.x1 >= pEntry->x1) && (e.x2 <= pEntry->x2) && (e.y1 >= pEntry->y1) && (e.y2 <= pEntry->y2))
+		{
+			memmove(&list[off], &list[off + eSize], gfx->bandListLen - off - eSize);
+			gfx->bandListLen -= (uint16_t)eSize;
+		}
+		else
+			off += eSize;
+	}
+
+	if((uint32_t)gfx->bandListLen + size > gfx->bandListSize)
+	{
+		gfx->bandDropped++;
+		return;
+	}
+
+	memcpy(&list[gfx->bandListLen], pEntry, sizeof(GFX_BAND_ENTRY));
+	uint8_t *chars = &list[gfx->bandListLen + sizeof(GFX_BAND_ENTRY)];
+	for(uint16_t i = 0; i < pEntry->len; i++, chars += sizeof(uint16_t))
+	{
+		uint16_t ch = (text != NULL) ? (uint16_t)text[i] : wtext[i];
+		memcpy(chars, &ch, sizeof(ch));
+	}
+	gfx->bandListLen += (uint16_t)size;
+}
+
+/**
+ * @brief	Local functions to record a drawing call of a banded display, same arguments as the frame buffer kernels
+ */
+static void GFXDisplayRecordRect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, COLOR color)
+{
+	GFX_BAND_ENTRY entry = {NULL, 0, 0, 0, 0, {0, 0, 0, 0}, GFX_BAND_RECT, (uint8_t)color, 0};
+	GFXDisplayBandAdd(&entry, x1, y1, x2, y2, true, NULL, NULL);
+}
+
+static void GFXDisplayRecordLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, COLOR color)
+{
+	GFX_BAND_ENTRY entry = {NULL, 0, 0, 0, 0, {x1, y1, x2, y2}, GFX_BAND_LINE, (uint8_t)color, 0};
+	GFXDisplayBandAdd(&entry, MIN(x1, x2), MIN(y1, y2), MAX(x1, x2), MAX(y1, y2), (x1 == x2) || (y1 == y2), NULL, NULL);
+}
+
+static void GFXDisplayRecordEllipse(uint16_t x0, uint16_t y0, uint16_t rx, uint16_t ry, COLOR color, bool fill)
+{
+	GFX_BAND_ENTRY entry = {NULL, 0, 0, 0, 0, {x0, y0, rx, ry}, GFX_BAND_ELLIPSE, (uint8_t)(color | (fill << 4)), 0};
+	GFXDisplayBandAdd(&entry, (int32_t)x0 - rx, (int32_t)y0 - ry, (int32_t)x0 + rx, (int32_t)y0 + ry, false, NULL, NULL);
+}
+
+static void GFXDisplayRecordCircle(uint16_t x0, uint16_t y0, uint16_t r, COLOR color, bool fill)
+{
+	GFX_BAND_ENTRY entry = {NULL, 0, 0, 0, 0, {x0, y0, r, (uint16_t)fill}, GFX_BAND_CIRCLE, (uint8_t)color, 0};
+	GFXDisplayBandAdd(&entry, (int32_t)x0 - r, (int32_t)y0 - r, (int32_t)x0 + r, (int32_t)y0 + r, false, NULL, NULL);
+}
+
+static void GFXDisplayRecordImage(uint16_t left, uint16_t top, const tImage *image, bool invert)
+{
+	GFX_BAND_ENTRY entry = {image, 0, 0, 0, 0, {left, top, (uint16_t)invert, 0}, GFX_BAND_IMAGE, 0, 0};
+	GFXDisplayBandAdd(&entry, left, top, (int32_t)left + image->width - 1, (int32_t)top + image->height - 1, true, NULL, NULL);
+}
+
+/**
+ * @return	width of the text, the same as it is drawn
+ */
+static uint16_t GFXDisplayRecordText(uint16_t x, uint16_t y, const BFC_FONT *pFont, const char *text, const uint16_t *wtext, COLOR color, COLOR bg)
+{
+	uint16_t len = 0, width = 0;
+
+	for(; (text != NULL) ? (text[len] != '\0') : (wtext[len] != '\0'); len++)
+		width += GFXDisplayGetCharWidth(pFont, (text != NULL) ? (uint16_t)text[len] : wtext[len]);
+
+	GFX_BAND_ENTRY entry = {pFont, 0, 0, 0, 0, {x, y, 0, 0}, GFX_BAND_TEXT, (uint8_t)(color | (bg << 4)), len};
+	if(width && pFont->FontHeight)
+		GFXDisplayBandAdd(&entry, x, y, (int32_t)x + width - 1, (int32_t)y + pFont->FontHeight - 1, bg != TRANSPARENT, text, wtext);
+	return width;
+}
+
+/**
+ * @brief	Local function to refresh the frame buffer rows top~bottom on the LCD.
+ *			In GFX_FLUSH_DEFERRED mode the rows are only marked dirty until GFXDisplayFlush() is called.
+ *			A banded display renders them from its display list.
+ * @param	top is the first row in range 0 ~ (DISP_VER_RESOLUTION-1)
+ * @param	bottom is the last row, clipped to (DISP_VER_RESOLUTION-1)
+ */
+static void GFXDisplayCommitLines(uint16_t top, uint16_t bottom)
+{
+	const uint16_t H = gfx->pDesc->height;
+
+	if((top > bottom) || (top > (H-1)))
+		return;
+
+	if(bottom > (H-1))
+		bottom = H-1;
+
+	if((gfx->flushMode == GFX_FLUSH_DEFERRED) || gfx->bandLines)
+	{
+		uint8_t *dirty = gfx->dirtyLines;
+		uint16_t first = top >> 3, last = bottom >> 3;
+		uint8_t topMask = (uint8_t)(0xFF << (top & 0x07)), bottomMask = (uint8_t)(0xFF >> (7 - (bottom & 0x07)));
+		if(first == last)	//8 lines a byte, a tall shape marks most of them with whole bytes
+			dirty[first] |= (uint8_t)(topMask & bottomMask);
+		else
+		{
+			dirty[first] |= topMask;
+			for(uint16_t i = first + 1; i < last; i++)
+				dirty[i] = 0xFF;
+			dirty[last] |= bottomMask;
+		}
+		if(gfx->flushMode == GFX_FLUSH_IMMEDIATE)	//a banded display has the rows to send once they are rendered
+			GFXDisplayBandRender();
+	}
+	else
+		GFX_GEOMETRY_CALL(GFXDisplayUpdateBlock, top+1, bottom+1);	//Line counts from 1 thats why +1
+}
+
+/**
+ * @brief Clear memory internal data and writes white for all pixels
+ */
+void GFXDisplayAllClear(void)
+{
+  const GFX_DISPLAY_DESC *pDesc = gfx->pDesc;
+
+  GFXDisplayFlushWait();	//the SPI bus is busy until an asynchronous flush is complete
+  GFXDisplayVcomUpdate();
+  hal_spi_start_transaction();
+  hal_delayUs(pDesc->scsSetupUs); //SCS setup time of tsSCS (refer to datasheet for timing details)
+  hal_spi_write_byte(0x04|vcomBit); //M0="L", M2="H" with LSB sent first, M1=VCOM in GFX_VCOM_SERIAL
+  hal_spi_write_byte(0x00);
+  hal_delayUs(pDesc->scsHoldUs); //SCS hold time of thSCS (refer to datasheet for timing details)
+  hal_spi_end_transaction();  
+  GFX_STATS_ADD(transactions, 1);
+  GFX_STATS_ADD(headerBytes, 1);
+  GFX_STATS_ADD(dummyBytes, 1);
+  GFX_STATS_ADD(delayUs, pDesc->scsSetupUs + pDesc->scsHoldUs);
+
+  GFXRowFill<GFXRowKernel>(gfx->frameBuffer, 0xFF, (uint32_t)(gfx->bandLines ? gfx->bandLines : pDesc->height) *
+                                                  (pDesc->bytesPerLine + GFX_FB_HEADER));  //clear SRAM of the MCU, GFX_LINE_HEADERS are written again when sent
+  memset((void *)gfx->dirtyLines, 0x00, (pDesc->height + 7) / 8);     //LCD and frame buffer are in sync now, nothing left to flush
+  gfx->bandListLen = 0;   //a banded display starts over with an empty display list
+  gfx->bandDropped = 0;
+#if (GFX_SHADOW == GFX_SHADOW_COPY)
+  if(gfx->shadow)
+  {
+    GFXRowFill<GFXRowKernel>((uint8_t *)gfx->shadow, 0xFF, (uint32_t)pDesc->height * pDesc->bytesPerLine);
+    gfx->shadowValid = true;
+  }
+#elif (GFX_SHADOW == GFX_SHADOW_HASH)
+  if(gfx->shadow)
+  {
+    uint32_t whiteHash = GFXDisplayLineHash(gfx->frameBuffer + GFX_FB_HEADER, pDesc->bytesPerLine);
+    for(uint16_t y = 0; y < pDesc->height; y++)
+      ((uint32_t *)gfx->shadow)[y] = whiteHash;
+    gfx->shadowValid = true;
+  }
+#endif
+}
+
+/**
+ * @brief Power-on sequence with 5V0 enabled, clear pixel memory (x2), DISP pin set high, and EXTCOMIN pulse started<br>
+ *        Normal operation after this function executed. EXTCOMIN_FREQ indicates the pulse frequency defined in MemoryLCD.h
+ */
+void GFXDisplayPowerOn(void)
+{
+  //hal_gpio_write(GFX_5V0_EN, HIGH); //turn ON TPS60140 for 5V0, only useful when a gpio wired to EN pin of TPS60140
+  //hal_delayMs(10); 		//stablize 5V0, allow more time for it otherwise there is startup problem.
+  GFXDisplayAllClear();	//need to do it twice for clear pixel memory (somehow); otherwise, pixel memory not always cleared!!!
+  GFXDisplayAllClear();
+
+  GFXDisplayOn(); //DISP = '1'
+  hal_delayUs(30);
+#if (GFX_VCOM == GFX_VCOM_EXTCOMIN)
+  hal_extcom_start(EXTCOMIN_FREQ); //turn on EXTCOMIN pulse
+  hal_delayUs(30);
+#endif
+  //normal operation after this...
+}
+
+/**
+ * @brief	Display OFF with DISP pin set '1'
+ */
+void GFXDisplayOn(void)
+{
+	hal_gpio_write(GFX_DISPLAY_DISP, HIGH); //DISP = '1'
+}
+
+/**
+ * @brief Power-off sequence with all pixels set white, DISP pin set low, EXTCOMIN pulse stopped, and 5V0 disabled.<br>
+ *        Need to run GFXDisplayPowerOn() after this function if we need to write to Memory LCD again.
+ */
+void GFXDisplayPowerOff(void)
+{
+   GFXDisplayAllClear();
+   GFXDisplayOff(); 	//DISP = '0'
+#if (GFX_VCOM == GFX_VCOM_EXTCOMIN)
+   hal_extcom_stop();  	//stop EXTCOMIN pulse
+   hal_delayUs(30);
+#endif
+   //hal_gpio_write(GFX_5V0_EN, LOW); //turn OFF TPS60140 for 5V0, only useful if a GPIO is wired to EN pin of TPS60140
+}
+
+/**
+ * @brief	Display OFF with DISP pin set '0'
+ */
+void GFXDisplayOff(void)
+{
+	hal_gpio_write(GFX_DISPLAY_DISP, LOW); //DISP = '0'
+}
+
+/**
+ * @brief	Keep VCOM alternating in GFX_VCOM_SERIAL mode. When the last inversion is GFX_VCOM_PERIOD_MS old, a display mode
+ *			command (M0=M2=0, 2 bytes) is sent with the inverted M1 bit. Updates sent in time invert VCOM themselves.
+ * @return	true if the display mode command has been sent. Always false in GFX_VCOM_EXTCOMIN mode.
+ * @note	Call it from the main loop or a low-power wakeup at least every GFX_VCOM_PERIOD_MS. It returns at once while an
+ *			asynchronous flush is in progress, the next call sends the command.<br>
+ *			Example to use<br>
+ *				GFXDisplayVcomService();	//in loop(), replaces the EXTCOMIN timer interrupt
+ */
+bool GFXDisplayVcomService(void)
+{
+#if (GFX_VCOM == GFX_VCOM_SERIAL)
+	if(((hal_millis() - vcomToggleMs) < GFX_VCOM_PERIOD_MS) || GFXDisplayFlushBusy())
+		return false;
+
+	GFXDisplayVcomUpdate();
+	hal_spi_start_transaction();
+	hal_delayUs(gfx->pDesc->scsSetupUs); //SCS setup time of tsSCS (refer to datasheet for timing details)
+	hal_spi_write_byte(vcomBit); //M0="L", M2="L": display mode, M1=VCOM
+	hal_spi_write_byte(0x00);
+	hal_delayUs(gfx->pDesc->scsHoldUs); //SCS hold time of thSCS (refer to datasheet for timing details)
+	hal_spi_end_transaction();
+	GFX_STATS_ADD(transactions, 1);
+	GFX_STATS_ADD(headerBytes, 1);
+	GFX_STATS_ADD(dummyBytes, 1);
+	GFX_STATS_ADD(delayUs, gfx->pDesc->scsSetupUs + gfx->pDesc->scsHoldUs);
+	return true;
+#else
+	return false;
+#endif
+}
+
+/**
+ * @brief	Local function to set the M1 bit of the next transaction, inverted once GFX_VCOM_PERIOD_MS has passed since the last change.
+ *			Nothing to do in GFX_VCOM_EXTCOMIN mode.
+ */
+static void GFXDisplayVcomUpdate(void)
+{
+#if (GFX_VCOM == GFX_VCOM_SERIAL)
+	uint32_t now = hal_millis();
+
+	if((now - vcomToggleMs) >= GFX_VCOM_PERIOD_MS)
+	{
+		vcomBit ^= 0x02;
+		vcomToggleMs = now;
+	}
+#endif
+}
+
+/**
+ * @brief	Print a single pixel
+ * @param	(x,y) indicate the position
+ * @param	color is BLACK/WHITE
+ */
+void GFXDisplayPutPixel(uint16_t x, uint16_t y, COLOR color)
+{
+	if(gfx->bandLines)
+	{
+		GFXDisplayRecordRect(x, y, x, y, color);
+		GFXDisplayCommitLines(y, y);
+		return;
+	}
+
+	GFX_GEOMETRY_CALL(GFXDisplayPutPixel_FB, x, y, color, gfx->rop);
+	if(gfx->flushMode == GFX_FLUSH_DEFERRED)
+		GFXDisplayCommitLines(y, y);
+	else
+		GFX_GEOMETRY_CALL(GFXDisplayUpdateLine, y+1);	//Update on screen. Line counts from 1 thats why y+1
+}
+
+/**
+ * @brief	Draw a horizontal line 
+ * @param	x1 is the starting coordinate(0~DISP_HOR_RESOLUTION-1)
+ * @param	x2 is the ending coordinate(0~DISP_HOR_RESOLUTION-1)
+ * @param	y is the line position (0~DISP_VER_RESOLUTION-1)
+ * @param	color is BLACK/WHITE
+ * @param	thick is the thickness in pixels ranges 1~255
+ */
+void GFXDisplayLineDrawH(uint16_t x1, uint16_t x2, uint16_t y, COLOR color, uint8_t thick)
+{
+	if(thick==0) return;
+	
+	uint16_t x_left, x_right, y_bottom;
+	
+	if(x1 > x2)
+	{
+		x_right = x1; x_left = x2;
+	}
+	else
+	{
+		x_right = x2; x_left = x1;
+	}
+
+	y_bottom = MIN((uint32_t)y+thick-1, (uint32_t)0xFFFF);
+	if(gfx->bandLines)
+		GFXDisplayRecordRect(x_left, y, x_right, y_bottom, color);
+	else
+		GFX_GEOMETRY_CALL(GFXDisplayFillRect_FB, x_left, y, x_right, y_bottom, color, gfx->rop);
+
+	GFXDisplayCommitLines(y, y_bottom);
+}
+
+/**
+ * @brief	Draw a vertical line
+ * @param	x is the horizontal position (0~DISP_HOR_RESOLUTION-1)
+ * @param	y1 is the starting y position (0~DISP_VER_RESOLUTION-1)
+ * @param	y2 is the ending y position (0~DISP_VER_RESOLUTION-1)
+ * @param	color is BLACK/WHITE
+ * @param	thick is the thickness in pixels ranges 1~255
+ */
+void GFXDisplayLineDrawV(uint16_t x, uint16_t y1, uint16_t y2, COLOR color, uint8_t thick)
+{
+	if(thick==0) return;
+	
+	uint16_t x_right, y_top, y_bottom;
+	
+	if(y1 > y2)
+	{
+		y_bottom = y1; y_top = y2;
+	}
+	else
+	{
+		y_bottom = y2; y_top = y1;
+	}
+
+	x_right = MIN((uint32_t)x+thick-1, (uint32_t)0xFFFF);
+	if(gfx->bandLines)
+		GFXDisplayRecordRect(x, y_top, x_right, y_bottom, color);
+	else
+		GFX_GEOMETRY_CALL(GFXDisplayFillRect_FB, x, y_top, x_right, y_bottom, color, gfx->rop);
+	
+	GFXDisplayCommitLines(y_top, y_bottom);
+}
+
+/**
+ * @brief	Draw a rectangle
+ * @param	left is the starting position from left (0~DISP_HOR_RESOLUTION-1)
+ * @param	top is the starting position from top (0~DISP_VER_RESOLUTION-1)
+ * @param	right is the ending position to the right (0~DISP_HOR_RESOLUTION-1)
+ * @param	bottom is the ending position to the bottom (0~DISP_HOR_RESOLUTION-1)
+ * @param	color is BLACK/WHITE
+ */
+void GFXDisplayDrawRect(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, COLOR color)
+{
+	uint16_t _left=left, _top=top, _right=right, _bottom=bottom;
+	
+	if(left > right)
+	{
+		_left = right; _right = left;
+	}	
+	
+	if(top > bottom)
+	{
+		_top = bottom; _bottom = top;
+	}
+	
+	if(gfx->bandLines)
+		GFXDisplayRecordRect(_left, _top, _right, _bottom, color);
+	else
+		GFX_GEOMETRY_CALL(GFXDisplayFillRect_FB, _left, _top, _right, _bottom, color, gfx->rop);	//update the framebuffer first
+	
+	GFXDisplayCommitLines(_top, _bottom);
+}
+
+/**
+ * @brief	Local function to refresh the rows top~bottom given in signed coordinates, clipped to the frame buffer
+ */
+static void GFXDisplayCommitExtent(int32_t top, int32_t bottom)
+{
+	if((bottom < 0) || (top > 0xFFFF))
+		return;
+	GFXDisplayCommitLines((uint16_t)MAX(top, (int32_t)0), (uint16_t)MIN(bottom, (int32_t)0xFFFF));
+}
+
+/**
+ * @brief	Draw a line of any slope, one pixel wide
+ * @param	(x1,y1) is the starting point
+ * @param	(x2,y2) is the ending point
+ * @param	color is BLACK/WHITE
+ * @note	The line is drawn into the frame buffer first and its rows are refreshed in one multiple-lines update,
+ *			a 400x240 diagonal is one transaction instead of one per pixel. Points outside the LCD are clipped.
+ */
+void GFXDisplayDrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, COLOR color)
+{
+	if(gfx->bandLines)
+		GFXDisplayRecordLine(x1, y1, x2, y2, color);
+	else
+		GFX_GEOMETRY_CALL(GFXDisplayLine_FB, x1, y1, x2, y2, color, gfx->rop);
+
+	GFXDisplayCommitLines(MIN(y1, y2), MAX(y1, y2));
+}
+
+/**
+ * @brief	Draw the outline of a circle
+ * @param	(x0,y0) is the center
+ * @param	r is the radius in pixels
+ * @param	color is BLACK/WHITE
+ * @note	Parts outside the LCD are clipped, rows y0-r~y0+r are refreshed in one update.
+ */
+void GFXDisplayDrawCircle(uint16_t x0, uint16_t y0, uint16_t r, COLOR color)
+{
+	if(gfx->bandLines)
+		GFXDisplayRecordCircle(x0, y0, r, color, false);
+	else
+		GFX_GEOMETRY_CALL(GFXDisplayCircle_FB, x0, y0, r, color, false);
+
+	GFXDisplayCommitExtent((int32_t)y0 - r, (int32_t)y0 + r);
+}
+
+/**
+ * @brief	Draw a filled circle
+ * @param	(x0,y0) is the center
+ * @param	r is the radius in pixels
+ * @param	color is BLACK/WHITE
+ * @note	Every row is filled as one byte span. Parts outside the LCD are clipped, rows y0-r~y0+r are refreshed in one update.
+ */
+void GFXDisplayFillCircle(uint16_t x0, uint16_t y0, uint16_t r, COLOR color)
+{
+	if(gfx->bandLines)
+		GFXDisplayRecordCircle(x0, y0, r, color, true);
+	else
+		GFX_GEOMETRY_CALL(GFXDisplayCircle_FB, x0, y0, r, color, true);
+
+	GFXDisplayCommitExtent((int32_t)y0 - r, (int32_t)y0 + r);
+}
+
+/**
+ * @brief	Draw the outline of an axis-aligned ellipse
+ * @param	(x0,y0) is the center
+ * @param	rx is the horizontal radius in pixels, up to 0x3FFF
+ * @param	ry is the vertical radius in pixels, up to 0x3FFF
+ * @param	color is BLACK/WHITE
+ * @note	Parts outside the LCD are clipped, rows y0-ry~y0+ry are refreshed in one update.
+ */
+void GFXDisplayDrawEllipse(uint16_t x0, uint16_t y0, uint16_t rx, uint16_t ry, COLOR color)
+{
+	if((rx > 0x3FFF) || (ry > 0x3FFF))
+		return;
+
+	if(gfx->bandLines)
+		GFXDisplayRecordEllipse(x0, y0, rx, ry, color, false);
+	else
+		GFX_GEOMETRY_CALL(GFXDisplayEllipse_FB, x0, y0, rx, ry, color, false);
+
+	GFXDisplayCommitExtent((int32_t)y0 - ry, (int32_t)y0 + ry);
+}
+
+/**
+ * @brief	Draw a filled axis-aligned ellipse
+ * @param	(x0,y0) is the center
+ * @param	rx is the horizontal radius in pixels, up to 0x3FFF
+ * @param	ry is the vertical radius in pixels, up to 0x3FFF
+ * @param	color is BLACK/WHITE
+ * @note	Every row is filled as one byte span. Parts outside the LCD are clipped, rows y0-ry~y0+ry are refreshed in one update.
+ */
+void GFXDisplayFillEllipse(uint16_t x0, uint16_t y0, uint16_t rx, uint16_t ry, COLOR color)
+{
+	if((rx > 0x3FFF) || (ry > 0x3FFF))
+		return;
+
+	if(gfx->bandLines)
+		GFXDisplayRecordEllipse(x0, y0, rx, ry, color, true);
+	else
+		GFX_GEOMETRY_CALL(GFXDisplayEllipse_FB, x0, y0, rx, ry, color, true);
+
+	GFXDisplayCommitExtent((int32_t)y0 - ry, (int32_t)y0 + ry);
+}
+
+/**
+ * @brief	Local function to fill a rectangle like GFXDisplayFillRect_FB() and report the rows whose content has changed.
+ *			A chart erases its old trace this way and refreshes only the rows the trace used to cover.
+ * @param	(x1,y1) is the top left corner, (x2,y2) the bottom right corner, both inclusive and within the frame buffer
+ * @param	*pTop, *pBottom are widened to include every row changed
+ */
+template <class G>
+static void GFXDisplayEraseRect_FB(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, COLOR color, int32_t *pTop, int32_t *pBottom)
+{
+	uint16_t firstByte = x1 >> 3, lastByte = x2 >> 3;
+	uint8_t leftMask  = (uint8_t)(0xFF << (x1 & 0x07));
+	uint8_t rightMask = (uint8_t)(0xFF >> (7 - (x2 & 0x07)));
+	uint8_t fill = (color == WHITE) ? 0xFF : 0x00;
+	const GFXRowMap<G> rows;
+
+	if(firstByte == lastByte)
+		leftMask &= rightMask;
+
+	for(uint16_t y = y1; y <= y2; y++)
+	{
+		uint8_t *row = rows.at(y);
+		uint8_t diff = (row[firstByte] ^ fill) & leftMask;
+		row[firstByte] = (row[firstByte] & ~leftMask) | (fill & leftMask);
+		if(firstByte != lastByte)
+		{
+			if(GFXRowFillChanged<GFXRowKernel>(&row[firstByte + 1], fill, lastByte - firstByte - 1))
+				diff = 0xFF;
+			diff |= (row[lastByte] ^ fill) & rightMask;
+			row[lastByte] = (row[lastByte] & ~rightMask) | (fill & rightMask);
+		}
+
+		if(diff)
+		{
+			*pTop = MIN(*pTop, (int32_t)y);
+			*pBottom = MAX(*pBottom, (int32_t)y);
+		}
+	}
+}
+
+/**
+ * @brief	Local function to map a sample value to a row of the chart, values outside minValue~maxValue are clamped to the edges
+ */
+static int32_t GFXDisplayChartRow(const GFX_CHART *pChart, int16_t value)
+{
+	int32_t v = MIN(MAX((int32_t)value, (int32_t)pChart->minValue), (int32_t)pChart->maxValue);
+	int32_t range = (int32_t)pChart->maxValue - pChart->minValue;
+	int32_t bottom = (int32_t)pChart->top + pChart->height - 1;
+
+	if(range <= 0)
+		return bottom;
+	return bottom - ((v - pChart->minValue) * (pChart->height - 1) + range/2) / range;
+}
+
+/**
+ * @brief	Local function to draw a batch of samples of a GFX_CHART_SWEEP chart into the frame buffer. No display on LCD yet.
+ *			The batch is split where the trace wraps around. For each part, the columns from the previous sample up to gap
+ *			pixels past the last new one are erased with one rectangle before the segments are drawn.
+ */
+template <class G>
+static void GFXDisplayChartSweep_FB(GFX_CHART *pChart, const int16_t *samples, uint16_t count, int32_t *pTop, int32_t *pBottom)
+{
+	const int32_t right = (int32_t)pChart->left + pChart->width - 1;
+	const int32_t step = pChart->step;
+
+	while(count)
+	{
+		int32_t x = (int32_t)pChart->left + (int32_t)pChart->count * step;
+		if(x > right)	//wrap around, the trace restarts at the left edge
+		{
+			pChart->count = 0;
+			pChart->lastY = -1;
+			x = pChart->left;
+		}
+
+		uint16_t n = (uint16_t)MIN((int32_t)count, (right - x) / step + 1);
+		if(pChart->bg != TRANSPARENT)
+		{
+			//columns up to gap pixels past the previous sample are blank already
+			int32_t eraseFrom = (pChart->lastY < 0) ? x : (x - step + pChart->gap + 1);
+			int32_t eraseTo = MIN(x + (int32_t)(n - 1) * step + pChart->gap, right);
+			if(eraseFrom <= eraseTo)
+				GFXDisplayEraseRect_FB<G>((uint16_t)eraseFrom, pChart->top, (uint16_t)eraseTo, pChart->top + pChart->height - 1,
+										  pChart->bg, pTop, pBottom);
+		}
+
+		for(uint16_t i = 0; i < n; i++, x += step)
+		{
+			int32_t y = GFXDisplayChartRow(pChart, *samples++);
+			if(pChart->lastY < 0)
+				GFXDisplaySpan_FB<G>(x, x, y, pChart->color, GFX_ROP_SET);
+			else
+				GFXDisplayLine_FB<G>(x - step, pChart->lastY, x, y, pChart->color, GFX_ROP_SET);
+
+			*pTop = MIN(*pTop, MIN(y, (pChart->lastY < 0) ? y : pChart->lastY));
+			*pBottom = MAX(*pBottom, MAX(y, pChart->lastY));
+			pChart->lastY = y;
+		}
+		pChart->count += n;
+		count -= n;
+	}
+}
+
+/**
+ * @brief	Local function to add a batch of samples to a GFX_CHART_SCROLL chart and redraw its trace into the frame buffer. No display on LCD yet.
+ *			The old trace is erased with the rectangle, the new one is drawn from the history with the newest sample on the right edge.
+ */
+template <class G>
+static void GFXDisplayChartScroll_FB(GFX_CHART *pChart, const int16_t *samples, uint16_t count, int32_t *pTop, int32_t *pBottom)
+{
+	const uint16_t capacity = GFX_CHART_HISTORY_SIZE(pChart->width, pChart->step);
+
+	while(count--)
+	{
+		uint16_t y = (uint16_t)GFXDisplayChartRow(pChart, *samples++);
+		if(pChart->count < capacity)
+			pChart->history[(pChart->head + pChart->count++) % capacity] = y;
+		else
+		{
+			pChart->history[pChart->head] = y;
+			pChart->head = (pChart->head + 1) % capacity;
+		}
+	}
+
+	if(pChart->bg != TRANSPARENT)
+		GFXDisplayEraseRect_FB<G>(pChart->left, pChart->top, pChart->left + pChart->width - 1, pChart->top + pChart->height - 1, pChart->bg, pTop, pBottom);
+
+	int32_t x = (int32_t)pChart->left + pChart->width - 1 - (int32_t)(pChart->count - 1) * pChart->step;
+	int32_t lastY = -1;
+
+	for(uint16_t i = 0; i < pChart->count; i++, x += pChart->step)
+	{
+		int32_t y = pChart->history[(pChart->head + i) % capacity];
+		if(lastY < 0)
+			GFXDisplaySpan_FB<G>(x, x, y, pChart->color, GFX_ROP_SET);
+		else
+			GFXDisplayLine_FB<G>(x - pChart->step, lastY, x, y, pChart->color, GFX_ROP_SET);
+		*pTop = MIN(*pTop, y);
+		*pBottom = MAX(*pBottom, y);
+		lastY = y;
+	}
+	pChart->lastY = lastY;
+}
+
+/**
+ * @brief	Set up a strip chart in a rectangle of the selected display. Nothing is drawn until the first samples arrive.
+ * @param	*pChart is the chart object, owned by the caller
+ * @param	left, top, width, height is the chart rectangle, it must lie within the LCD
+ * @param	minValue is the sample value on the bottom row, maxValue the one on the top row
+ * @param	mode is GFX_CHART_SWEEP or GFX_CHART_SCROLL
+ * @param	*history is GFX_CHART_HISTORY_SIZE(width, step) entries for GFX_CHART_SCROLL, NULL for GFX_CHART_SWEEP
+ * @note	Defaults: step 1 pixel, gap 8 pixels, BLACK trace on WHITE background. A scroll chart with a larger step needs
+ *			GFX_CHART_HISTORY_SIZE(width, 1) entries or the new step set before the first sample.<br>
+ *			Example<br>
+ *				static GFX_CHART chart;<br>
+ *				GFXDisplayChartInit(&chart, 0, 40, GFXDisplayGetLCDWidth(), 160, -512, 511, GFX_CHART_SWEEP, NULL);<br>
+ *				//...every 50 ms<br>
+ *				GFXDisplayChartAddSamples(&chart, adcSamples, n);	//one LCD update for the batch
+ */
+void GFXDisplayChartInit(GFX_CHART *pChart, uint16_t left, uint16_t top, uint16_t width, uint16_t height,
+						 int16_t minValue, int16_t maxValue, GFX_CHART_MODE mode, uint16_t *history)
+{
+	pChart->left = left;
+	pChart->top = top;
+	pChart->width = MAX(width, (uint16_t)1);
+	pChart->height = MAX(height, (uint16_t)1);
+	pChart->minValue = minValue;
+	pChart->maxValue = maxValue;
+	pChart->mode = mode;
+	pChart->step = 1;
+	pChart->gap = 8;
+	pChart->color = BLACK;
+	pChart->bg = WHITE;
+	pChart->history = history;
+	pChart->count = 0;
+	pChart->head = 0;
+	pChart->lastY = -1;
+}
+
+/**
+ * @brief	Fill the chart rectangle with the background and restart the trace
+ */
+void GFXDisplayChartClear(GFX_CHART *pChart)
+{
+	pChart->count = 0;
+	pChart->head = 0;
+	pChart->lastY = -1;
+
+	if(pChart->bg != TRANSPARENT)
+		GFXDisplayDrawRect(pChart->left, pChart->top, pChart->left + pChart->width - 1, pChart->top + pChart->height - 1, pChart->bg);
+}
+
+/**
+ * @brief	Draw a batch of samples as connected segments
+ * @param	*pChart is a chart set up with GFXDisplayChartInit()
+ * @param	*samples is the batch, oldest sample first
+ * @param	count is the number of samples
+ * @return	number of rows committed for refresh, GFX_SHADOW may skip those the LCD shows already
+ * @note	Not available on a banded display, nothing is drawn there.<br>
+ *			The frame buffer is updated for the whole batch first, then only the rows covered by the new segments and by the
+ *			trace they erased are refreshed, in one multiple-lines update (or marked dirty in GFX_FLUSH_DEFERRED mode).
+ *			A sweep chart touches a few columns per batch; a scroll chart moves its whole trace, so its rows are those of the old and new trace.
+ */
+uint16_t GFXDisplayChartAddSamples(GFX_CHART *pChart, const int16_t *samples, uint16_t count)
+{
+	int32_t top = 0x7FFFFFFF, bottom = -1;
+
+	if((count == 0) || (pChart->step == 0) || gfx->bandLines)	//the chart erases and redraws in the frame buffer, not in a display list
+		return 0;
+
+	if(pChart->mode == GFX_CHART_SCROLL)
+	{
+		if(pChart->history == NULL)
+			return 0;
+		GFX_GEOMETRY_CALL(GFXDisplayChartScroll_FB, pChart, samples, count, &top, &bottom);
+	}
+	else
+		GFX_GEOMETRY_CALL(GFXDisplayChartSweep_FB, pChart, samples, count, &top, &bottom);
+
+	if(bottom < top)
+		return 0;
+
+	GFXDisplayCommitLines((uint16_t)top, (uint16_t)bottom);
+	return (uint16_t)(bottom - top + 1);
+}
+
+/**
+ * @note	Rectangle of LCD pixels, x2/y2 inclusive
+ */
+typedef struct
+{
+	uint16_t x1, y1, x2, y2;
+} GFX_DAMAGE;
+
+/**
+ * @brief	Local function to set up the fields shared by every widget type. The new node is dirty and visible.
+ */
+static void GFXWidgetInit(GFX_WIDGET *pWidget, GFX_WIDGET_TYPE type, uint16_t left, uint16_t top, uint16_t width, uint16_t height)
+{
+	memset(pWidget, 0, sizeof(GFX_WIDGET));
+	pWidget->type = type;
+	pWidget->flags = GFX_WIDGET_VISIBLE | GFX_WIDGET_DIRTY;
+	pWidget->color = BLACK;
+	pWidget->bg = TRANSPARENT;
+	pWidget->left = left;
+	pWidget->top = top;
+	pWidget->width = width;
+	pWidget->height = height;
+}
+
+/**
+ * @brief	Local function to write a number in decimal at the end of buf, 12 bytes
+ * @return	pointer to the first character
+ */
+static const char* GFXWidgetFormat(char *buf, int32_t value)
+{
+	uint32_t v = (value < 0) ? (uint32_t)(-(int64_t)value) : (uint32_t)value;
+	char *p = &buf[11];
+
+	*p = '\0';
+	do
+	{
+		*--p = (char)('0' + v % 10);
+		v /= 10;
+	} while(v && (p > buf + 1));
+	if(value < 0)
+		*--p = '-';
+	return p;
+}
+
+/**
+ * @brief	Local function to get the character of a number field cell, the value right aligned in the cells
+ * @param	*str is the value formatted by GFXWidgetFormat()
+ * @return	the character, '\0' for a blank cell
+ * @note	Characters beyond the field on the left are not shown.
+ */
+static char GFXWidgetCellChar(const char *str, uint8_t len, uint8_t digits, uint8_t cell)
+{
+	return (cell + len >= digits) ? str[cell + len - digits] : '\0';
+}
+
+/**
+ * @brief	Local function to find the cells of a number field that show different characters for two values
+ * @return	true if a cell differs, the cells first to last are to be painted again
+ */
+static bool GFXWidgetChangedCells(const GFX_WIDGET *pWidget, int32_t oldValue, uint8_t *pFirst, uint8_t *pLast)
+{
+	char oldBuf[12], newBuf[12];
+	const char *oldStr = GFXWidgetFormat(oldBuf, oldValue), *newStr = GFXWidgetFormat(newBuf, pWidget->value);
+	uint8_t oldLen = (uint8_t)strlen(oldStr), newLen = (uint8_t)strlen(newStr);
+	bool changed = false;
+
+	for(uint8_t i = 0; i < pWidget->digits; i++)
+	{
+		if(GFXWidgetCellChar(oldStr, oldLen, pWidget->digits, i) != GFXWidgetCellChar(newStr, newLen, pWidget->digits, i))
+		{
+			if(!changed)
+				*pFirst = i;
+			*pLast = i;
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+/**
+ * @brief	Local function to find the cells of a number field overlapping the damage
+ * @return	true if a cell overlaps, cells first to last do
+ */
+static bool GFXWidgetDamagedCells(const GFX_WIDGET *pWidget, const GFX_DAMAGE *list, uint8_t count, uint8_t *pFirst, uint8_t *pLast)
+{
+	const uint16_t cellWidth = pWidget->width / pWidget->digits, bottom = pWidget->top + pWidget->height - 1;
+	bool damaged = false;
+
+	for(uint8_t i = 0; i < count; i++)
+	{
+		if((pWidget->top > list[i].y2) || (bottom < list[i].y1) || (pWidget->left > list[i].x2) ||
+		   (pWidget->left + pWidget->width - 1 < list[i].x1))
+			continue;
+
+		uint8_t first = (list[i].x1 > pWidget->left) ? (uint8_t)((list[i].x1 - pWidget->left) / cellWidth) : 0;
+		uint8_t last = (uint8_t)MIN((list[i].x2 - pWidget->left) / cellWidth, pWidget->digits - 1);
+		*pFirst = damaged ? MIN(*pFirst, first) : first;
+		*pLast = damaged ? MAX(*pLast, last) : last;
+		damaged = true;
+	}
+	return damaged;
+}
+
+/**
+ * @brief	Local function to add a rectangle to the damage list, clipped to the LCD. A full list merges it into the
+ *			rectangle that grows least.
+ * @return	true if the list covers more pixels than before
+ */
+static bool GFXWidgetDamage(GFX_DAMAGE *list, uint8_t *pCount, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+	const int32_t xMax = GFXDisplayGetLCDWidth() - 1, yMax = GFXDisplayGetLCDHeight() - 1;
+
+	if((x1 > x2) || (y1 > y2) || (x1 > xMax) || (y1 > yMax))
+		return false;
+	GFX_DAMAGE d = {(uint16_t)x1, (uint16_t)y1, (uint16_t)MIN(x2, xMax), (uint16_t)MIN(y2, yMax)};
+
+	uint8_t best = 0;
+	uint32_t bestGrowth = 0xFFFFFFFF;
+	for(uint8_t i = 0; i < *pCount; i++)
+	{
+		const GFX_DAMAGE *e = &list[i];
+		if((d.x1 >= e->x1) && (d.x2 <= e->x2) && (d.y1 >= e->y1) && (d.y2 <= e->y2))
+			return false;		//covered already
+
+		uint32_t area = (uint32_t)(e->x2 - e->x1 + 1) * (e->y2 - e->y1 + 1);
+		uint32_t merged = (uint32_t)(MAX(d.x2, e->x2) - MIN(d.x1, e->x1) + 1) * (MAX(d.y2, e->y2) - MIN(d.y1, e->y1) + 1);
+		if(merged - area < bestGrowth)
+		{
+			bestGrowth = merged - area;
+			best = i;
+		}
+	}
+
+	if(*pCount < GFX_WIDGET_DAMAGE_RECTS)
+		list[(*pCount)++] = d;
+	else
+	{
+		GFX_DAMAGE *e = &list[best];
+		e->x1 = MIN(e->x1, d.x1);
+		e->y1 = MIN(e->y1, d.y1);
+		e->x2 = MAX(e->x2, d.x2);
+		e->y2 = MAX(e->y2, d.y2);
+	}
+	return true;
+}
+
+/**
+ * @return	true if the box of pWidget overlaps a rectangle of the damage list
+ */
+static bool GFXWidgetDamaged(const GFX_WIDGET *pWidget, const GFX_DAMAGE *list, uint8_t count)
+{
+	if((pWidget->width == 0) || (pWidget->height == 0))
+		return false;
+
+	uint32_t right = (uint32_t)pWidget->left + pWidget->width - 1, bottom = (uint32_t)pWidget->top + pWidget->height - 1;
+	for(uint8_t i = 0; i < count; i++)
+	{
+		if((pWidget->left <= list[i].x2) && (right >= list[i].x1) && (pWidget->top <= list[i].y2) && (bottom >= list[i].y1))
+			return true;
+	}
+	return false;
+}
+
+/**
+ * @brief	Local function to collect the damage of changed nodes: the box painted last time and the box to paint now
+ */
+static void GFXWidgetCollect(GFX_WIDGET *pWidget, bool parentShown, GFX_DAMAGE *list, uint8_t *pCount)
+{
+	for(; pWidget != NULL; pWidget = pWidget->next)
+	{
+		bool shown = parentShown && (pWidget->flags & GFX_WIDGET_VISIBLE);
+		bool drawn = (pWidget->flags & GFX_WIDGET_DRAWN) != 0;
+
+		if((pWidget->flags & GFX_WIDGET_DIRTY) || (shown != drawn))
+		{
+			if(drawn)
+				GFXWidgetDamage(list, pCount, pWidget->drawnLeft, pWidget->drawnTop, pWidget->drawnRight, pWidget->drawnBottom);
+			if(shown)
+				GFXWidgetDamage(list, pCount, pWidget->left, pWidget->top, (int32_t)pWidget->left + pWidget->width - 1,
+								(int32_t)pWidget->top + pWidget->height - 1);
+		}
+		else if((pWidget->flags & GFX_WIDGET_VALUE) && shown)
+		{
+			uint8_t first = 0, last = 0;	//same place and colors, only the digits that differ
+			if(GFXWidgetChangedCells(pWidget, pWidget->drawnValue, &first, &last))
+			{
+				uint16_t cellWidth = pWidget->width / pWidget->digits;
+				GFXWidgetDamage(list, pCount, pWidget->left + first * cellWidth, pWidget->top, pWidget->left + (last + 1) * cellWidth - 1,
+								(int32_t)pWidget->top + pWidget->height - 1);
+			}
+		}
+		GFXWidgetCollect(pWidget->child, shown, list, pCount);
+	}
+}
+
+/**
+ * @brief	Local function to mark the shown nodes overlapping the damage for painting. Labels and images are painted
+ *			whole, so their box becomes damage too, numbers the cells from the first to the last one damaged.
+ * @return	true if the damage list has grown, nodes marked before may overlap more nodes then
+ */
+static bool GFXWidgetMark(GFX_WIDGET *pWidget, bool parentShown, GFX_DAMAGE *list, uint8_t *pCount)
+{
+	bool grown = false;
+
+	for(; pWidget != NULL; pWidget = pWidget->next)
+	{
+		bool shown = parentShown && (pWidget->flags & GFX_WIDGET_VISIBLE);
+
+		if(shown && !(pWidget->flags & GFX_WIDGET_REDRAW) && GFXWidgetDamaged(pWidget, list, *pCount))
+		{
+			uint8_t first = 0, last = 0;
+
+			pWidget->flags |= GFX_WIDGET_REDRAW;
+			if((pWidget->type == GFX_WIDGET_NUMBER) && GFXWidgetDamagedCells(pWidget, list, *pCount, &first, &last))
+			{
+				uint16_t cellWidth = pWidget->width / pWidget->digits;
+				grown |= GFXWidgetDamage(list, pCount, pWidget->left + first * cellWidth, pWidget->top,
+										 pWidget->left + (last + 1) * cellWidth - 1, (int32_t)pWidget->top + pWidget->height - 1);
+			}
+			else if((pWidget->type != GFX_WIDGET_GROUP) && (pWidget->type != GFX_WIDGET_RECT))
+				grown |= GFXWidgetDamage(list, pCount, pWidget->left, pWidget->top, (int32_t)pWidget->left + pWidget->width - 1,
+										 (int32_t)pWidget->top + pWidget->height - 1);
+		}
+		grown |= GFXWidgetMark(pWidget->child, shown, list, pCount);
+	}
+	return grown;
+}
+
+/**
+ * @brief	Local function to paint the marked nodes in tree order. Groups and rects are clipped to the damage.
+ */
+static void GFXWidgetPaint(GFX_WIDGET *pWidget, bool parentShown, const GFX_DAMAGE *list, uint8_t count)
+{
+	for(; pWidget != NULL; pWidget = pWidget->next)
+	{
+		bool shown = parentShown && (pWidget->flags & GFX_WIDGET_VISIBLE);
+		uint16_t right = pWidget->left + pWidget->width - 1, bottom = pWidget->top + pWidget->height - 1;
+
+		if(pWidget->flags & GFX_WIDGET_REDRAW)
+		{
+			const BFC_FONT *pFont = (const BFC_FONT *)pWidget->ptr;
+			COLOR fill = (pWidget->type == GFX_WIDGET_GROUP) ? pWidget->bg : pWidget->color;
+			char buf[12];
+
+			switch(pWidget->type)
+			{
+			case GFX_WIDGET_GROUP:
+			case GFX_WIDGET_RECT:
+				for(uint8_t i = 0; (fill != TRANSPARENT) && (i < count); i++)
+				{
+					if((pWidget->left <= list[i].x2) && (right >= list[i].x1) && (pWidget->top <= list[i].y2) && (bottom >= list[i].y1))
+						GFXDisplayDrawRect(MAX(pWidget->left, list[i].x1), MAX(pWidget->top, list[i].y1),
+										   MIN(right, list[i].x2), MIN(bottom, list[i].y2), fill);
+				}
+				break;
+			case GFX_WIDGET_LABEL:
+				GFXDisplayPutString(pWidget->left, pWidget->top, pFont, pWidget->text, pWidget->color, pWidget->bg);
+				break;
+			case GFX_WIDGET_IMAGE:
+				GFXDisplayPutImage(pWidget->left, pWidget->top, (const tImage *)pWidget->ptr, pWidget->value != 0);
+				break;
+			case GFX_WIDGET_NUMBER:
+			{
+				const char *str = GFXWidgetFormat(buf, pWidget->value);
+				uint8_t len = (uint8_t)strlen(str), first, last;
+				uint16_t cellWidth = pWidget->width / pWidget->digits;
+
+				if(!GFXWidgetDamagedCells(pWidget, list, count, &first, &last))
+					break;
+				for(uint8_t i = first; i <= last; i++)		//each character right aligned in its cell
+				{
+					uint16_t x = pWidget->left + i * cellWidth;
+					char ch = GFXWidgetCellChar(str, len, pWidget->digits, i);
+					uint16_t w = ch ? GFXDisplayGetCharWidth(pFont, ch) : 0;
+
+					if((pWidget->bg != TRANSPARENT) && (w < cellWidth))
+						GFXDisplayDrawRect(x, pWidget->top, x + cellWidth - w - 1, bottom, pWidget->bg);
+					if(ch)
+						GFXDisplayPutChar(x + cellWidth - w, pWidget->top, pFont, ch, pWidget->color, pWidget->bg);
+				}
+				break;
+			}
+			}
+		}
+
+		if(shown)
+		{
+			pWidget->flags |= GFX_WIDGET_DRAWN;
+			pWidget->drawnLeft = pWidget->left;
+			pWidget->drawnTop = pWidget->top;
+			pWidget->drawnRight = right;
+			pWidget->drawnBottom = bottom;
+			pWidget->drawnValue = pWidget->value;
+		}
+		else
+			pWidget->flags &= ~GFX_WIDGET_DRAWN;
+		pWidget->flags &= ~(GFX_WIDGET_DIRTY | GFX_WIDGET_REDRAW | GFX_WIDGET_VALUE);
+		GFXWidgetPaint(pWidget->child, shown, list, count);
+	}
+}
+
+/**
+ * @brief	Set up a group node: a container of child nodes, usually the root of a screen
+ * @param	*pWidget is the node, owned by the caller
+ * @param	left, top, width, height is the rectangle painted with bg
+ * @param	bg is the background color, TRANSPARENT for a group painting nothing itself
+ * @note	The root of a screen is a group covering the LCD with a background color, it repaints what hidden or moved
+ *			nodes leave behind.<br>
+ *			Example<br>
+ *				static GFX_WIDGET screen, sys;<br>
+ *				GFXWidgetInitGroup(&screen, 0, 0, GFXDisplayGetLCDWidth(), GFXDisplayGetLCDHeight(), WHITE);<br>
+ *				GFXWidgetInitNumber(&sys, 100, 50, &fontArial_Rounded_MT_Bold55h, 3, 0, BLACK, WHITE);<br>
+ *				GFXWidgetAdd(&screen, &sys);<br>
+ *				//...every 50 ms<br>
+ *				GFXWidgetSetValue(&sys, sysPressure);<br>
+ *				GFXWidgetRender(&screen);	//rows of the number only, if it has changed
+ */
+void GFXWidgetInitGroup(GFX_WIDGET *pWidget, uint16_t left, uint16_t top, uint16_t width, uint16_t height, COLOR bg)
+{
+	GFXWidgetInit(pWidget, GFX_WIDGET_GROUP, left, top, width, height);
+	pWidget->bg = bg;
+}
+
+/**
+ * @brief	Set up a filled rectangle node
+ */
+void GFXWidgetInitRect(GFX_WIDGET *pWidget, uint16_t left, uint16_t top, uint16_t width, uint16_t height, COLOR color)
+{
+	GFXWidgetInit(pWidget, GFX_WIDGET_RECT, left, top, width, height);
+	pWidget->color = color;
+}
+
+/**
+ * @brief	Set up a text label node, its box is the string width by the font height
+ * @param	*text is a null-terminated string that has to stay valid, GFXWidgetInvalidate() after changing it in place
+ */
+void GFXWidgetInitLabel(GFX_WIDGET *pWidget, uint16_t left, uint16_t top, const BFC_FONT *pFont, const char *text, COLOR color, COLOR bg)
+{
+	GFXWidgetInit(pWidget, GFX_WIDGET_LABEL, left, top, GFXDisplayGetStringWidth(pFont, text), GFXDisplayGetFontHeight(pFont));
+	pWidget->ptr = pFont;
+	pWidget->text = text;
+	pWidget->color = color;
+	pWidget->bg = bg;
+}
+
+/**
+ * @brief	Set up an image node
+ */
+void GFXWidgetInitImage(GFX_WIDGET *pWidget, uint16_t left, uint16_t top, const tImage *image, bool invert)
+{
+	GFXWidgetInit(pWidget, GFX_WIDGET_IMAGE, left, top, image->width, image->height);
+	pWidget->ptr = image;
+	pWidget->value = invert;
+}
+
+/**
+ * @brief	Set up a number node: value right aligned in a field of digits cells, as wide as the widest digit of the font
+ * @param	digits is the field width in cells, 1 to 11, a minus sign takes one
+ * @note	Each character is right aligned in its own cell, so a new value repaints only the cells whose character has
+ *			changed, e.g. one cell from 118 to 119. With bg other than TRANSPARENT blank cells are cleared, no padding with
+ *			spaces is needed. Digits beyond the field on the left are not shown.
+ */
+void GFXWidgetInitNumber(GFX_WIDGET *pWidget, uint16_t left, uint16_t top, const BFC_FONT *pFont, uint8_t digits, int32_t value,
+						 COLOR color, COLOR bg)
+{
+	uint16_t widest = GFXDisplayGetCharWidth(pFont, '-');
+
+	for(uint16_t ch = '0'; ch <= '9'; ch++)
+		widest = MAX(widest, GFXDisplayGetCharWidth(pFont, ch));
+
+	digits = MIN(MAX(digits, 1), 11);
+	GFXWidgetInit(pWidget, GFX_WIDGET_NUMBER, left, top, widest * digits, GFXDisplayGetFontHeight(pFont));
+	pWidget->digits = digits;
+	pWidget->ptr = pFont;
+	pWidget->value = value;
+	pWidget->color = color;
+	pWidget->bg = bg;
+}
+
+/**
+ * @brief	Append a node to the children of pParent, it is painted over the children added before
+ */
+void GFXWidgetAdd(GFX_WIDGET *pParent, GFX_WIDGET *pWidget)
+{
+	GFX_WIDGET **ppLink = &pParent->child;
+
+	while(*ppLink != NULL)
+		ppLink = &(*ppLink)->next;
+	*ppLink = pWidget;
+	pWidget->parent = pParent;
+	pWidget->next = NULL;
+	pWidget->flags |= GFX_WIDGET_DIRTY;
+}
+
+/**
+ * @brief	Change the text of a label, its box follows the new string width
+ */
+void GFXWidgetSetText(GFX_WIDGET *pWidget, const char *text)
+{
+	pWidget->text = text;
+	pWidget->width = GFXDisplayGetStringWidth((const BFC_FONT *)pWidget->ptr, text);
+	pWidget->flags |= GFX_WIDGET_DIRTY;
+}
+
+/**
+ * @brief	Change the value of a number, the next GFXWidgetRender() repaints the cells that show other characters
+ * @return	true if the value is different, false if nothing has to be drawn
+ */
+bool GFXWidgetSetValue(GFX_WIDGET *pWidget, int32_t value)
+{
+	if(pWidget->value == value)
+		return false;
+
+	pWidget->value = value;
+	pWidget->flags |= GFX_WIDGET_VALUE;
+	return true;
+}
+
+/**
+ * @brief	Change the image of an image node, its box follows the new image size
+ */
+void GFXWidgetSetImage(GFX_WIDGET *pWidget, const tImage *image, bool invert)
+{
+	if((pWidget->ptr == image) && ((pWidget->value != 0) == invert))
+		return;
+
+	pWidget->ptr = image;
+	pWidget->value = invert;
+	pWidget->width = image->width;
+	pWidget->height = image->height;
+	pWidget->flags |= GFX_WIDGET_DIRTY;
+}
+
+/**
+ * @brief	Change the colors of a node, bg is used by groups, labels and numbers
+ */
+void GFXWidgetSetColor(GFX_WIDGET *pWidget, COLOR color, COLOR bg)
+{
+	if((pWidget->color == color) && (pWidget->bg == bg))
+		return;
+
+	pWidget->color = color;
+	pWidget->bg = bg;
+	pWidget->flags |= GFX_WIDGET_DIRTY;
+}
+
+/**
+ * @brief	Move a node, the rows it leaves are repainted by the nodes below it
+ * @note	Children keep their position.
+ */
+void GFXWidgetMove(GFX_WIDGET *pWidget, uint16_t left, uint16_t top)
+{
+	if((pWidget->left == left) && (pWidget->top == top))
+		return;
+
+	pWidget->left = left;
+	pWidget->top = top;
+	pWidget->flags |= GFX_WIDGET_DIRTY;
+}
+
+/**
+ * @brief	Show or hide a node and its children
+ */
+void GFXWidgetSetVisible(GFX_WIDGET *pWidget, bool visible)
+{
+	if(visible)
+		pWidget->flags |= GFX_WIDGET_VISIBLE;
+	else
+		pWidget->flags &= ~GFX_WIDGET_VISIBLE;
+}
+
+/**
+ * @brief	Mark a node for painting, e.g. after its text has been changed in place. The root repaints the whole screen.
+ */
+void GFXWidgetInvalidate(GFX_WIDGET *pWidget)
+{
+	pWidget->flags |= GFX_WIDGET_DIRTY;
+}
+
+/**
+ * @brief	Paint the changes of a widget tree on the selected display and send the damaged lines
+ *			Changed nodes damage the box they were painted in and the box they take now. Every shown node overlapping
+ *			the damage is painted again in tree order, groups and rects only inside the damage, and the rows touched go out
+ *			with one GFXDisplayFlush().
+ * @param	*pRoot is the root node of the tree
+ * @return	number of lines sent, 0 if nothing has changed
+ * @note	The drawing is done in GFX_FLUSH_DEFERRED mode, the flush mode set before is restored. Lines other drawing
+ *			functions left dirty in GFX_FLUSH_DEFERRED mode go out with the same flush.
+ */
+uint16_t GFXWidgetRender(GFX_WIDGET *pRoot)
+{
+	GFX_DAMAGE list[GFX_WIDGET_DAMAGE_RECTS];
+	uint8_t count = 0;
+	GFX_WIDGET *pNext = pRoot->next;
+
+	pRoot->next = NULL;		//a root added to another tree renders on its own
+	GFXWidgetCollect(pRoot, true, list, &count);
+	if(count == 0)
+	{
+		GFXWidgetPaint(pRoot, true, list, 0);	//flags of hidden nodes brought up to date
+		pRoot->next = pNext;
+		return 0;
+	}
+
+	while(GFXWidgetMark(pRoot, true, list, &count))
+		;
+
+	GFX_FLUSH_MODE mode = GFXDisplayGetFlushMode();
+	GFX_ROP rop = gfx->rop;
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+	gfx->rop = GFX_ROP_SET;		//damaged boxes are painted over, whatever the caller draws with
+	GFXWidgetPaint(pRoot, true, list, count);
+	gfx->rop = rop;
+	pRoot->next = pNext;
+	uint16_t lines = GFXDisplayFlush();
+	GFXDisplaySetFlushMode(mode);
+	return lines;
+}
+
+/**
+ * @brief	Set up an animation of a frame sequence, stopped and not shown
+ * @param	*frames is the sequence of count frames, every frame shown for its ms
+ * @param	(left,top) is the top left corner of the box, the size of the largest frame
+ * @param	bg fills the box around a smaller frame and the box when the animation is erased or moved. TRANSPARENT draws the
+ *			black pixels of the frames only, over what is below them.
+ * @param	*under is GFX_ANIM_UNDER_SIZE(width, height) bytes for a TRANSPARENT animation to keep what is below the box,
+ *			NULL otherwise
+ * @note	Draw what is below a TRANSPARENT animation before it is shown; what changes below it afterwards is overwritten when
+ *			the animation is erased or moved. Without *under, or on a banded display that has no frame buffer to keep it from,
+ *			the frames are drawn on WHITE.<br>
+ *			Animations linked together must not overlap.
+ */
+void GFXAnimInit(GFX_ANIM *pAnim, const GFX_ANIM_FRAME *frames, uint16_t count, uint16_t left, uint16_t top, COLOR bg, uint8_t *under)
+{
+	memset(pAnim, 0, sizeof(GFX_ANIM));
+	pAnim->frames = frames;
+	pAnim->count = count;
+	pAnim->bg = bg;
+	pAnim->left = left;
+	pAnim->top = top;
+	pAnim->under = under;
+	for(uint16_t i = 0; i < count; i++)
+	{
+		pAnim->width = MAX(pAnim->width, frames[i].image->width);
+		pAnim->height = MAX(pAnim->height, frames[i].image->height);
+	}
+}
+
+/**
+ * @brief	Link an animation after pFirst, so that GFXAnimTick(pFirst) draws both with one flush
+ */
+void GFXAnimAdd(GFX_ANIM *pFirst, GFX_ANIM *pAnim)
+{
+	GFX_ANIM **ppLast = &pFirst->next;
+
+	while(*ppLast != NULL)
+		ppLast = &(*ppLast)->next;
+	*ppLast = pAnim;
+	pAnim->next = NULL;
+}
+
+/**
+ * @brief	Play the sequence from its first frame, shown by the next GFXAnimTick()
+ * @param	loops is the number of times the sequence is played, 0 to repeat it until GFXAnimStop(). The last frame stays.
+ */
+void GFXAnimStart(GFX_ANIM *pAnim, uint16_t loops)
+{
+	if(pAnim->count == 0)
+		return;
+
+	pAnim->frame = 0;
+	pAnim->loops = loops;
+	pAnim->dueMs = hal_millis() + pAnim->frames[0].ms;
+	pAnim->flags |= GFX_ANIM_SHOWN | GFX_ANIM_RUNNING;
+}
+
+/**
+ * @brief	Stop on the frame shown
+ * @param	erase is true to clear the box with the next GFXAnimTick(), bg or what was below a TRANSPARENT animation
+ */
+void GFXAnimStop(GFX_ANIM *pAnim, bool erase)
+{
+	pAnim->flags &= ~GFX_ANIM_RUNNING;
+	if(erase)
+		pAnim->flags &= ~GFX_ANIM_SHOWN;
+}
+
+/**
+ * @brief	Move the box, the next GFXAnimTick() erases it at the old position and draws the frame at the new one
+ */
+void GFXAnimMove(GFX_ANIM *pAnim, uint16_t left, uint16_t top)
+{
+	pAnim->left = left;
+	pAnim->top = top;
+}
+
+/**
+ * @return	true when the frame buffer keeps what is below the animation, false when its box is filled with a color
+ */
+static bool GFXAnimKeepsUnder(const GFX_ANIM *pAnim)
+{
+	return (pAnim->bg == TRANSPARENT) && (pAnim->under != NULL) && (gfx->bandLines == 0);
+}
+
+/**
+ * @brief	Local function to save the frame buffer bytes below rows y0~y1 of the box at (left,top) into pAnim->under, or
+ *			to restore them. Pixels of the edge bytes outside the box are left alone.
+ */
+static void GFXAnimUnder(GFX_ANIM *pAnim, uint16_t left, uint16_t top, uint16_t y0, uint16_t y1, bool save)
+{
+	const uint16_t W = gfx->pDesc->bytesPerLine, H = gfx->pDesc->height;
+	const uint16_t pitch = (pAnim->width + 7) / 8 + 1, firstByte = left >> 3;
+	uint32_t right = (uint32_t)left + pAnim->width - 1;
+
+	if((firstByte > (W-1)) || (top > (H-1)))
+		return;
+
+	uint8_t leftMask  = (uint8_t)(0xFF << (left & 0x07));		//pixel x at bit (x & 0x07)
+	uint8_t rightMask = (uint8_t)(0xFF >> (7 - (right & 0x07)));
+	if((right >> 3) > (uint32_t)(W-1))
+	{
+		right = ((uint32_t)W << 3) - 1;
+		rightMask = 0xFF;
+	}
+	uint16_t bytes = (uint16_t)((right >> 3) - firstByte + 1);
+	if(bytes == 1)
+		leftMask &= rightMask;
+
+	y1 = (uint16_t)MIN((uint32_t)y1, (uint32_t)(H - 1) - top);
+	for(uint16_t y = y0; y <= y1; y++)
+	{
+		uint8_t *row = GFXDisplayGetRow(top + y) + firstByte, *kept = &pAnim->under[(uint32_t)y * pitch];
+
+		if(save)
+		{
+			memcpy(kept, row, bytes);
+			continue;
+		}
+		for(uint16_t i = 0; i < bytes; i++)
+		{
+			uint8_t mask = (i == 0) ? leftMask : ((i == bytes-1) ? rightMask : 0xFF);
+			row[i] = (uint8_t)((row[i] & ~mask) | (kept[i] & mask));
+		}
+	}
+	if(!save)
+		GFXDisplayCommitLines(top + y0, top + y1);
+}
+
+/**
+ * @brief	Local function to draw rows y0~y1 of the box from a frame, the rows of the box below a shorter frame and the
+ *			columns right of a narrower one with bg or what was below them
+ */
+static void GFXAnimDrawRows(GFX_ANIM *pAnim, const tImage *image, uint16_t y0, uint16_t y1)
+{
+	const uint16_t left = pAnim->left, top = pAnim->top, h = image->height, w = image->width;
+	bool keep = GFXAnimKeepsUnder(pAnim);
+	COLOR bg = (pAnim->bg == TRANSPARENT) ? WHITE : pAnim->bg;
+
+	if(keep)
+		GFXAnimUnder(pAnim, left, top, y0, y1, false);
+	else
+	{
+		if((w < pAnim->width) && (y0 < h))
+			GFXDisplayDrawRect(left + w, top + y0, left + pAnim->width - 1, top + MIN(y1, (uint16_t)(h - 1)), bg);
+		if(y1 >= h)
+			GFXDisplayDrawRect(left, top + MAX(y0, h), left + pAnim->width - 1, top + y1, bg);
+	}
+	if((y0 >= h) || (w == 0))
+		return;
+
+	uint16_t last = MIN(y1, (uint16_t)(h - 1));
+	GFX_ROP rop = keep ? GFX_ROP_AND : GFX_ROP_SET;		//white pixels keep what is below
+	if(gfx->bandLines)
+		GFXDisplayRecordImage(left, top, image, false);	//the rows out of y0~y1 are the same as before, not sent
+	else if(((y0 == 0) && (last == h - 1)) || (image->compression == TIMAGE_RLE))
+		GFX_GEOMETRY_CALL(GFXDisplayImage_FB, left, top, image, false, rop);
+	else
+		GFX_GEOMETRY_CALL(GFXDisplayBlit_FB, left, top + y0, image->data + (uint32_t)y0 * ((w + 7) / 8), w, last - y0 + 1,
+						  (w + 7) / 8, false, rop);
+	GFXDisplayCommitLines(top + y0, top + last);
+}
+
+/**
+ * @brief	Local function to clear the box painted last, with bg or what was below it
+ */
+static void GFXAnimErase(GFX_ANIM *pAnim)
+{
+	if(GFXAnimKeepsUnder(pAnim))
+		GFXAnimUnder(pAnim, pAnim->drawnLeft, pAnim->drawnTop, 0, pAnim->height - 1, false);
+	else
+		GFXDisplayDrawRect(pAnim->drawnLeft, pAnim->drawnTop, pAnim->drawnLeft + pAnim->width - 1, pAnim->drawnTop + pAnim->height - 1,
+						   (pAnim->bg == TRANSPARENT) ? WHITE : pAnim->bg);
+	pAnim->flags &= ~GFX_ANIM_DRAWN;
+}
+
+/**
+ * @return	true if row y of the box is the same with frame a and frame b
+ */
+static bool GFXAnimRowSame(const tImage *a, const tImage *b, uint16_t y)
+{
+	if(a == b)
+		return true;
+	if((y >= a->height) && (y >= b->height))
+		return true;		//bg or what was below, both
+	if((y >= a->height) || (y >= b->height) || (a->width != b->width) ||
+	   (a->compression != TIMAGE_RAW) || (b->compression != TIMAGE_RAW))
+		return false;
+
+	uint16_t bytesPerLine = (a->width + 7) / 8;
+	return GFXRowEqual<GFXRowKernel>(a->data + (uint32_t)y * bytesPerLine, b->data + (uint32_t)y * bytesPerLine, bytesPerLine);
+}
+
+/**
+ * @brief	Local function to move on to the frame due at time now
+ */
+static void GFXAnimAdvance(GFX_ANIM *pAnim, uint32_t now)
+{
+	for(uint16_t n = 0; (int32_t)(now - pAnim->dueMs) >= 0; n++)
+	{
+		if(n == pAnim->count)	//a whole sequence late, go on from now
+		{
+			pAnim->dueMs = now + pAnim->frames[pAnim->frame].ms;
+			break;
+		}
+		if(pAnim->frame + 1 < pAnim->count)
+			pAnim->frame++;
+		else if(pAnim->loops != 1)
+		{
+			pAnim->frame = 0;
+			if(pAnim->loops)
+				pAnim->loops--;
+		}
+		else
+		{
+			pAnim->flags &= ~GFX_ANIM_RUNNING;
+			break;
+		}
+		pAnim->dueMs += pAnim->frames[pAnim->frame].ms;
+	}
+}
+
+/**
+ * @brief	Move every animation linked from pFirst on to the frame due now, paint what has changed on the selected display
+ *			and send the lines with one GFXDisplayFlush()
+ *			Rows of the box that are the same in the frame shown and in the next one are not drawn nor sent, a frame is
+ *			compared with the one before row by row (a TIMAGE_RLE frame is drawn whole). A moved or erased box is cleared
+ *			at its old position first.
+ * @param	*pFirst is the first animation, those added to it with GFXAnimAdd() follow
+ * @return	number of lines sent, 0 if no frame has changed
+ * @note	Call it from the main loop as often as the shortest frame needs. The drawing is done in GFX_FLUSH_DEFERRED mode,
+ *			the flush mode set before is restored. Lines other drawing functions left dirty in GFX_FLUSH_DEFERRED mode go
+ *			out with the same flush.<br>
+ *			Example<br>
+ *				static const GFX_ANIM_FRAME sport[] = { {&run_64x64, 400}, {&step_64x64, 400}, {&swim_64x64, 400} };<br>
+ *				GFXAnimInit(&icon, sport, 3, 5, 5, WHITE, NULL);<br>
+ *				GFXAnimStart(&icon, 0);<br>
+ *				//...in loop()<br>
+ *				GFXAnimTick(&icon);
+ */
+uint16_t GFXAnimTick(GFX_ANIM *pFirst)
+{
+	uint32_t now = hal_millis();
+	bool changed = false;
+	GFX_FLUSH_MODE mode = GFXDisplayGetFlushMode();
+	GFX_ROP rop = gfx->rop;
+
+	GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);
+	gfx->rop = GFX_ROP_SET;		//the box is painted over, whatever the caller draws with
+	for(GFX_ANIM *pAnim = pFirst; pAnim != NULL; pAnim = pAnim->next)
+	{
+		if(pAnim->count == 0)
+			continue;
+		if(pAnim->flags & GFX_ANIM_RUNNING)
+			GFXAnimAdvance(pAnim, now);
+
+		bool drawn = (pAnim->flags & GFX_ANIM_DRAWN) != 0;
+		if(drawn && (!(pAnim->flags & GFX_ANIM_SHOWN) || (pAnim->drawnLeft != pAnim->left) || (pAnim->drawnTop != pAnim->top)))
+		{
+			GFXAnimErase(pAnim);
+			changed = true;
+			drawn = false;
+		}
+		if(!(pAnim->flags & GFX_ANIM_SHOWN))
+			continue;
+
+		const tImage *image = pAnim->frames[pAnim->frame].image;
+		if(!drawn)
+		{
+			if(GFXAnimKeepsUnder(pAnim))
+				GFXAnimUnder(pAnim, pAnim->left, pAnim->top, 0, pAnim->height - 1, true);
+			GFXAnimDrawRows(pAnim, image, 0, pAnim->height - 1);
+			changed = true;
+		}
+		else if(image != pAnim->drawnImage)
+		{
+			for(uint16_t y = 0; y < pAnim->height; )	//runs of rows that differ
+			{
+				if(GFXAnimRowSame(pAnim->drawnImage, image, y))
+				{
+					y++;
+					continue;
+				}
+				uint16_t y0 = y;
+				while((y < pAnim->height) && !GFXAnimRowSame(pAnim->drawnImage, image, y))
+					y++;
+				GFXAnimDrawRows(pAnim, image, y0, y - 1);
+				changed = true;
+			}
+		}
+		pAnim->drawnImage = image;
+		pAnim->drawnLeft = pAnim->left;
+		pAnim->drawnTop = pAnim->top;
+		pAnim->flags |= GFX_ANIM_DRAWN;
+	}
+	gfx->rop = rop;
+
+	uint16_t lines = changed ? GFXDisplayFlush() : 0;
+	GFXDisplaySetFlushMode(mode);
+	return lines;
+}
+
+/**
+ * @brief 	Print a picture with byte array created by a shareware LCD Assistant (http://en.radzio.dxp.pl/bitmap_converter/)
+ * @note	Option in LCD Assistant: Byte orientation = Horizontal, Other = Include size, endianness=Little<, Pixels/byte=8<br>
+ *			This fcn for reference only.
+ * @param	left is the top left corner position
+ * @param	top is the top line position
+ * @param	*data is a pointer to data array in Flash space
+ * @param	invert is a boolean flag for negative effect (true for negative, false for normal display)
+ */
+ /*
+void GFXDisplayPutPicture(uint16_t left, uint16_t top, const uint8_t* data, bool invert)
+{
+	uint16_t imgHeight=0, imgWidth=0;
+	const uint8_t *pdata;
+	uint16_t x, y, _x, _y;
+	uint8_t pixel, bit;
+	COLOR _color;
+	
 	pdata = data;
 	imgWidth =  (((uint16_t)*(pdata+1))<<8) + (uint16_t)*pdata;
 	imgHeight = (((uint16_t)*(pdata+3))<<8) + (uint16_t)*(pdata+2);
 	
-	//USE_SERIAL.print("Image height = "); USE_SERIAL.println(imgHeight);
-	//USE_SERIAL.print("Image width = "); USE_SERIAL.println(imgWidth);
+	//USE_SERIAL.print("Image height = "); USE_SERIAL.println(imgHeight);
+	//USE_SERIAL.print("Image width = "); USE_SERIAL.println(imgWidth);
+	
+	pdata += 4;	//points to the 5th byte for head of data
+	
+	uint16_t bytesPerLine = (imgWidth+7)/8;
+	//USE_SERIAL.print("Bytes/Line = "); USE_SERIAL.println(bytesPerLine);
+	for(y = 0; y < imgHeight; y++)
+    {
+        for(x = 0; x < imgWidth; x++)
+        {
+            uint16_t col = x/8;
+			pixel = pdata[y*bytesPerLine + col];
+			if(!invert)
+				pixel^=0xff;
+			//USE_SERIAL.print("pixel = "); USE_SERIAL.println(pixel, HEX);
+			bit = x%8;
+			pixel = pixel<<bit;
+			pixel = pixel>>7;
+			
+			_x = left + x;
+			_y = top  + y;
+            (pixel==1) ? _color = WHITE :  _color = BLACK;
+			//USE_SERIAL.print("(_x,_y) = "); USE_SERIAL.print(_x);USE_SERIAL.print(','); USE_SERIAL.println(_y);
+            GFXDisplayPutPixel_FB(_x, _y, _color);	//save to frame buffer first
+        }
+    }	
+	GFXDisplayUpdateBlock(top+1, top+imgHeight, (uint8_t *)&frameBuffer[top]);
+}
+*/
+
+/**
+ * @brief 	Print an image with byte array created by a shareware LCD Image Converter
+ * @note	Project's home page: http://www.riuson.com/lcd-image-converter<br>
+ *			Conversion options<br>
+ *			(1)Prepare->Scanning->Main Scan Direction : Top to Bottom, Line Scan Direction : Forward<br>
+ *			(2)Image->Common->split to rows, Block Size->8 bit, Byte order->Little-Endian<br>
+ * @param	left is the top left corner position
+ * @param	top is the top line position
+ * @param	*image is a pointer to data type tImage from Flash
+ * @param	invert is a boolean flag for negative effect (true for negative, false for normal display)
+ */
+void GFXDisplayPutImage(uint16_t left, uint16_t top, const tImage* image, bool invert)
+{
+	uint16_t imgHeight=image->height, imgWidth=image->width;
+
+	if((imgHeight == 0) || (imgWidth == 0))
+		return;
+
+	if(gfx->bandLines)
+		GFXDisplayRecordImage(left, top, image, invert);
+	else
+		GFX_GEOMETRY_CALL(GFXDisplayImage_FB, left, top, image, invert, gfx->rop);
+
+	//Finally LCD refreshed with multiple lines update from frame buffer.
+	GFXDisplayCommitLines(top, top+imgHeight-1);
+}
+
+/**
+ * @brief	Display a test pattern of vertical strip with horizontal byte defined
+ * @param	pattern in 8-bit to define the byte pattern
+ * @param	*pfcn a pointer to function when SCS in high state, mainly for energy measurement.
+ * @return	time in millisec to update the display with a vertical strip pattern
+ * @note	No frame buffer is involved. This function displays a vertical strip pattern defined by the argument 'pattern' in LSB format.<br>
+ *			Example to use<br>
+ *				GFXDisplayTestPattern(0xF0, NULL);
+ */
+uint32_t GFXDisplayTestPattern(uint8_t pattern, void (*pfcn)(void))
+{ 	
+	const GFX_DISPLAY_DESC *pDesc = gfx->pDesc;
+	uint32_t timing = 0;
+	uint32_t sMillis = hal_millis();
+	uint8_t header[2];
+	uint8_t strip[GFX_FB_CANVAS_W];
+	uint16_t stripLen = pDesc->bytesPerLine;
+	uint16_t sent = 0;
+
+	if(stripLen > sizeof(strip))	//a model wider than the default one sends its line in pieces
+		stripLen = sizeof(strip);
+	GFXRowFill<GFXRowKernel>(strip, pattern, sizeof(strip));
+#if (GFX_SHADOW == GFX_SHADOW_COPY)
+	if(gfx->shadow)
+		GFXRowFill<GFXRowKernel>((uint8_t *)gfx->shadow, pattern, (uint32_t)pDesc->height * pDesc->bytesPerLine);	//the LCD shows the strip pattern now
+#elif (GFX_SHADOW == GFX_SHADOW_HASH)
+	if(gfx->shadow)
+	{
+		uint32_t stripHash = 2166136261UL;
+		for(uint16_t i = 0; i < pDesc->bytesPerLine; i++)
+			stripHash = (stripHash ^ pattern) * 16777619UL;
+		for(uint16_t y = 0; y < pDesc->height; y++)
+			((uint32_t *)gfx->shadow)[y] = stripHash;
+	}
+#endif
+
+  GFXDisplayFlushWait();
+  GFXDisplayVcomUpdate();
+  hal_spi_start_transaction();
+  hal_delayUs(pDesc->scsSetupUs); //SCS setup time of tsSCS (refer to datasheet for timing details)
+  
+  for(uint16_t line=1; line<=pDesc->height; line++)
+  {
+    GFX_GEOMETRY_CALL(GFXDisplayLineHeader, line, header);
+    hal_spi_write_buffer(header, sizeof(header));
+    for(sent = 0; sent < pDesc->bytesPerLine; sent += stripLen)
+      hal_spi_write_buffer(strip, MIN(stripLen, (uint16_t)(pDesc->bytesPerLine - sent)));
+	
+	if(line==pDesc->height/2)
+	{
+		if(pfcn!=NULL) {
+			pfcn();//run pfcn() only once sample in the middle, pls make sure sampling time is long enough
+		}	
+	}
+  }
+  
+  hal_spi_write_buffer(dummyBytes, sizeof(dummyBytes));
+  
+  hal_spi_end_transaction();
+  GFX_STATS_ADD(transactions, 1);
+  GFX_STATS_ADD(linesSent, pDesc->height);
+  GFX_STATS_ADD(payloadBytes, (uint32_t)pDesc->height * pDesc->bytesPerLine);
+  GFX_STATS_ADD(headerBytes, 2u * pDesc->height);
+  GFX_STATS_ADD(dummyBytes, sizeof(dummyBytes));
+  GFX_STATS_ADD(delayUs, pDesc->scsSetupUs);
+
+	timing = hal_millis()-sMillis;
+  
+  return timing;
+}
+
+/**
+ * @brief Function to write the 2-byte command header of a line
+ * @param line is the gate line address from 1 to the display height
+ * @param *header is a pointer to 2 bytes to fill
+ */
+template <class G>
+static void GFXDisplayLineHeader(uint16_t line, uint8_t *header)
+{
+  if(G::addressBits() == 10)
+  {
+    header[0] = (uint8_t)((line<<6)|0x01|vcomBit);  //update one specified line with M0=H,M2=L,M1=VCOM & AG0:AG1 concatenate to Bit[1:0] sending with LSB first
+    header[1] = (uint8_t)(line>>2);         //AG2~AG9 in LSB first
+  }
+  else
+  {
+    header[0] = 0x01|vcomBit;               //update one specified line with M0=H,M2=L,M1=VCOM sending with LSB first
+    header[1] = (uint8_t)line;              //AG0~AG7 in LSB first for gate line address
+  }
+}
+
+#if GFX_LINE_HEADERS
+/**
+ * @brief Function to write the command header of LCD rows top~end-1 in front of their frame buffer rows
+ * @param top is the first LCD row, end is one past the last
+ * @note  Waits for a transfer in progress, it may read them.
+ */
+template <class G>
+static void GFXDisplayBakeHeaders(uint16_t top, uint16_t end)
+{
+  GFXDisplayFlushWait();
+  for(uint16_t y = top; y < end; y++)
+    GFXDisplayLineHeader<G>(y+1, G::row(y) - GFX_FB_HEADER);   //Line counts from 1
+}
+
+/**
+ * @brief Function to make the headers in the frame buffer current before lines are sent from it
+ * @note  They are all written again when the header of the first row is not the one it should be: never written, cleared
+ *        with the rows, another band in the frame buffer or M1 changed by VCOM. A scroll writes those of its region itself.
+ */
+template <class G>
+static void GFXDisplayCheckHeaders(void)
+{
+  const uint16_t first = G::firstRow();
+  const uint8_t *baked = G::row(first) - GFX_FB_HEADER;
+  uint8_t header[2];
+
+  GFXDisplayLineHeader<G>(first+1, header);
+  if((baked[0] != header[0]) || (baked[1] != header[1]))
+    GFXDisplayBakeHeaders<G>(first, G::height());
+}
+#endif
+
+/**
+ * @brief Function to update one line
+ * @note  The minimum payload to write to a Memory LCD is a horizontal line
+ * @param line is the line number start from 1 to the display height, sent from its frame buffer row
+ */
+template <class G>
+static void GFXDisplayUpdateLine(uint16_t line)
+{
+  if((line == 0) || (line > G::height()))
+    return;
+  
+  const uint8_t *buf = G::row(line-1);
+  if(!GFXDisplayLineChanged<G>(line, buf))
+  {
+    GFX_STATS_ADD(redundantLines, 1);
+    return;
+  }
+
+  GFXDisplayFlushWait();
+  GFXDisplayVcomUpdate();
+#if GFX_LINE_HEADERS
+  GFXDisplayCheckHeaders<G>();
+#else
+  uint8_t header[2];
+  GFXDisplayLineHeader<G>(line, header);
+#endif
+  
+  hal_spi_start_transaction();
+  hal_delayUs(gfx->pDesc->scsSetupUs); //SCS setup time of tsSCS (refer to datasheet for timing details)
+#if GFX_LINE_HEADERS
+  hal_spi_write_buffer(buf - GFX_FB_HEADER, GFX_FB_HEADER + G::bytesPerLine());   //header and row as they are in the frame buffer
+#else
+  hal_spi_write_buffer(header, sizeof(header));
+  hal_spi_write_buffer(buf, G::bytesPerLine());   //the whole frame buffer row in one transfer
+#endif
+  hal_spi_write_buffer(dummyBytes, sizeof(dummyBytes));
+  hal_delayUs(gfx->pDesc->scsHoldUs); //SCS hold time of thSCS (refer to datasheet for timing details)
+  hal_spi_end_transaction();
+  GFX_STATS_ADD(transactions, 1);
+  GFX_STATS_ADD(linesSent, 1);
+  GFX_STATS_ADD(payloadBytes, G::bytesPerLine());
+  GFX_STATS_ADD(headerBytes, 2);
+  GFX_STATS_ADD(dummyBytes, sizeof(dummyBytes));
+  GFX_STATS_ADD(delayUs, gfx->pDesc->scsSetupUs + gfx->pDesc->scsHoldUs);
+}
+
+/**
+ * @note  Multiple-lines update being sent. Lines are added in any order, each with its own gate address, so rows that are not
+ *        sent in between cost nothing. The SCS window is opened by the first line and closed by GFXDisplayUpdateEnd().
+ */
+typedef struct
+{
+  bool      open;
+  uint32_t  bytes;    //header and row bytes in the open window
+  const uint8_t *span;  //GFX_LINE_HEADERS: lines adjacent in the frame buffer not written yet, from the header of the first one
+  uint32_t  spanLen;
+} GFX_UPDATE;
+
+#if GFX_SCS_MAX_US
+/**
+ * @brief Function to estimate the bus time of an SCS window
+ * @param bytes is the number of header and row bytes, the dummy bytes are added here
+ * @return us from SCS high to SCS low: tsSCS, the bytes at GFX_SPI_CLOCK_HZ and thSCS
+ */
+static uint32_t GFXDisplayWindowUs(uint32_t bytes)
+{
+  return gfx->pDesc->scsSetupUs + gfx->pDesc->scsHoldUs +
+         (uint32_t)(((uint64_t)(bytes + sizeof(dummyBytes)) * 8u * 1000000u) / GFX_SPI_CLOCK_HZ);
+}
+#endif
+
+#if GFX_LINE_HEADERS
+/**
+ * @brief Function to write the lines collected by GFXDisplayUpdateAdd(), headers and rows as they are in the frame buffer
+ */
+static void GFXDisplayUpdateSpan(GFX_UPDATE *pUpdate)
+{
+  for(uint32_t sent = 0; sent < pUpdate->spanLen; sent += 0x8000)
+    hal_spi_write_buffer(&pUpdate->span[sent], (uint16_t)MIN(pUpdate->spanLen - sent, (uint32_t)0x8000));
+  pUpdate->spanLen = 0;
+}
+#endif
+
+/**
+ * @brief Function to close the SCS window of an update, nothing is sent when no line was added
+ */
+static void GFXDisplayUpdateEnd(GFX_UPDATE *pUpdate)
+{
+  if(!pUpdate->open)
+    return;
+
+#if GFX_LINE_HEADERS
+  GFXDisplayUpdateSpan(pUpdate);
+#endif
+  hal_spi_write_buffer(dummyBytes, sizeof(dummyBytes));
+  hal_delayUs(gfx->pDesc->scsHoldUs); //SCS hold time of thSCS (refer to datasheet for timing details)
+  hal_spi_end_transaction();
+  pUpdate->open = false;
+  GFX_STATS_ADD(transactions, 1);
+  GFX_STATS_ADD(dummyBytes, sizeof(dummyBytes));
+  GFX_STATS_ADD(delayUs, gfx->pDesc->scsSetupUs + gfx->pDesc->scsHoldUs);
+}
+
+/**
+ * @brief Function to send one line within an update, the SCS window is opened first if needed
+ * @param line is the line number start from 1 to the display height
+ * @param *buf is a pointer to data
+ * @note  With GFX_SCS_MAX_US the open window is closed first when this line would make it last longer.<br>
+ *        With GFX_LINE_HEADERS lines adjacent in the frame buffer are collected and written together.
+ */
+template <class G>
+static void GFXDisplayUpdateAdd(GFX_UPDATE *pUpdate, uint16_t line, const uint8_t *buf)
+{
+  const uint16_t W = G::bytesPerLine();
+  uint8_t header[2];
+
+#if GFX_SCS_MAX_US
+  if(pUpdate->open && (GFXDisplayWindowUs(pUpdate->bytes + sizeof(header) + W) > GFX_SCS_MAX_US))
+    GFXDisplayUpdateEnd(pUpdate);
+#endif
+  if(!pUpdate->open)
+  {
+    GFXDisplayFlushWait();
+    GFXDisplayVcomUpdate();
+#if GFX_LINE_HEADERS
+    GFXDisplayCheckHeaders<G>();
+#endif
+    hal_spi_start_transaction();
+    hal_delayUs(gfx->pDesc->scsSetupUs); //SCS setup time of tsSCS (refer to datasheet for timing details)
+    pUpdate->open = true;
+    pUpdate->bytes = 0;
+  }
+
+#if GFX_LINE_HEADERS
+  (void)line;
+  if(pUpdate->spanLen && (buf - GFX_FB_HEADER != pUpdate->span + pUpdate->spanLen))
+    GFXDisplayUpdateSpan(pUpdate);    //not next to the lines collected
+  if(pUpdate->spanLen == 0)
+    pUpdate->span = buf - GFX_FB_HEADER;
+  pUpdate->spanLen += sizeof(header) + W;
+#else
+  GFXDisplayLineHeader<G>(line, header);
+  hal_spi_write_buffer(header, sizeof(header));
+  hal_spi_write_buffer(buf, W);   //the whole frame buffer row in one transfer
+#endif
+  pUpdate->bytes += sizeof(header) + W;
+  GFX_STATS_ADD(linesSent, 1);
+  GFX_STATS_ADD(payloadBytes, W);
+  GFX_STATS_ADD(headerBytes, sizeof(header));
+}
+
+/**
+ * @brief Function to update multiple lines
+ * @param start_line indicates the starting line number ranges 1~display height
+ * @param end_line indicates the ending line number ranges 1~display height
+ * @note  With GFX_SHADOW enabled only lines that differ from the LCD are sent, all of them in one transaction.<br>
+ *        Nothing is sent when no line has changed.
+ */
+template <class G>
+static void GFXDisplayUpdateBlock(uint16_t start_line, uint16_t end_line)
+{
+  const uint16_t H = G::height();
+
+  if((start_line == 0) || (start_line > end_line) || (start_line > H))
+    return;
+
+  uint16_t _end_line = MIN(end_line,H);	//clip the ending gate line address
+  GFX_UPDATE update = {false, 0, NULL, 0};
+  
+  for(uint16_t line=start_line; line<=_end_line; line++)
+  {
+    const uint8_t *buf = G::row(line-1);
+    if(GFXDisplayLineChanged<G>(line, buf))
+      GFXDisplayUpdateAdd<G>(&update, line, buf);
+    else
+      GFX_STATS_ADD(redundantLines, 1);
+  }
+  GFXDisplayUpdateEnd(&update);
+}
+
+/**
+ * @brief Function to send the rows marked in the dirty bitmap within LCD rows top~end-1 as one multiple-lines update, wherever
+ *        they are. The rows are marked clean.
+ * @param top is the first LCD row to look at, end is one past the last
+ * @return number of dirty rows, including those the shadow finds unchanged and does not send
+ */
+template <class G>
+static uint16_t GFXDisplayUpdateDirty(uint16_t top, uint16_t end)
+{
+  uint8_t *dirtyLines = gfx->dirtyLines;
+  GFX_UPDATE update = {false, 0, NULL, 0};
+  uint16_t dirty = 0;
+
+  for(uint16_t y = top; y < end; y++)
+  {
+    if(dirtyLines[y >> 3] == 0)  //skip 8 clean lines at once
+    {
+      y |= 0x07;
+      continue;
+    }
+    if((dirtyLines[y >> 3] & (0x01 << (y & 0x07))) == 0)
+      continue;
+
+    dirtyLines[y >> 3] &= (uint8_t)~(0x01 << (y & 0x07));
+    dirty++;
+
+    const uint8_t *row = G::row(y);
+    if(GFXDisplayLineChanged<G>(y+1, row))   //Line counts from 1
+      GFXDisplayUpdateAdd<G>(&update, y+1, row);
+    else
+      GFX_STATS_ADD(redundantLines, 1);
+  }
+  GFXDisplayUpdateEnd(&update);
+  return dirty;
+}
+
+#if (GFX_SHADOW == GFX_SHADOW_HASH)
+/**
+ * @brief Function to hash a frame buffer row (32-bit FNV-1a)
+ * @param *buf is a pointer to the row
+ * @param len is the row size in bytes
+ */
+static uint32_t GFXDisplayLineHash(const uint8_t *buf, uint16_t len)
+{
+  uint32_t hash = 2166136261UL;
+
+  for(uint16_t i = 0; i < len; i++)
+  {
+    hash ^= buf[i];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+#endif
+
+/**
+ * @brief Function to check a line against the shadow of the LCD content. The shadow is updated as the line is going to be sent.
+ * @param line is the line number start from 1 to the display height
+ * @param *buf is a pointer to data
+ * @return true if the line has to be sent, always true without GFX_SHADOW or a display without shadow storage
+ */
+template <class G>
+static bool GFXDisplayLineChanged(uint16_t line, const uint8_t *buf)
+{
+#if (GFX_SHADOW == GFX_SHADOW_COPY)
+  if(gfx->shadow == 0)
+    return true;
+
+  uint8_t *shadow = (uint8_t *)gfx->shadow + (uint32_t)(line-1)*G::bytesPerLine();
+
+  if(gfx->shadowValid && GFXRowEqual<GFXRowKernel>(shadow, buf, G::bytesPerLine()))
+    return false;
+
+  GFXRowCopy<GFXRowKernel>(shadow, buf, G::bytesPerLine());
+  return true;
+#elif (GFX_SHADOW == GFX_SHADOW_HASH)
+  if(gfx->shadow == 0)
+    return true;
+
+  uint32_t hash = GFXDisplayLineHash(buf, G::bytesPerLine());
+  uint32_t *shadowHash = (uint32_t *)gfx->shadow;
+
+  if(gfx->shadowValid && (shadowHash[line-1] == hash))
+    return false;
+
+  shadowHash[line-1] = hash;
+  return true;
+#else
+  (void)line; (void)buf;
+  return true;
+#endif
+}
+
+/**
+ * @brief	Print a character from MCU's Flash with data created by BitFontCreator
+ * @param	(x,y) is the top left corner coordinates
+ * @param	BFC_FONT* pFont is a pointer to font data from MCU's Flash. Font data created by BitFontCreator (http://www.iseasoft.com)
+ * @param	ch in 2-byte width represents the character
+ * @param	color is the font color BLACK/WHITE
+ * @param	bg is the background color BLACK/WHITE/TRANSPARENT. TRANSPARENT means the background is not changed.
+ * @return	width of character printed
+ * @note	Example <br>
+ *			extern const BFC_FONT fontArial_Rounded_MT_Bold37h;	//font map Arial_Rounded_MT_Bold37.c created by BitFontCreator
+ *			//...
+ *			GFXDisplayPutChar(50,50,&fontArial_Rounded_MT_Bold37h, 0x0042, BLACK, WHITE);	//print the ASCII character 'B' with black stroke on white background
+ */
+uint16_t GFXDisplayPutChar(uint16_t x, uint16_t y, const BFC_FONT* pFont, const uint16_t ch, COLOR color, COLOR bg)
+{
+	if( pFont == 0 )
+		return 0;
+
+	uint16_t wstr[2] = {ch, '\0'};
+	uint16_t width = gfx->bandLines ? GFXDisplayRecordText(x, y, pFont, NULL, wstr, color, bg) :
+									  bfc_DrawChar_RowRowUnpacked(x,y,pFont,ch,color, bg, gfx->rop);
+	if(pFont->FontHeight)
+		GFXDisplayCommitLines(y, y+pFont->FontHeight-1);
+
+	return width;
+}
+
+/**
+ * @brief	Print string of ASCII code of 1 byte width
+ * @param	(x,y) is the top left corner coordinates
+ * @param	BFC_FONT* pFont is a pointer to font data from MCU's Flash. Font data created by BitFontCreator (http://www.iseasoft.com)
+ * @param	*str is a pointer to character array from Flash space
+ * @param	color is the font color BLACK/WHITE
+ * @param	bg is the background color BLACK/WHITE/TRANSPARENT. TRANSPARENT means the background is not changed.
+ * @return	width of string printed
+ */
+uint16_t GFXDisplayPutString(uint16_t x, uint16_t y, const BFC_FONT* pFont, const char *str, COLOR color, COLOR bg)
+{
+	uint16_t _x = x;
+	uint16_t _y = y;
+	uint16_t width = 0;
+	char ch = 0;
+	
+	if( pFont == 0 || str == 0 )
+		return 0;
+
+	if(gfx->bandLines)	//one display list entry, drawn when its band is rendered
+		_x += GFXDisplayRecordText(x, y, pFont, str, NULL, color, bg);
+
+	while(!gfx->bandLines && (*str != '\0'))
+	{
+		ch = *str;
+		width = bfc_DrawChar_RowRowUnpacked(_x, _y, pFont, ch, color, bg, gfx->rop);	//frame buffer only, the text band is committed once below
+		str++;
+		_x += width;
+	}  	
+
+	if((_x != x) && pFont->FontHeight)
+		GFXDisplayCommitLines(_y, _y+pFont->FontHeight-1);
+	
+	return (uint16_t)(_x-x);
+}
+
+
+
+/**
+ * @brief	Print string of ASCII code of 2 bytes width that means Unicode can be printed (Chinese, Japanese, etc)
+ * @param	(x,y) is the top left corner coordinates
+ * @param	BFC_FONT* pFont is a pointer to font data from MCU's Flash. Font data created by BitFontCreator (http://www.iseasoft.com)
+ * @param	*str is a pointer to character array from Flash space
+ * @param	color is the font color BLACK/WHITE
+ * @param	bg is the background color BLACK/WHITE/TRANSPARENT. TRANSPARENT means the background is not changed.
+ * @return	width of string printed
+ * @note	Example<br>
+ *			const uint16_t hello_japanese[]={0x3053, 0x3093, 0x306B, 0x3061, 0x306F, '\0'};
+ *			//....
+ *			GFXDisplayPutWString(100,150,&fontSimHei_35h, hello_japanese, BLACK, WHITE);	//SimHei_35h.c created by BitFontCreator
+ */
+uint16_t GFXDisplayPutWString(uint16_t x, uint16_t y, const BFC_FONT* pFont, const uint16_t *str, COLOR color, COLOR bg)
+{
+	uint16_t _x = x;
+	uint16_t _y = y;
+	uint16_t width = 0;
+	uint16_t ch = 0;
 	
-	pdata += 4;	//points to the 5th byte for head of data
+	if( pFont == 0 || str == 0 )
+		return 0;
+
+	if(gfx->bandLines)	//one display list entry, drawn when its band is rendered
+		_x += GFXDisplayRecordText(x, y, pFont, NULL, str, color, bg);
+
+	while(!gfx->bandLines && (*str != '\0'))
+	{
+		ch = *str;
+		width = bfc_DrawChar_RowRowUnpacked(_x, _y, pFont, ch, color, bg, gfx->rop);	//frame buffer only, the text band is committed once below
+		str++;
+		_x += width;
+	}  	
+
+	if((_x != x) && pFont->FontHeight)
+		GFXDisplayCommitLines(_y, _y+pFont->FontHeight-1);
 	
-	uint16_t bytesPerLine = (imgWidth+7)/8;
-	//USE_SERIAL.print("Bytes/Line = "); USE_SERIAL.println(bytesPerLine);
-	for(y = 0; y < imgHeight; y++)
+	return (uint16_t)(_x-x);	
+}
+
+/**
+ * @brief	Decode BFC font into the frame buffer. No display on LCD yet, the caller commits the text band.
+ * @note	1-bpp fonts, BFC_LITTLE_ENDIAN or big endian, are drawn row by row with GFXDisplayGlyph_FB().
+ *			Anti-aliased fonts (2/4/8 bpp) are decoded pixel by pixel, any non-zero pixel is drawn with color. Both merge with raster op rop.
+ */
+static uint16_t bfc_DrawChar_RowRowUnpacked(uint16_t x0, uint16_t y0, const BFC_FONT *pFont, uint16_t ch, COLOR color, COLOR bg, GFX_ROP rop)
+{
+  // 1. find the character information first
+  const BFC_CHARINFO *pCharInfo = GetCharInfo(pFont, (unsigned short)ch);
+  
+  if( pCharInfo != 0 )
+  {
+    int height = pFont->FontHeight;
+    int width = pCharInfo->Width;
+    const unsigned char *pData = pCharInfo->p.pData8;   // pointer to data array
+
+    int bpp = GetFontBpp(pFont->FontType);              // how many bits per pixel
+    int bytesPerLine = (width * bpp + 7) / 8;           // # bytes in a row
+    int bLittleEndian = (GetFontEndian(pFont->FontType)==1);
+
+    // 2. 1-bpp glyphs are merged into the frame buffer a whole row at a time
+    if(bpp == 1)
     {
-        for(x = 0; x < imgWidth; x++)
+      GFX_GEOMETRY_CALL(GFXDisplayGlyph_FB, x0, y0, pData, (uint16_t)width, (uint16_t)height, (uint16_t)bytesPerLine, bLittleEndian, color, bg, rop);
+      return (uint16_t)width;
+    }
+
+    uint16_t x, y, _x, _y, col;
+    unsigned char data, pixel, bit;
+    
+    // 3. draw all the pixels in this character
+    for(y=0; y<height; y++)
+    {
+      for(x=0; x<width; x++)
+      {
+        col = (x * bpp) / 8;       // byte index in the line
+        data = pData[y * bytesPerLine + col];
+
+        // every BYTE (8 bits) data includes 8/bpp pixels,
+        // we need to get each pixel color index (0,1,2,3... based on bpp) from the BYTE data
+        pixel = data;
+        
+        // bit index in the BYTE
+        // For 2-bpp: bit = 2x % 8 (Big Endian),   6 - 2x % 8 (Little Endian)
+        // For 4-bpp: bit = 4x % 8 (Big Endian),   4 - 4x % 8 (Little Endian)
+        bit = bLittleEndian ? (8-bpp)-(x*bpp)%8 : (x*bpp)%8;
+
+        pixel = pixel<<bit;               // clear left pixels
+        pixel = pixel>>(8/bpp-1)*bpp;     // clear right pixels
+        
+        _x = x0+x, 
+        _y = y0+y;
+          
+        if(pixel) 
         {
-            uint16_t col = x/8;
-			pixel = pdata[y*bytesPerLine + col];
-			if(!invert)
-				pixel^=0xff;
-			//USE_SERIAL.print("pixel = "); USE_SERIAL.println(pixel, HEX);
-			bit = x%8;
-			pixel = pixel<<bit;
-			pixel = pixel>>7;
-			
-			_x = left + x;
-			_y = top  + y;
-            (pixel==1) ? _color = WHITE :  _color = BLACK;
-			//USE_SERIAL.print("(_x,_y) = "); USE_SERIAL.print(_x);USE_SERIAL.print(','); USE_SERIAL.println(_y);
-            GFXDisplayPutPixel_FB(_x, _y, _color);	//save to frame buffer first
+		  GFX_GEOMETRY_CALL(GFXDisplayPutPixel_FB, _x, _y, color, rop);	//update frame buffer, no update on screen yet.
         }
-    }	
-	GFXDisplayUpdateBlock(top+1, top+imgHeight, (uint8_t *)&frameBuffer[top]);
+		else
+		{
+			if(bg!=TRANSPARENT)
+				GFX_GEOMETRY_CALL(GFXDisplayPutPixel_FB, _x, _y, bg, rop);
+		}
+      }
+    } 
+	
+    return (uint16_t)width;
+  }
+  return 0;
+} 
+
+/**
+ * @brief	Set up a display instance with buffers sized at run time, e.g. one buffer sized for the largest model of a product line
+ * @param	*pDisplay is the instance to set up
+ * @param	*pDesc is the model descriptor, e.g. &gfxDescLS032B7DD02
+ * @param	*frameBuffer is pDesc->height * pDesc->bytesPerLine bytes, GFX_FB_SIZE(pDesc->width, pDesc->height) with GFX_LINE_HEADERS
+ * @param	*dirtyLines is (pDesc->height+7)/8 bytes
+ * @param	*shadow is pDesc->height * pDesc->bytesPerLine bytes for GFX_SHADOW_COPY, pDesc->height 32-bit words for GFX_SHADOW_HASH,
+ *			or NULL to send every line
+ * @note	GFX_DISPLAY_DEFINE() declares an instance with static buffers instead.
+ */
+void GFXDisplayInit(GFX_DISPLAY *pDisplay, const GFX_DISPLAY_DESC *pDesc, uint8_t *frameBuffer, uint8_t *dirtyLines, void *shadow)
+{
+	pDisplay->pDesc = pDesc;
+	pDisplay->frameBuffer = frameBuffer;
+	pDisplay->dirtyLines = dirtyLines;
+	pDisplay->shadow = shadow;
+	pDisplay->flushMode = GFX_FLUSH_IMMEDIATE;
+	pDisplay->rop = GFX_ROP_SET;
+	pDisplay->shadowValid = false;
+	pDisplay->bandLines = 0;
+	pDisplay->bandTop = 0;
+	pDisplay->bandEnd = 0;
+	pDisplay->bandList = NULL;
+	pDisplay->bandListSize = 0;
+	pDisplay->bandListLen = 0;
+	pDisplay->bandDropped = 0;
+	pDisplay->scrollTop = 0;
+	pDisplay->scrollRows = 0;
+	pDisplay->scrollStart = 0;
+	memset((void *)dirtyLines, 0x00, (pDesc->height + 7) / 8);
 }
-*/
 
 /**
- * @brief 	Print an image with byte array created by a shareware LCD Image Converter
- * @note	Project's home page: http://www.riuson.com/lcd-image-converter<br>
- *			Conversion options<br>
- *			(1)Prepare->Scanning->Main Scan Direction : Top to Bottom, Line Scan Direction : Forward<br>
- *			(2)Image->Common->split to rows, Block Size->8 bit, Byte order->Little-Endian<br>
- * @param	left is the top left corner position
- * @param	top is the top line position
- * @param	*image is a pointer to data type tImage from Flash
- * @param	invert is a boolean flag for negative effect (true for negative, false for normal display)
+ * @brief	Set up a banded display: drawing functions record into a display list and the LCD is rendered bandLines rows at a time,
+ *			so no frame buffer of the whole screen is needed. All drawing functions but the strip chart work the same way.
+ * @param	*pDisplay is the instance to set up
+ * @param	*pDesc is the model descriptor, e.g. &gfxDescLS032B7DD02
+ * @param	*bandBuffer is bandLines * pDesc->bytesPerLine bytes, GFX_FB_SIZE(pDesc->width, bandLines) with GFX_LINE_HEADERS
+ * @param	bandLines is the band height, 1 ~ pDesc->height. Each band replays the display list once.
+ * @param	*bandList is the display list, bandListSize bytes. A drawing call takes about 24 bytes, text 2 more per character.
+ *			A call that paints over whole entries (rectangle, image, text with a background) replaces them.
+ * @param	*dirtyLines is (pDesc->height+7)/8 bytes
+ * @param	*shadow as for GFXDisplayInit(), GFX_SHADOW_HASH suits a banded display
+ * @note	GFXDisplayAllClear() empties the display list. GFX_DISPLAY_DEFINE_BANDED() declares an instance with static buffers instead.<br>
+ *			The display starts in GFX_FLUSH_DEFERRED mode. In GFX_FLUSH_IMMEDIATE mode every drawing call renders the bands of its
+ *			rows and sends them, replaying the list each time, so rows covered by several calls go out several times: a screen
+ *			of 16 calls on the 2.7" LCD sends about 5.6 times the lines of one flush (extras/bench/bench_band.cpp).<br>
+ *			Example with 16 lines for LS032B7DD02, about 2.8 KB instead of 22.5 KB of frame buffer<br>
+ *				GFX_DISPLAY_DEFINE_BANDED(lcd, LS032B7DD02, 16, 2048);<br>
+ *				GFXDisplaySelect(&lcd);<br>
+ *				GFXDisplayPowerOn();<br>
+ *				//...draw<br>
+ *				GFXDisplayFlush();	//renders the dirty lines band by band
  */
-void GFXDisplayPutImage(uint16_t left, uint16_t top, const tImage* image, bool invert)
+void GFXDisplayInitBanded(GFX_DISPLAY *pDisplay, const GFX_DISPLAY_DESC *pDesc, uint8_t *bandBuffer, uint16_t bandLines,
+						  uint8_t *bandList, uint16_t bandListSize, uint8_t *dirtyLines, void *shadow)
 {
-	uint16_t imgHeight=image->height, imgWidth=image->width;
-	const uint8_t *pdata;
-	uint16_t x, y, _x, _y;
-	uint8_t pixel, bit;
-	COLOR _color;
-	
-	pdata = image->data;
-	
-	//USE_SERIAL.print("Image height = "); USE_SERIAL.println(imgHeight);
-	//USE_SERIAL.print("Image width = "); USE_SERIAL.println(imgWidth);
-	
-	uint16_t bytesPerLine = (imgWidth+7)/8;
-	//USE_SERIAL.print("Bytes/Line = "); USE_SERIAL.println(bytesPerLine);
-	for(y = 0; y < imgHeight; y++)
-    {
-        for(x = 0; x < imgWidth; x++)
-        {
-            uint16_t col = x/8;	//col is the byte count in horizontal direction
-			pixel = pdata[y*bytesPerLine + col];
-			if(invert)
-				pixel^=0xff;
-			//USE_SERIAL.print("pixel = "); USE_SERIAL.println(pixel, HEX);
-			bit = x%8;	//bit position 
-			pixel = pixel<<bit;			//shifting pixel byte according to which bit position to use, bit value now at MSB position 7
-			pixel = pixel>>7;			//For B/W LCD we simply shift the bit value to the LSB position at 0 for WHITE/BLACK conditional test below
+	GFXDisplayInit(pDisplay, pDesc, bandBuffer, dirtyLines, shadow);
+	pDisplay->flushMode = GFX_FLUSH_DEFERRED;
+	pDisplay->bandLines = MIN(MAX(bandLines, (uint16_t)1), pDesc->height);
+	pDisplay->bandList = bandList;
+	pDisplay->bandListSize = bandListSize;
+}
 
-			_x = left + x;
-			_y = top  + y;
-            (pixel==1) ? _color = WHITE :  _color = BLACK;
-			//USE_SERIAL.print("(_x,_y) = "); USE_SERIAL.print(_x);USE_SERIAL.print(','); USE_SERIAL.println(_y);
-            GFXDisplayPutPixel_FB(_x, _y, _color);	//save to frame buffer first
-        }
-    }	
-	//Finally LCD refreshed with multiple lines update from frame buffer.
-	GFXDisplayUpdateBlock(top+1, top+imgHeight, (uint8_t *)&frameBuffer[top]);	
+/**
+ * @brief	Return the bytes of the display list used by the selected banded display, 0 for a display with a full frame buffer
+ * @param	*pDropped receives the number of drawing calls that did not fit into the list since GFXDisplayAllClear(), may be NULL
+ */
+uint16_t GFXDisplayGetBandListUsed(uint16_t *pDropped)
+{
+	if(pDropped != NULL)
+		*pDropped = gfx->bandDropped;
+	return gfx->bandListLen;
+}
+
+/**
+ * @brief	Select the display all API functions work on
+ * @param	*pDisplay is an instance from GFX_DISPLAY_DEFINE() or GFXDisplayInit(), NULL for the default display (model selected in MemoryLCD.h)
+ * @note	Every display keeps its own frame buffer, flush mode and dirty lines. The SPI bus and the SCS/DISP/EXTCOMIN pins are shared,
+ *			so one binary can pick its panel at start-up. Run GFXDisplayPowerOn() after selecting it.
+ */
+void GFXDisplaySelect(GFX_DISPLAY *pDisplay)
+{
+	gfx = (pDisplay != NULL) ? pDisplay : &defaultDisplay;
+}
+
+/**
+ * @brief	Return the display selected by GFXDisplaySelect()
+ */
+GFX_DISPLAY* GFXDisplayGetSelected(void)
+{
+	return gfx;
+}
+
+/**
+ * @brief	Return the descriptor of the selected display
+ */
+const GFX_DISPLAY_DESC* GFXDisplayGetDesc(void)
+{
+	return gfx->pDesc;
+}
+
+/**
+ * @brief	Select how drawing functions refresh the LCD
+ * @param	mode is GFX_FLUSH_IMMEDIATE (default) or GFX_FLUSH_DEFERRED (default of banded displays)
+ * @note	Switching back to GFX_FLUSH_IMMEDIATE flushes all lines still marked dirty.<br>
+ *			Example to compose a screen with one refresh<br>
+ *				GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);<br>
+ *				GFXDisplayPutString(10,10,&fontConsolas24h, "SYS.", BLACK, WHITE);<br>
+ *				GFXDisplayPutImage(200,50,&arrowUp_89x48, false);<br>
+ *				GFXDisplayFlush();
+ */
+void GFXDisplaySetFlushMode(GFX_FLUSH_MODE mode)
+{
+	if((gfx->flushMode == GFX_FLUSH_DEFERRED) && (mode == GFX_FLUSH_IMMEDIATE))
+		GFXDisplayFlush();
+
+	gfx->flushMode = mode;
+}
+
+/**
+ * @brief	Return the flush mode selected by GFXDisplaySetFlushMode()
+ */
+GFX_FLUSH_MODE GFXDisplayGetFlushMode(void)
+{
+	return gfx->flushMode;
+}
+
+/**
+ * @brief	Select how the selected display merges rectangles, lines, pixels, images and text into its frame buffer
+ * @param	rop is GFX_ROP_SET (default), GFX_ROP_CLEAR, GFX_ROP_XOR, GFX_ROP_OR, GFX_ROP_AND or GFX_ROP_NOT
+ * @note	The ops work on whole frame buffer bytes, so highlighting a field costs its byte spans and one refresh of its rows
+ *			instead of drawing the content again. A banded display records the op with every call.
+ *			Circles, ellipses, strip charts and GFXWidgetRender() always draw with GFX_ROP_SET.<br>
+ *			Example to blink a cursor over a menu row, drawn again to restore it<br>
+ *				GFXDisplaySetRasterOp(GFX_ROP_NOT);<br>
+ *				GFXDisplayDrawRect(0, 40, 399, 63, BLACK);<br>
+ *				GFXDisplaySetRasterOp(GFX_ROP_SET);
+ */
+void GFXDisplaySetRasterOp(GFX_ROP rop)
+{
+	if(rop <= GFX_ROP_NOT)
+		gfx->rop = rop;
+}
+
+/**
+ * @brief	Return the raster op selected by GFXDisplaySetRasterOp()
+ */
+GFX_ROP GFXDisplayGetRasterOp(void)
+{
+	return gfx->rop;
+}
+
+/**
+ * @brief	Local function to reverse the order of frame buffer rows first~last-1 of the selected display
+ */
+static void GFXDisplayReverseRows(uint16_t first, uint16_t last)
+{
+	const uint16_t W = gfx->pDesc->bytesPerLine, S = GFXDescGeometry::stride();
+	uint8_t *fb = gfx->frameBuffer + GFX_FB_HEADER;		//the headers stay, they belong to the rows' places
+
+	for(; first + 1 < last; first++, last--)
+	{
+		uint8_t *a = fb + (uint32_t)first*S, *b = fb + (uint32_t)(last-1)*S;
+		for(uint16_t i = 0; i < W; i++)
+		{
+			uint8_t t = a[i];
+			a[i] = b[i];
+			b[i] = t;
+		}
+	}
+}
+
+/**
+ * @brief	Local function to rotate frame buffer rows first~end-1 of the selected display up by k rows, in place
+ */
+static void GFXDisplayRotateRows(uint16_t first, uint16_t end, uint16_t k)
+{
+	GFXDisplayReverseRows(first, first + k);
+	GFXDisplayReverseRows(first + k, end);
+	GFXDisplayReverseRows(first, end);
+}
+
+/**
+ * @brief	Set the scroll region of the selected display, rows top~top+rows-1. GFXDisplayScroll() moves the content of these rows.
+ * @param	top is the first row of the region
+ * @param	rows is the number of rows, 0 to remove the region
+ * @return	false for a region reaching past the LCD or a banded display, the region is not changed then
+ * @note	One region per display. The content of the LCD and the frame buffer stays the same, rows of the previous region
+ *			are put back at their own addresses in the frame buffer first.
+ */
+bool GFXDisplaySetScrollRegion(uint16_t top, uint16_t rows)
+{
+	if(gfx->bandLines || ((uint32_t)top + rows > gfx->pDesc->height))
+		return false;
+
+	const uint16_t oldTop = gfx->scrollTop, oldEnd = gfx->scrollTop + gfx->scrollRows;
+	bool moved = (gfx->scrollStart != 0);
+
+	if(moved)	//the ring starts at scrollTop again
+		GFXDisplayRotateRows(oldTop, oldEnd, gfx->scrollStart);
+	gfx->scrollTop = top;
+	gfx->scrollRows = rows;
+	gfx->scrollStart = 0;
+#if GFX_LINE_HEADERS
+	if(moved)	//every row is at its own address again
+		GFX_GEOMETRY_CALL(GFXDisplayBakeHeaders, oldTop, oldEnd);
+#endif
+	return true;
+}
+
+/**
+ * @brief	Scroll the content of the scroll region and refresh its rows
+ * @param	lines is the number of rows to move, > 0 up (new rows at the bottom, log style), < 0 down
+ * @param	fill is the color of the rows scrolled in, TRANSPARENT to bring the rows scrolled out back in on the other side
+ * @note	With GFX_SCROLL (default) the frame buffer rows stay where they are, only the start of the ring moves: a scroll costs
+ *			the rows filled and the refresh of the region, which GFX_SHADOW cuts to the rows whose content has changed.
+ *			With GFX_SCROLL 0 the rows are copied. Nothing is done without a region or on a banded display.<br>
+ *			Example of a log of 10 lines in Consolas 24<br>
+ *				GFXDisplaySetScrollRegion(0, 240);<br>
+ *				//...for every new line<br>
+ *				GFXDisplayScroll(24, WHITE);<br>
+ *				GFXDisplayPutString(0, 216, &fontConsolas24h, text, BLACK, WHITE);
+ */
+void GFXDisplayScroll(int16_t lines, COLOR fill)
+{
+	const uint16_t top = gfx->scrollTop, n = gfx->scrollRows;
+
+	if((n == 0) || (lines == 0) || gfx->bandLines)
+		return;
+
+	uint16_t k = (uint16_t)MIN((lines > 0) ? (int32_t)lines : -(int32_t)lines, (int32_t)n);
+	uint16_t in = (lines > 0) ? (uint16_t)(top + n - k) : top;	//first row scrolled in
+
+#if GFX_SCROLL
+	gfx->scrollStart = (uint16_t)(((uint32_t)gfx->scrollStart + ((lines > 0) ? k : (uint16_t)(n - k))) % n);
+#if GFX_LINE_HEADERS
+	GFX_GEOMETRY_CALL(GFXDisplayBakeHeaders, top, top + n);	//the gate address of each row follows it around the ring
+#endif
+#else
+	const uint16_t W = gfx->pDesc->bytesPerLine, S = GFXDescGeometry::stride();
+	uint8_t *region = GFXDescGeometry::row(top);
+	if(fill == TRANSPARENT)
+		GFXDisplayRotateRows(top, top + n, (lines > 0) ? k : (uint16_t)(n - k));
+	else if(lines > 0)
+	{
+		for(uint16_t y = 0; y < n - k; y++)
+			GFXRowCopy<GFXRowKernel>(region + (uint32_t)y*S, region + (uint32_t)(y + k)*S, W);
+	}
+	else
+	{
+		for(uint16_t y = n - 1; y >= k; y--)
+			GFXRowCopy<GFXRowKernel>(region + (uint32_t)y*S, region + (uint32_t)(y - k)*S, W);
+	}
+#endif
+	if(fill != TRANSPARENT)
+		GFX_GEOMETRY_CALL(GFXDisplayFillRect_FB, 0, in, (uint16_t)((gfx->pDesc->bytesPerLine << 3) - 1), in + k - 1, fill, GFX_ROP_SET);
+
+	GFXDisplayCommitLines(top, top + n - 1);
+}
+
+/**
+ * @brief	Return the frame buffer row of LCD row y of the selected display, found through the scroll region
+ * @return	pointer to the bytesPerLine bytes of the row, NULL for a row outside the LCD or a banded display
+ */
+uint8_t* GFXDisplayGetRow(uint16_t y)
+{
+	if(gfx->bandLines || (y >= gfx->pDesc->height))
+		return NULL;
+	return GFXDescGeometry::row(y);
+}
+
+/**
+ * @brief	Local function to draw a display list entry into the band held in the frame buffer. No display on LCD yet.
+ * @param	*pEntry is a copy of the entry
+ * @param	*chars points to the characters following a GFX_BAND_TEXT entry in the list
+ */
+static void GFXDisplayBandReplay(const GFX_BAND_ENTRY *pEntry, const uint8_t *chars)
+{
+	const uint16_t *p = pEntry->p;
+	COLOR color = (COLOR)(pEntry->color & 0x0F);
+	GFX_ROP rop = (GFX_ROP)(pEntry->op >> 4);
+
+	switch(pEntry->op & 0x0F)
+	{
+	case GFX_BAND_RECT:
+		GFXDisplayFillRect_FB<GFXDescGeometry>(pEntry->x1, pEntry->y1, pEntry->x2, pEntry->y2, color, rop);
+		break;
+	case GFX_BAND_LINE:
+		GFXDisplayLine_FB<GFXDescGeometry>(p[0], p[1], p[2], p[3], color, rop);
+		break;
+	case GFX_BAND_CIRCLE:
+		GFXDisplayCircle_FB<GFXDescGeometry>(p[0], p[1], p[2], color, p[3] != 0);
+		break;
+	case GFX_BAND_ELLIPSE:
+		GFXDisplayEllipse_FB<GFXDescGeometry>(p[0], p[1], p[2], p[3], color, (pEntry->color >> 4) != 0);
+		break;
+	case GFX_BAND_IMAGE:
+		GFXDisplayImage_FB<GFXDescGeometry>(p[0], p[1], (const tImage *)pEntry->ptr, p[2] != 0, rop);
+		break;
+	case GFX_BAND_TEXT:
+	{
+		uint16_t x = p[0], ch;
+		for(uint16_t i = 0; i < pEntry->len; i++, chars += sizeof(ch))
+		{
+			memcpy(&ch, chars, sizeof(ch));
+			x += bfc_DrawChar_RowRowUnpacked(x, p[1], (const BFC_FONT *)pEntry->ptr, ch, color, (COLOR)(pEntry->color >> 4), rop);
+		}
+		break;
+	}
+	}
+}
+
+/**
+ * @brief	Local function to render and send the dirty rows of a banded display.
+ *			A band starts at the next dirty row and holds up to bandLines rows. It is filled white, every display list entry
+ *			crossing it is replayed in the order recorded, and its dirty rows are sent in one update as GFXDisplayFlush() does.
+ * @return	number of lines sent
+ * @note	The display list is replayed once per band: fewer band lines save RAM and cost CPU time.
+ */
+static uint16_t GFXDisplayBandRender(void)
+{
+	const uint16_t H = gfx->pDesc->height, S = GFXDescGeometry::stride();
+	uint8_t *dirtyLines = gfx->dirtyLines;
+	uint16_t sent = 0;
+	uint16_t y = 0;
+	GFX_BAND_ENTRY entry;
+
+	while(y < H)
+	{
+		if(dirtyLines[y >> 3] == 0)	//skip 8 clean lines at once
+		{
+			y = (y | 0x07) + 1;
+			continue;
+		}
+		if((dirtyLines[y >> 3] & (0x01 << (y & 0x07))) == 0)
+		{
+			y++;
+			continue;
+		}
+
+		uint16_t top = y, end = top + 1;
+		for(uint16_t r = top + 1; r < MIN((uint32_t)top + gfx->bandLines, (uint32_t)H); r++)	//render up to the last dirty row of the band
+			if(dirtyLines[r >> 3] & (0x01 << (r & 0x07)))
+				end = r + 1;
+
+		gfx->bandTop = top;
+		gfx->bandEnd = end;
+		GFXRowFill<GFXRowKernel>(gfx->frameBuffer, 0xFF, (uint32_t)(end - top)*S);	//GFX_LINE_HEADERS are written for the band when it is sent
+		for(uint32_t off = 0; off < gfx->bandListLen; off += sizeof(entry) + (uint32_t)entry.len*sizeof(uint16_t))
+		{
+			memcpy(&entry, &gfx->bandList[off], sizeof(entry));
+			if((entry.y2 >= top) && (entry.y1 < end))
+				GFXDisplayBandReplay(&entry, &gfx->bandList[off + sizeof(entry)]);
+		}
+
+		sent += GFXDisplayUpdateDirty<GFXDescGeometry>(top, end);	//one window for the dirty rows of the band
+		y = end;
+	}
+
+	gfx->bandTop = 0;	//kernels called outside a band write nothing
+	gfx->bandEnd = 0;
+	return sent;
+}
+
+/**
+ * @brief	Send every line marked dirty since the last flush to the LCD, each line exactly once.
+ *			All dirty lines are sent in one multiple-lines update however scattered they are, every line with its own gate address.
+ *			GFX_SCS_MAX_US splits the update into shorter SCS windows.
+ * @return	number of lines sent
+ * @note	A banded display renders the dirty lines from its display list, one band after the other.
+ */
+uint16_t GFXDisplayFlush(void)
+{
+	if(gfx->bandLines)
+		return GFXDisplayBandRender();
+
+	return GFX_GEOMETRY_CALL(GFXDisplayUpdateDirty, 0, gfx->pDesc->height);
 }
 
 /**
- * @brief	Display a test pattern of vertical strip with horizontal byte defined
- * @param	pattern in 8-bit to define the byte pattern
- * @param	*pfcn a pointer to function when SCS in high state, mainly for energy measurement.
- * @return	time in millisec to update the display with a vertical strip pattern
- * @note	No frame buffer is involved. This function displays a vertical strip pattern defined by the argument 'pattern' in LSB format.<br>
- *			Example to use<br>
- *				GFXDisplayTestPattern(0xF0, NULL);
+ * @brief	Local function to copy the dirty rows of the selected display into the transfer buffer as one multiple-lines update:
+ *			a 2-byte header and the row for every line, then the dummy bytes. Lines that fit are marked clean.
+ * @param	*buf is the transfer buffer
+ * @param	size is the transfer buffer size in bytes, GFX_SCS_MAX_US limits the lines copied too
+ * @param	*pLen receives the number of bytes to send, 0 when no line has to be sent
+ * @return	number of lines copied
  */
-uint32_t GFXDisplayTestPattern(uint8_t pattern, void (*pfcn)(void))
-{ 	
-	uint32_t timing = 0;
-#if defined (ARDUINO)
-	uint32_t sMillis = millis();
-#else
-	#error Need to define the function to return millisec for other platforms
-#endif
-  hal_spi_start_transaction();
-  hal_delayUs(3); //SCS setup time of tsSCS (refer to datasheet for timing details)
-  
-  for(uint16_t line=1; line<=DISP_VER_RESOLUTION; line++)
-  {
-    #ifdef LS032B7DD02
-    hal_spi_write_byte(uint8_t((line<<6)|0x01));  //update one specified line with M0=H,M2=L & AG0:AG1 concatenate to Bit[1:0] sending with LSB first
-    hal_spi_write_byte((uint8_t)(line>>2));       //AG2~AG9 in LSB first
-    #else
-    hal_spi_write_byte(0x01);                     //update one specified line with M0=H,M2=L sending with LSB first
-    hal_spi_write_byte((uint8_t)line);            //AG0~AG7 in LSB first for gate line address
-    #endif    
-    uint32_t writePeriod = DISP_HOR_RESOLUTION>>3; //divide by 8 for 1-bit bpp
-	
-    while(writePeriod--){
-      hal_spi_write_byte(pattern);
-    }
-	
-	if(line==DISP_VER_RESOLUTION/2)
+template <class G>
+static uint16_t GFXDisplaySnapshot_FB(uint8_t *buf, uint32_t size, uint32_t *pLen)
+{
+	const uint16_t H = G::height(), W = G::bytesPerLine();
+	uint8_t *dirtyLines = gfx->dirtyLines;
+	uint32_t len = 0;
+	uint16_t lines = 0;
+
+	for(uint16_t y = 0; y < H; y++)
 	{
-		if(pfcn!=NULL) {
-			pfcn();//run pfcn() only once sample in the middle, pls make sure sampling time is long enough
-		}	
+		if(dirtyLines[y >> 3] == 0)	//skip 8 clean lines at once
+		{
+			y |= 0x07;
+			continue;
+		}
+		if((dirtyLines[y >> 3] & (0x01 << (y & 0x07))) == 0)
+			continue;
+		if(len + 2 + W + sizeof(dummyBytes) > size)	//the remaining lines stay dirty for the next flush
+			break;
+#if GFX_SCS_MAX_US
+		if(lines && (GFXDisplayWindowUs(len + 2 + W) > GFX_SCS_MAX_US))	//the same for an SCS window of more bus time
+			break;
+#endif
+
+		dirtyLines[y >> 3] &= (uint8_t)~(0x01 << (y & 0x07));
+
+		const uint8_t *row = G::row(y);
+		if(!GFXDisplayLineChanged<G>(y+1, row))
+		{
+			GFX_STATS_ADD(redundantLines, 1);
+			continue;
+		}
+
+		GFXDisplayLineHeader<G>(y+1, &buf[len]);	//Line counts from 1
+		GFXRowCopy<GFXRowKernel>(&buf[len+2], row, W);
+		len += 2 + W;
+		lines++;
 	}
-  }
-  
-  hal_spi_write_byte(0x00); //dummy byte
-  hal_spi_write_byte(0x00); //dummy byte
-  
-  hal_spi_end_transaction();
 
-#if defined (ARDUINO)
-	timing = millis()-sMillis;
-#else
-	#error Need to define the function to return millisec for other platforms
-#endif  
-  
-  return timing;
+	if(lines)
+	{
+		memcpy(&buf[len], dummyBytes, sizeof(dummyBytes));
+		len += sizeof(dummyBytes);
+	}
+	*pLen = len;
+	return lines;
 }
+
+#if GFX_LINE_HEADERS
 /**
- * @brief Function to update one line
- * @note  The minimum payload to write to a Memory LCD is a horizontal line
- * @param line is the line number start from 1 to DISP_VER_RESOLUTION
- * @param *buf is a pointer to data
+ * @brief	Local function to find the dirty lines of the selected display that follow each other in the frame buffer, from the
+ *			first one, for a transfer straight from it. They are marked clean, the lines after them stay dirty for the next flush.
+ * @param	*pLines receives the number of lines
+ * @return	pointer to the header of the first line, the lines take *pLines * stride() bytes from there. NULL for no line to send.
+ * @note	A line GFX_SHADOW finds unchanged is not sent and ends the run, so do a clean line, a row across the edge of the scroll
+ *			region and the SCS window of GFX_SCS_MAX_US.
  */
-static void GFXDisplayUpdateLine(uint16_t line, uint8_t *buf)
+template <class G>
+static const uint8_t* GFXDisplayDirtyRun_FB(uint16_t *pLines)
 {
-  if(line > DISP_VER_RESOLUTION)
-    return;
-  
-  uint32_t writePeriod = DISP_HOR_RESOLUTION>>3; //divide by 8 for 1-bit bpp
-  
-  hal_spi_start_transaction();
-  hal_delayUs(3); //SCS setup time of tsSCS (refer to datasheet for timing details)
-  #ifdef LS032B7DD02
-  hal_spi_write_byte(uint8_t((line<<6)|0x01));  //update one specified line with M0=H,M2=L & AG0:AG1 concatenate to Bit[1:0] sending with LSB first
-  hal_spi_write_byte((uint8_t)(line>>2));       //AG2~AG9 in LSB first
-  #else
-  hal_spi_write_byte(0x01);                     //update one specified line with M0=H,M2=L sending with LSB first
-  hal_spi_write_byte((uint8_t)line);            //AG0~AG7 in LSB first for gate line address
-  #endif
-  
-  while(writePeriod--){
-   hal_spi_write_byte(*buf++);   
-  }
-  hal_spi_write_byte(0x00); //dummy byte
-  hal_spi_write_byte(0x00); //dummy byte
-  hal_delayUs(1); //SCS hold time of thSCS (refer to datasheet for timing details)
-  hal_spi_end_transaction();
+	const uint16_t H = G::height(), W = G::bytesPerLine();
+	uint8_t *dirtyLines = gfx->dirtyLines;
+	const uint8_t *start = NULL, *next = NULL;
+	uint16_t lines = 0;
+
+	GFXDisplayCheckHeaders<G>();
+	for(uint16_t y = 0; y < H; y++)
+	{
+		if((dirtyLines[y >> 3] & (0x01 << (y & 0x07))) == 0)
+		{
+			if(lines)
+				break;
+			if(dirtyLines[y >> 3] == 0)	//skip 8 clean lines at once
+				y |= 0x07;
+			continue;
+		}
+
+		const uint8_t *row = G::row(y);
+		if(lines && (row - GFX_FB_HEADER != next))
+			break;
+#if GFX_SCS_MAX_US
+		if(lines && (GFXDisplayWindowUs((uint32_t)(lines + 1)*(2u + W)) > GFX_SCS_MAX_US))
+			break;
+#endif
+
+		dirtyLines[y >> 3] &= (uint8_t)~(0x01 << (y & 0x07));
+		if(!GFXDisplayLineChanged<G>(y+1, row))
+		{
+			GFX_STATS_ADD(redundantLines, 1);
+			if(lines)
+				break;
+			continue;
+		}
+		if(lines == 0)
+			start = row - GFX_FB_HEADER;
+		next = row + W;
+		lines++;
+	}
+
+	*pLines = lines;
+	return start;
 }
+#endif
 
 /**
- * @brief Function to update multiple lines
- * @param start_line indicates the starting line number ranges 1~DISP_VER_RESOLUTION
- * @param end_line indicates the ending line number ranges 1~DISP_VER_RESOLUTION
- * @param *buf is a pointer to data
+ * @brief	Local function called by the HAL when the transfer started by GFXDisplayFlushAsync() is complete, possibly from an interrupt
  */
-static void GFXDisplayUpdateBlock(uint16_t start_line, uint16_t end_line, uint8_t *buf)
+static void GFXDisplayFlushAsyncDone(void)
 {
-  if((start_line > end_line) || (start_line > DISP_VER_RESOLUTION))
-    return;
+	hal_delayUs(xferHoldUs); //SCS hold time of thSCS (refer to datasheet for timing details)
+	hal_spi_end_transaction();
+#if GFX_LINE_HEADERS
+	if(xferTrailer != NULL)		//the header of the next row again
+	{
+		memcpy(xferTrailer, xferTrailerSaved, sizeof(xferTrailerSaved));
+		xferTrailer = NULL;
+	}
+#endif
 
-  int16_t _end_line = MIN(end_line,DISP_VER_RESOLUTION);	//clip the ending gate line address
-  
-  hal_spi_start_transaction();
-  hal_delayUs(3); //SCS setup time of tsSCS (refer to datasheet for timing details)
-  for(uint16_t line=start_line; line<=_end_line; line++)
-  {
-    #ifdef LS032B7DD02
-    hal_spi_write_byte(uint8_t((line<<6)|0x01));  //update one specified line with M0=H,M2=L & AG0:AG1 concatenate to Bit[1:0] sending with LSB first
-    hal_spi_write_byte((uint8_t)(line>>2));       //AG2~AG9 in LSB first
-    #else
-    hal_spi_write_byte(0x01);                     //update one specified line with M0=H,M2=L sending with LSB first
-    hal_spi_write_byte((uint8_t)line);            //AG0~AG7 in LSB first for gate line address
-    #endif    
-    uint32_t writePeriod = DISP_HOR_RESOLUTION>>3; //divide by 8 for 1-bit bpp
-    while(writePeriod--){
-      hal_spi_write_byte(*buf++);
-    }
-  }
-  hal_spi_write_byte(0x00); //dummy byte
-  hal_spi_write_byte(0x00); //dummy byte
-  hal_delayUs(1); //SCS hold time of thSCS (refer to datasheet for timing details)
-  hal_spi_end_transaction();
+	void (*pfcnDone)(uint16_t) = xferDone;
+	uint16_t lines = xferLines;
+
+	xferDone = NULL;
+	xferBusy = false;	//the transfer buffer is free again
+	if(pfcnDone != NULL)
+		pfcnDone(lines);
 }
 
 /**
- * @brief	Print a character from MCU's Flash with data created by BitFontCreator
- * @param	(x,y) is the top left corner coordinates
- * @param	BFC_FONT* pFont is a pointer to font data from MCU's Flash. Font data created by BitFontCreator (http://www.iseasoft.com)
- * @param	ch in 2-byte width represents the character
- * @param	color is the font color BLACK/WHITE
- * @param	bg is the background color BLACK/WHITE/TRANSPARENT. TRANSPARENT means the background is not changed.
- * @return	width of character printed
- * @note	Example <br>
- *			extern const BFC_FONT fontArial_Rounded_MT_Bold37h;	//font map Arial_Rounded_MT_Bold37.c created by BitFontCreator
- *			//...
- *			GFXDisplayPutChar(50,50,&fontArial_Rounded_MT_Bold37h, 0x0042, BLACK, WHITE);	//print the ASCII character 'B' with black stroke on white background
+ * @brief	Set the transfer buffer of GFXDisplayFlushAsync()
+ * @param	*buf is the buffer, NULL to make GFXDisplayFlushAsync() flush synchronously
+ * @param	size is the buffer size in bytes. GFX_TRANSFER_SIZE(model) holds every line of a model, a smaller buffer sends
+ *			the dirty lines that fit and leaves the others dirty for the next flush.
+ * @note	Waits for a transfer in progress, the buffer belongs to the transport until the transfer is complete.
  */
-uint16_t GFXDisplayPutChar(uint16_t x, uint16_t y, const BFC_FONT* pFont, const uint16_t ch, COLOR color, COLOR bg)
+void GFXDisplaySetTransferBuffer(uint8_t *buf, uint32_t size)
 {
-	return (uint16_t)bfc_DrawChar_RowRowUnpacked(x,y,pFont,ch,color, bg);
+	GFXDisplayFlushWait();
+	xferBuffer = buf;
+	xferSize = (buf != NULL) ? size : 0;
 }
 
 /**
- * @brief	Print string of ASCII code of 1 byte width
- * @param	(x,y) is the top left corner coordinates
- * @param	BFC_FONT* pFont is a pointer to font data from MCU's Flash. Font data created by BitFontCreator (http://www.iseasoft.com)
- * @param	*str is a pointer to character array from Flash space
- * @param	color is the font color BLACK/WHITE
- * @param	bg is the background color BLACK/WHITE/TRANSPARENT. TRANSPARENT means the background is not changed.
- * @return	width of string printed
+ * @brief	Start sending every dirty line of the selected display without waiting for the SPI transfer.
+ *			The dirty rows are copied into the transfer buffer and streamed with hal_spi_write_dma(), so drawing into the
+ *			frame buffer can go on at once. Lines drawn after this call are sent by the next flush.
+ * @param	pfcnDone is called with the number of lines sent when the transfer is complete, possibly from an interrupt. May be NULL.
+ * @return	number of lines in the transfer
+ * @note	A transfer still in progress is waited for first. Every function sending to the LCD does the same, so the SPI bus is
+ *			never shared. Poll with GFXDisplayFlushBusy() or block with GFXDisplayFlushWait().<br>
+ *			Without a transfer buffer (GFXDisplaySetTransferBuffer()) or DMA transport in the HAL, the lines are sent before returning.
+ *			With GFX_SCS_MAX_US the transfer is one SCS window, lines beyond it stay dirty for the next flush.<br>
+ *			With GFX_LINE_HEADERS and no transfer buffer nothing is copied: the dirty lines adjacent in the frame buffer, from the
+ *			first one, are sent straight from it and the others stay dirty for the next flush. Do not draw until the transfer is
+ *			complete then, the rows sent are read as it goes.<br>
+ *			A banded display has no frame buffer to snapshot, it is flushed with GFXDisplayFlush() before returning.<br>
+ *			Example<br>
+ *				static uint8_t xfer[GFX_TRANSFER_SIZE(LS027B7DH01)];<br>
+ *				GFXDisplaySetTransferBuffer(xfer, sizeof(xfer));<br>
+ *				GFXDisplaySetFlushMode(GFX_FLUSH_DEFERRED);<br>
+ *				//... draw<br>
+ *				GFXDisplayFlushAsync(NULL);	//returns at once, draw the next frame while the LCD is updated
  */
-uint16_t GFXDisplayPutString(uint16_t x, uint16_t y, const BFC_FONT* pFont, const char *str, COLOR color, COLOR bg)
+uint16_t GFXDisplayFlushAsync(void (*pfcnDone)(uint16_t lines))
 {
-	uint16_t _x = x;
-	uint16_t _y = y;
-	uint16_t width = 0;
-	char ch = 0;
-	
-	if( pFont == 0 || str == 0 )
-		return 0;
+	GFXDisplayFlushWait();
 
-	while(*str != '\0')
+	if(((xferBuffer == NULL) && !GFX_LINE_HEADERS) || gfx->bandLines)	//a banded display renders band by band, its flush blocks
 	{
-		ch = *str;
-		width = GFXDisplayPutChar(_x, _y, pFont, ch, color, bg);
-		str++;
-		_x += width;
-	}  	
-	
-	return (uint16_t)(_x-x);
-}
-
+		uint16_t lines = GFXDisplayFlush();
+		if(pfcnDone != NULL)
+			pfcnDone(lines);
+		return lines;
+	}
 
+	uint32_t len = 0;
+	uint16_t lines;
+	uint8_t *buf = xferBuffer;
+	GFXDisplayVcomUpdate();		//M1 of the headers copied into the snapshot
+#if GFX_LINE_HEADERS
+	if(buf == NULL)		//the lines go out as they are in the frame buffer, with the next header as dummy bytes
+	{
+		buf = (uint8_t *)GFX_GEOMETRY_CALL(GFXDisplayDirtyRun_FB, &lines);
+		if(lines)
+		{
+			len = (uint32_t)lines * GFXDescGeometry::stride();
+			xferTrailer = buf + len;
+			memcpy(xferTrailerSaved, xferTrailer, sizeof(xferTrailerSaved));
+			memcpy(xferTrailer, dummyBytes, sizeof(dummyBytes));
+			len += sizeof(dummyBytes);
+		}
+	}
+	else
+#endif
+	lines = GFX_GEOMETRY_CALL(GFXDisplaySnapshot_FB, xferBuffer, xferSize, &len);
 
-/**
- * @brief	Print string of ASCII code of 2 bytes width that means Unicode can be printed (Chinese, Japanese, etc)
- * @param	(x,y) is the top left corner coordinates
- * @param	BFC_FONT* pFont is a pointer to font data from MCU's Flash. Font data created by BitFontCreator (http://www.iseasoft.com)
- * @param	*str is a pointer to character array from Flash space
- * @param	color is the font color BLACK/WHITE
- * @param	bg is the background color BLACK/WHITE/TRANSPARENT. TRANSPARENT means the background is not changed.
- * @return	width of string printed
- * @note	Example<br>
- *			const uint16_t hello_japanese[]={0x3053, 0x3093, 0x306B, 0x3061, 0x306F, '\0'};
- *			//....
- *			GFXDisplayPutWString(100,150,&fontSimHei_35h, hello_japanese, BLACK, WHITE);	//SimHei_35h.c created by BitFontCreator
- */
-uint16_t GFXDisplayPutWString(uint16_t x, uint16_t y, const BFC_FONT* pFont, const uint16_t *str, COLOR color, COLOR bg)
-{
-	uint16_t _x = x;
-	uint16_t _y = y;
-	uint16_t width = 0;
-	uint16_t ch = 0;
-	
-	if( pFont == 0 || str == 0 )
+	if(lines == 0)
+	{
+		if(pfcnDone != NULL)
+			pfcnDone(0);
 		return 0;
+	}
 
-	while(*str != '\0')
+	xferBusy = true;
+	xferLines = lines;
+	xferDone = pfcnDone;
+	xferHoldUs = gfx->pDesc->scsHoldUs;
+	GFX_STATS_ADD(transactions, 1);		//counted here, the transfer may complete in an interrupt
+	GFX_STATS_ADD(linesSent, lines);
+	GFX_STATS_ADD(payloadBytes, len - (2u * lines) - sizeof(dummyBytes));
+	GFX_STATS_ADD(headerBytes, 2u * lines);
+	GFX_STATS_ADD(dummyBytes, sizeof(dummyBytes));
+	GFX_STATS_ADD(delayUs, gfx->pDesc->scsSetupUs + gfx->pDesc->scsHoldUs);
+
+	hal_spi_start_transaction();
+	hal_delayUs(gfx->pDesc->scsSetupUs); //SCS setup time of tsSCS (refer to datasheet for timing details)
+	if(!hal_spi_write_dma(buf, len, GFXDisplayFlushAsyncDone))
 	{
-		ch = *str;
-		width = GFXDisplayPutChar(_x, _y, pFont, ch, color, bg);
-		str++;
-		_x += width;
-	}  	
-	
-	return (uint16_t)(_x-x);	
+		for(uint32_t sent = 0; sent < len; sent += 0x8000)	//no DMA transport, send it now
+			hal_spi_write_buffer(&buf[sent], (uint16_t)MIN(len - sent, (uint32_t)0x8000));
+#if GFX_LINE_HEADERS
+		if(xferBuffer == NULL)	//and the lines left, as without a transfer buffer
+		{
+			xferDone = NULL;
+			GFXDisplayFlushAsyncDone();
+			lines += GFXDisplayFlush();
+			if(pfcnDone != NULL)
+				pfcnDone(lines);
+			return lines;
+		}
+#endif
+		GFXDisplayFlushAsyncDone();
+	}
+
+	return lines;
 }
 
 /**
- * @brief	Decode BFC font
+ * @brief	Return true while a transfer started by GFXDisplayFlushAsync() is in progress
  */
-static uint16_t bfc_DrawChar_RowRowUnpacked(uint16_t x0, uint16_t y0, const BFC_FONT *pFont, uint16_t ch, COLOR color, COLOR bg)
+bool GFXDisplayFlushBusy(void)
 {
-  // 1. find the character information first
-  const BFC_CHARINFO *pCharInfo = GetCharInfo(pFont, (unsigned short)ch);
-  
-  if( pCharInfo != 0 )
-  {
-    int height = pFont->FontHeight;
-    //USE_SERIAL.print("Font height = "); USE_SERIAL.println(height);
-    int width = pCharInfo->Width;
-    //USE_SERIAL.print("Font width = "); USE_SERIAL.println(width);
-    const unsigned char *pData = pCharInfo->p.pData8;   // pointer to data array
-
-    int bpp = GetFontBpp(pFont->FontType);              // how many bits per pixel
-    int bytesPerLine = (width * bpp + 7) / 8;           // # bytes in a row
-    int bLittleEndian = (GetFontEndian(pFont->FontType)==1);
+	return xferBusy;
+}
 
-    uint16_t x, y, _x, _y, col;
-    unsigned char data, pixel, bit;
-    
-    // 2. draw all the pixels in this character
-    for(y=0; y<height; y++)
-    {
-      for(x=0; x<width; x++)
-      {
-        col = (x * bpp) / 8;       // byte index in the line
-        data = pData[y * bytesPerLine + col];
+/**
+ * @brief	Wait for the transfer started by GFXDisplayFlushAsync() to complete. Returns at once when there is none.
+ */
+void GFXDisplayFlushWait(void)
+{
+	while(xferBusy)
+		hal_spi_dma_wait();
+}
 
-        // every BYTE (8 bits) data includes 8/bpp pixels,
-        // we need to get each pixel color index (0,1,2,3... based on bpp) from the BYTE data
-        pixel = data;
-        
-        // bit index in the BYTE
-        // For 1-bpp: bit =  x % 8 (Big Endian),   7 -  x % 8 (Little Endian)
-        // For 2-bpp: bit = 2x % 8 (Big Endian),   6 - 2x % 8 (Little Endian)
-        // For 4-bpp: bit = 4x % 8 (Big Endian),   4 - 4x % 8 (Little Endian)
-        bit = bLittleEndian ? (8-bpp)-(x*bpp)%8 : (x*bpp)%8;
+/**
+ * @brief	Read the flush statistics
+ * @param	*pStats receives the counters accumulated since the last GFXDisplayResetStats(), all zero when GFX_STATS is 0
+ * @note	Example to find the cost of a screen<br>
+ *				GFXDisplayResetStats();<br>
+ *				drawSettingsScreen();<br>
+ *				GFXDisplayGetStats(&stats);	//stats.linesSent, stats.redundantLines, ...
+ */
+void GFXDisplayGetStats(GFX_DISPLAY_STATS *pStats)
+{
+#if GFX_STATS
+	*pStats = gfxStats;
+#else
+	memset(pStats, 0, sizeof(GFX_DISPLAY_STATS));
+#endif
+}
 
-        pixel = pixel<<bit;               // clear left pixels
-        pixel = pixel>>(8/bpp-1)*bpp;     // clear right pixels
-        
-        _x = x0+x, 
-        _y = y0+y;
-          
-        if(pixel) 
-        {
-		  GFXDisplayPutPixel_FB(_x, _y, color);	//update frame buffer, no update on screen yet.
-        }
-		else
-		{
-			if(bg!=TRANSPARENT)
-				GFXDisplayPutPixel_FB(_x, _y, bg);
-		}
-      }
-    } 
-	//update framebuffer for the block area
-	GFXDisplayUpdateBlock(y0+1, y0+height, (uint8_t *)&frameBuffer[y0]);
-	
-    return (uint16_t)width;
-  }
-  return 0;
-} 
+/**
+ * @brief	Set all flush statistics to zero
+ */
+void GFXDisplayResetStats(void)
+{
+#if GFX_STATS
+	memset(&gfxStats, 0, sizeof(gfxStats));
+#endif
+}
 
 /**
  * @brief	Get physical width of the Memory LCD
@@ -607,7 +4025,7 @@ static uint16_t bfc_DrawChar_RowRowUnpacked(uint16_t x0, uint16_t y0, const BFC_
  */
 uint16_t GFXDisplayGetLCDWidth(void)
 {
-	return DISP_HOR_RESOLUTION;
+	return gfx->pDesc->width;
 }
 
 /**
@@ -616,7 +4034,7 @@ uint16_t GFXDisplayGetLCDWidth(void)
  */
 uint16_t GFXDisplayGetLCDHeight(void)
 {
-	return DISP_VER_RESOLUTION;
+	return gfx->pDesc->height;
 }
 
 /**
@@ -694,6 +4112,7 @@ uint16_t GFXDisplayGetWStringWidth(const BFC_FONT *pFont, const uint16_t *str)
 }
 
 
+#if defined (ARDUINO)
 /**
  * @brief Hardware Abstraction Layer (HAL) write to an IO pin
  * @param pin is the pin number to write
@@ -722,10 +4141,18 @@ void    hal_delayUs(uint32_t us)
   delayMicroseconds(us);
 }
 
+/**
+ * @brief Hardware Abstraction Layer (HAL) to return the number of millisec since startup
+ */
+uint32_t hal_millis(void)
+{
+  return millis();
+}
+
 /**
  * @brief Hardware Abstraction Layer (HAL) to start SPI transaction
  */
-inline void hal_spi_start_transaction(void)
+void hal_spi_start_transaction(void)
 {
   _SPI->beginTransaction(spiSettings);
   digitalWrite(GFX_DISPLAY_SCS, HIGH);  
@@ -734,7 +4161,7 @@ inline void hal_spi_start_transaction(void)
 /**
  * @brief Hardware Abstraction Layer (HAL) to stop SPI transaction
  */
-inline void hal_spi_end_transaction(void)
+void hal_spi_end_transaction(void)
 {
   digitalWrite(GFX_DISPLAY_SCS, LOW);
   _SPI->endTransaction();  
@@ -748,6 +4175,55 @@ void hal_spi_write_byte(uint8_t val)
 	_SPI->transfer(val);
 }
 
+/**
+ * @brief Hardware Abstraction Layer (HAL) to send a buffer via SPI in LSB first. Data received is discarded.
+ * @param *buf is a pointer to data, it is not modified
+ * @param len is the number of bytes to send
+ * @note  ESP32 fills the SPI FIFO with SPIClass::writeBytes().<br>
+ *        Arduino M0 PRO writes SERCOM1 DATA as soon as the transmit buffer is empty instead of waiting for each received byte.
+ */
+void hal_spi_write_buffer(const uint8_t *buf, uint16_t len)
+{
+#if defined (ESP32)
+	_SPI->writeBytes(buf, len);
+#elif defined (_VARIANT_ARDUINO_ZERO_)
+	while(len--)
+	{
+		while(SERCOM1->SPI.INTFLAG.bit.DRE == 0);	//wait for data register empty
+		SERCOM1->SPI.DATA.reg = *buf++;
+	}
+	while(SERCOM1->SPI.INTFLAG.bit.TXC == 0);		//wait until the last byte is shifted out before SCS goes low
+	while(SERCOM1->SPI.INTFLAG.bit.RXC)			//discard data received in the meantime
+		(void)SERCOM1->SPI.DATA.reg;
+	SERCOM1->SPI.STATUS.bit.BUFOVF = 1;			//clear receive overflow
+#else
+	while(len--)
+		_SPI->transfer(*buf++);
+#endif
+}
+
+/**
+ * @brief Hardware Abstraction Layer (HAL) to start sending a buffer via SPI with DMA and return before the transfer is complete
+ * @param *buf is a pointer to data, it must not be modified until pfcnDone() is called
+ * @param len is the number of bytes to send
+ * @param pfcnDone is called once the last byte is shifted out, from the DMA interrupt or from hal_spi_dma_wait()
+ * @return false when the platform has no DMA transport, the caller sends the buffer with hal_spi_write_buffer() instead
+ * @note  The SPI library of the ESP32 and Arduino M0 PRO cores has no asynchronous transfer, a port with a DMA driver
+ *        (e.g. ESP-IDF spi_device_queue_trans() or Adafruit_ZeroDMA) implements this function and hal_spi_dma_wait().
+ */
+bool hal_spi_write_dma(const uint8_t *buf, uint32_t len, void (*pfcnDone)(void))
+{
+	(void)buf; (void)len; (void)pfcnDone;
+	return false;
+}
+
+/**
+ * @brief Hardware Abstraction Layer (HAL) to block until the transfer started by hal_spi_write_dma() has called its pfcnDone()
+ */
+void hal_spi_dma_wait(void)
+{
+}
+
 
 /**
  * @brief Hardware Abstraction Layer (HAL) to initialize hardware components including GPIO, SPI setup etc.
@@ -835,7 +4311,6 @@ void    hal_extcom_stop(void)
 #if defined (_VARIANT_ARDUINO_ZERO_)
     REG_TC4_INTFLAG |= TC_INTFLAG_OVF;              // Clear the interrupt flags
     REG_TC4_INTENCLR = TC_INTENCLR_OVF;
-    hal_gpio_write(GFX_DISPLAY_EXTCOMIN, LOW);
 #elif defined (ESP32)
 	if(timer)
 	{
@@ -843,6 +4318,8 @@ void    hal_extcom_stop(void)
 		timer = NULL;
 	}
 #endif
+	extcomLevel = false;
+	hal_gpio_write(GFX_DISPLAY_EXTCOMIN, LOW);
 }
 
 #if defined (_VARIANT_ARDUINO_ZERO_)
@@ -874,9 +4351,7 @@ void IRAM_ATTR hal_extcom_toggle(void)
 void hal_extcom_toggle(void)
 #endif
 {
-	if(digitalRead(GFX_DISPLAY_EXTCOMIN)==HIGH)
-		hal_gpio_write(GFX_DISPLAY_EXTCOMIN, LOW);
-	else
-		hal_gpio_write(GFX_DISPLAY_EXTCOMIN, HIGH);
+	extcomLevel = !extcomLevel;
+	hal_gpio_write(GFX_DISPLAY_EXTCOMIN, extcomLevel ? HIGH : LOW);
 }
-
+#endif  //#if defined (ARDUINO)
@@ -30,7 +30,10 @@
  * 			LS011B7DH03 = 1.08" Memory LCD with 160*68, 3V input voltage<br>
  * 			LS013B7DH03 = 1.28" Memory LCD with 128*128 pixels, 3V input voltage<br>
  * 			LS018B7DH02 = 1.80" Memory LCD with 230*303 pixels, 5V input voltage<br>
+ *		  A model defined on the compiler command line (e.g. -DLS032B7DD02 for a host build) overrides the selection below
  */
+#if !defined (LS027B7DH01) && !defined (LS032B7DD02) && !defined (LS044Q7DH01) && !defined (LS006B7DH03) && \
+	!defined (LS011B7DH03) && !defined (LS013B7DH03) && !defined (LS018B7DH02)
 #define   LS027B7DH01
 //#define	LS032B7DD02
 //#define 	LS044Q7DH01
@@ -38,6 +41,7 @@
 //#define 	LS011B7DH03
 //#define	LS013B7DH03
 //#define 	LS018B7DH02
+#endif
 
 //@note pin number definition, hardware dependent
 #if defined (ARDUINO)
@@ -59,6 +63,16 @@
 	#define GFX_5V0_EN            2
 	#define USE_SERIAL            Serial
 #endif
+#else
+	//Host build without Arduino core : pin numbers are labels passed to the HAL only
+	#define GFX_DISPLAY_SCS       10
+	#define GFX_DISPLAY_EXTCOMIN  9
+	#define GFX_DISPLAY_DISP      8
+	#define GFX_5V0_EN            3
+	#ifndef HIGH
+	#define HIGH                  1
+	#define LOW                   0
+	#endif
 #endif
 
 #ifdef __cplusplus
@@ -70,39 +84,195 @@ extern "C" {
 #define MAX(A,B)    ({ __typeof__(A) __a = (A); __typeof__(B) __b = (B); __a < __b ? __b : __a; })
 #endif
 
+//@note Resolution of every model, a GFX_DISPLAY_DESC is defined for each of them
+#define LS027B7DH01_HOR_RESOLUTION	400
+#define LS027B7DH01_VER_RESOLUTION	240
+#define LS032B7DD02_HOR_RESOLUTION	336
+#define LS032B7DD02_VER_RESOLUTION	536
+#define LS044Q7DH01_HOR_RESOLUTION	320
+#define LS044Q7DH01_VER_RESOLUTION	240
+#define LS006B7DH03_HOR_RESOLUTION	64
+#define LS006B7DH03_VER_RESOLUTION	64
+#define LS011B7DH03_HOR_RESOLUTION	160
+#define LS011B7DH03_VER_RESOLUTION	68
+#define LS013B7DH03_HOR_RESOLUTION	128
+#define LS013B7DH03_VER_RESOLUTION	128
+#define LS018B7DH02_HOR_RESOLUTION	240 //pixel-wise it is 230x303, in memory it is actually 240*303
+#define LS018B7DH02_VER_RESOLUTION	303
+
 #ifdef LS027B7DH01
-	#define DISP_HOR_RESOLUTION	400
-	#define DISP_VER_RESOLUTION	240
+	#define DISP_HOR_RESOLUTION	LS027B7DH01_HOR_RESOLUTION
+	#define DISP_VER_RESOLUTION	LS027B7DH01_VER_RESOLUTION
+	#define GFX_DISPLAY_DESC_DEFAULT	gfxDescLS027B7DH01
 #elif defined LS032B7DD02
-	#define DISP_HOR_RESOLUTION	336
-	#define DISP_VER_RESOLUTION	536
+	#define DISP_HOR_RESOLUTION	LS032B7DD02_HOR_RESOLUTION
+	#define DISP_VER_RESOLUTION	LS032B7DD02_VER_RESOLUTION
+	#define GFX_DISPLAY_DESC_DEFAULT	gfxDescLS032B7DD02
 #elif defined LS044Q7DH01
-	#define DISP_HOR_RESOLUTION	320
-	#define DISP_VER_RESOLUTION	240
+	#define DISP_HOR_RESOLUTION	LS044Q7DH01_HOR_RESOLUTION
+	#define DISP_VER_RESOLUTION	LS044Q7DH01_VER_RESOLUTION
+	#define GFX_DISPLAY_DESC_DEFAULT	gfxDescLS044Q7DH01
 #elif defined LS006B7DH03
-	#define DISP_HOR_RESOLUTION	64
-	#define DISP_VER_RESOLUTION	64
+	#define DISP_HOR_RESOLUTION	LS006B7DH03_HOR_RESOLUTION
+	#define DISP_VER_RESOLUTION	LS006B7DH03_VER_RESOLUTION
+	#define GFX_DISPLAY_DESC_DEFAULT	gfxDescLS006B7DH03
 #elif defined LS011B7DH03
-	#define DISP_HOR_RESOLUTION	160
-	#define DISP_VER_RESOLUTION	68
+	#define DISP_HOR_RESOLUTION	LS011B7DH03_HOR_RESOLUTION
+	#define DISP_VER_RESOLUTION	LS011B7DH03_VER_RESOLUTION
+	#define GFX_DISPLAY_DESC_DEFAULT	gfxDescLS011B7DH03
 #elif defined LS013B7DH03
-	#define DISP_HOR_RESOLUTION	128
-	#define DISP_VER_RESOLUTION	128
+	#define DISP_HOR_RESOLUTION	LS013B7DH03_HOR_RESOLUTION
+	#define DISP_VER_RESOLUTION	LS013B7DH03_VER_RESOLUTION
+	#define GFX_DISPLAY_DESC_DEFAULT	gfxDescLS013B7DH03
 #elif defined LS018B7DH02
-	#define DISP_HOR_RESOLUTION	240 //pixel-wise it is 230x303, in memory it is actually 240*303
-	#define DISP_VER_RESOLUTION	303
+	#define DISP_HOR_RESOLUTION	LS018B7DH02_HOR_RESOLUTION
+	#define DISP_VER_RESOLUTION	LS018B7DH02_VER_RESOLUTION
+	#define GFX_DISPLAY_DESC_DEFAULT	gfxDescLS018B7DH02
 #else
 	#error You need to define the horizontal and vertical resolution for a new model
 #endif
 
+//@note Gate address width of the default model, LS032B7DD02 and LS018B7DH02 (303 lines) have 10-bit addresses
+#if defined (LS032B7DD02) || defined (LS018B7DH02)
+	#define GFX_ADDRESS_BITS	10
+#else
+	#define GFX_ADDRESS_BITS	8
+#endif
+
 //@note Horizontal screen size in byte count
 #define GFX_FB_CANVAS_W	((DISP_HOR_RESOLUTION + 7) / 8)
 //@note Vertical screen size in line number
 #define GFX_FB_CANVAS_H	DISP_VER_RESOLUTION
+/**
+ * @note  Banded rendering of the default display, for MCUs without RAM for a frame buffer of the whole screen.<br>
+ *        	0 = frameBuffer holds every line of the LCD (default)<br>
+ *        	N = frameBuffer holds N lines. Drawing functions record into a display list of GFX_BAND_LIST_SIZE bytes, and
+ *        	    GFXDisplayFlush() replays it into N lines at a time, each band sent as one multiple-lines update.
+ *        	    More lines cost more RAM and fewer replays of the list, e.g. 16 lines of LS027B7DH01 take 800 bytes instead of 12 KB.
+ */
+#ifndef GFX_BAND_LINES
+#define GFX_BAND_LINES	0
+#endif
+//@note Display list size in bytes of the default display in banded mode, about 24 bytes per drawing call plus 2 per character
+#ifndef GFX_BAND_LIST_SIZE
+#define GFX_BAND_LIST_SIZE	2048
+#endif
+//@note Lines held in frameBuffer
+#if GFX_BAND_LINES
+	#define GFX_FB_ROWS	((GFX_BAND_LINES) < GFX_FB_CANVAS_H ? (GFX_BAND_LINES) : GFX_FB_CANVAS_H)
+#else
+	#define GFX_FB_ROWS	GFX_FB_CANVAS_H
+#endif
 //@note EXTCOMIN pulse frequency in hal_extcom_start(hz) fcn. -> GFXDisplayOn()
 #define EXTCOMIN_FREQ 1 
 
-extern uint8_t frameBuffer[GFX_FB_CANVAS_H][GFX_FB_CANVAS_W];
+/**
+ * @note  VCOM inversion source, must match the EXTMODE pin of the LCD.<br>
+ *        	GFX_VCOM_EXTCOMIN = EXTMODE high, a timer interrupt pulses EXTCOMIN at EXTCOMIN_FREQ (default)<br>
+ *        	GFX_VCOM_SERIAL   = EXTMODE low, VCOM is the M1 bit of every command. No timer is used; call GFXDisplayVcomService()
+ *        	at least every GFX_VCOM_PERIOD_MS so a 2-byte display mode command inverts VCOM when no update has been sent.
+ */
+#define GFX_VCOM_EXTCOMIN	0
+#define GFX_VCOM_SERIAL		1
+#ifndef GFX_VCOM
+#define GFX_VCOM	GFX_VCOM_EXTCOMIN
+#endif
+//@note VCOM polarity period of GFX_VCOM_SERIAL in ms, the same inversion rate as the EXTCOMIN timer
+#ifndef GFX_VCOM_PERIOD_MS
+#define GFX_VCOM_PERIOD_MS	(500 / EXTCOMIN_FREQ)
+#endif
+
+/**
+ * @note  Shadow of the lines last sent to the LCD. With a shadow, lines whose content has not changed are not sent again.<br>
+ *        	GFX_SHADOW_NONE = no shadow, every line requested is sent (default)<br>
+ *        	GFX_SHADOW_COPY = full copy of the frame buffer, GFX_FB_CANVAS_W*GFX_FB_CANVAS_H bytes of RAM<br>
+ *        	GFX_SHADOW_HASH = 32-bit hash per line, 4*GFX_FB_CANVAS_H bytes of RAM for RAM-constrained MCUs
+ */
+#define GFX_SHADOW_NONE	0
+#define GFX_SHADOW_COPY	1
+#define GFX_SHADOW_HASH	2
+#ifndef GFX_SHADOW
+#define GFX_SHADOW	GFX_SHADOW_NONE
+#endif
+
+//@note SPI clock of the LCD, set by the Arduino HAL and used to estimate the bus time of an update
+#ifndef GFX_SPI_CLOCK_HZ
+#define GFX_SPI_CLOCK_HZ	2000000UL
+#endif
+
+/**
+ * @note  Longest SCS window of an update in us of bus time, 0 for no limit (default).<br>
+ *        Every line of a multiple-lines update carries its own gate address, so GFXDisplayFlush() sends all dirty lines in one
+ *        window whatever the gaps between them. A window costs tsSCS + thSCS and 2 dummy bytes, a line 2 + bytesPerLine bytes
+ *        wherever it is: splitting never saves bus time, it only lets other devices on a shared SPI bus in sooner.
+ *        With a limit, a window is closed before the line that would make it last longer, e.g. 5000 for a sensor polled every 5 ms.
+ */
+#ifndef GFX_SCS_MAX_US
+#define GFX_SCS_MAX_US	0
+#endif
+
+/**
+ * @note  Scroll region of GFXDisplaySetScrollRegion().<br>
+ *        	1 = the rows of the region are a ring in the frame buffer, GFXDisplayScroll() moves its start row instead of the
+ *        	    rows and drawing functions find each row through it, one compare per row (default)<br>
+ *        	0 = frame buffer rows at fixed addresses, GFXDisplayScroll() copies the rows of the region
+ */
+#ifndef GFX_SCROLL
+#define GFX_SCROLL	1
+#endif
+
+/**
+ * @note  Frame buffer layout.<br>
+ *        	0 = rows of bytesPerLine bytes, every line sent writes its 2-byte command header and its row separately (default)<br>
+ *        	1 = rows of 2 + bytesPerLine bytes, the command header of each line (mode, M1 and gate address) kept in front of its
+ *        	    row and rewritten only when VCOM, a band or the scroll region moves it. Adjacent lines are one contiguous
+ *        	    buffer: an update writes them with one SPI write, and GFXDisplayFlushAsync() without a transfer buffer streams
+ *        	    them by DMA straight from the frame buffer. 2 bytes of RAM per line and 2 at the end.
+ */
+#ifndef GFX_LINE_HEADERS
+#define GFX_LINE_HEADERS	0
+#endif
+//@note Bytes in front of every frame buffer row, the command header of GFX_LINE_HEADERS
+#define GFX_FB_HEADER	(GFX_LINE_HEADERS ? 2 : 0)
+//@note Frame buffer size in bytes for rows lines of width pixels, the buffer of GFXDisplayInit() and GFXDisplayInitBanded()
+#define GFX_FB_SIZE(width, rows)	(((((width) + 7) / 8) + GFX_FB_HEADER) * (uint32_t)(rows) + GFX_FB_HEADER)
+
+/**
+ * @note  Flush statistics read with GFXDisplayGetStats(), 1 = counters kept by every function sending to the LCD.<br>
+ *        With 0 (default) the counting compiles to nothing and GFXDisplayGetStats() reports zeros.
+ */
+#ifndef GFX_STATS
+#define GFX_STATS	0
+#endif
+
+/**
+ * @note  Frame buffer row kernels (GFXRowKernels.h) behind every fill, copy and compare of frame buffer rows.<br>
+ *        	GFX_ROW_KERNEL_BYTE = one byte at a time<br>
+ *        	GFX_ROW_KERNEL_WORD = 32-bit words (default on MCUs)<br>
+ *        	GFX_ROW_KERNEL_SIMD = SSE2/AVX2/NEON vectors, default of host builds whose compiler has one of them
+ */
+#define GFX_ROW_KERNEL_BYTE	0
+#define GFX_ROW_KERNEL_WORD	1
+#define GFX_ROW_KERNEL_SIMD	2
+#ifndef GFX_ROW_KERNEL
+	#if !defined (ARDUINO) && (defined (__SSE2__) || defined (__ARM_NEON) || defined (__ARM_NEON__))
+	#define GFX_ROW_KERNEL	GFX_ROW_KERNEL_SIMD
+	#else
+	#define GFX_ROW_KERNEL	GFX_ROW_KERNEL_WORD
+	#endif
+#endif
+
+//@note Damaged rectangles collected by GFXWidgetRender() on the stack, more damage is merged into the closest rectangle
+#ifndef GFX_WIDGET_DAMAGE_RECTS
+#define GFX_WIDGET_DAMAGE_RECTS	8
+#endif
+
+//@note Frame buffer of the default display, the model selected above. GFX_BAND_LINES lines in banded mode.
+#if GFX_LINE_HEADERS
+extern uint8_t frameBuffer[GFX_FB_SIZE(DISP_HOR_RESOLUTION, GFX_FB_ROWS)];
+#else
+extern uint8_t frameBuffer[GFX_FB_ROWS][GFX_FB_CANVAS_W];
+#endif
 
 typedef enum
 {
@@ -111,16 +281,271 @@ typedef enum
 	TRANSPARENT	//means leaving original color
 } COLOR;
 
+/**
+ * @note	Flush mode selected by GFXDisplaySetFlushMode()<br>
+ *			GFX_FLUSH_IMMEDIATE : every drawing function refreshes its lines on the LCD before it returns (default)<br>
+ *			GFX_FLUSH_DEFERRED  : drawing functions only mark their lines dirty, GFXDisplayFlush() sends each dirty line once
+ *			(default of banded displays)
+ */
+typedef enum
+{
+	GFX_FLUSH_IMMEDIATE = 0,
+	GFX_FLUSH_DEFERRED
+} GFX_FLUSH_MODE;
+
+/**
+ * @note	Raster op selected by GFXDisplaySetRasterOp(), how rectangles, lines, pixels, images and text are merged into the
+ *			frame buffer. The source is what GFX_ROP_SET draws (bit set for WHITE) and only the pixels a call covers change:
+ *			the whole box of an image, the strokes of text and its cells too unless bg is TRANSPARENT.<br>
+ *			GFX_ROP_SET   : source pixels replace the frame buffer (default)<br>
+ *			GFX_ROP_CLEAR : covered pixels turn WHITE, as GFXDisplayAllClear() leaves them<br>
+ *			GFX_ROP_XOR   : WHITE source pixels invert the frame buffer, BLACK ones keep it<br>
+ *			GFX_ROP_OR    : WHITE source pixels are drawn, BLACK ones keep the frame buffer<br>
+ *			GFX_ROP_AND   : BLACK source pixels are drawn, WHITE ones keep the frame buffer<br>
+ *			GFX_ROP_NOT   : covered pixels are inverted whatever the source, e.g. a menu row highlighted with GFXDisplayDrawRect()
+ */
+typedef enum
+{
+	GFX_ROP_SET = 0,
+	GFX_ROP_CLEAR,
+	GFX_ROP_XOR,
+	GFX_ROP_OR,
+	GFX_ROP_AND,
+	GFX_ROP_NOT
+} GFX_ROP;
+
+/**
+ * @note	Descriptor of a Memory LCD model. There is one for every model listed above, so one binary can drive any of them
+ *			by selecting a GFX_DISPLAY at run time with GFXDisplaySelect().
+ */
+typedef struct
+{
+	const char	*name;
+	uint16_t	width;			//pixels per line
+	uint16_t	height;			//number of gate lines
+	uint16_t	bytesPerLine;	//frame buffer row size, (width+7)/8
+	uint8_t		addressBits;	//gate address width, 8 or 10
+	uint8_t		scsSetupUs;		//tsSCS, SCS high to the first SCLK
+	uint8_t		scsHoldUs;		//thSCS, the last SCLK to SCS low
+} GFX_DISPLAY_DESC;
+
+extern const GFX_DISPLAY_DESC gfxDescLS027B7DH01;
+extern const GFX_DISPLAY_DESC gfxDescLS032B7DD02;
+extern const GFX_DISPLAY_DESC gfxDescLS044Q7DH01;
+extern const GFX_DISPLAY_DESC gfxDescLS006B7DH03;
+extern const GFX_DISPLAY_DESC gfxDescLS011B7DH03;
+extern const GFX_DISPLAY_DESC gfxDescLS013B7DH03;
+extern const GFX_DISPLAY_DESC gfxDescLS018B7DH02;
+
+/**
+ * @note	A Memory LCD instance with its descriptor, frame buffer, dirty line bitmap and shadow.<br>
+ *			The default display (model selected above, frameBuffer) is used until GFXDisplaySelect() picks another one.
+ *			Declare an instance with GFX_DISPLAY_DEFINE(), or call GFXDisplayInit() with buffers sized at run time.<br>
+ *			A banded display (GFX_DISPLAY_DEFINE_BANDED(), GFXDisplayInitBanded()) has a frame buffer of bandLines rows and
+ *			a display list instead, the band fields stay 0 otherwise.
+ */
+typedef struct
+{
+	const GFX_DISPLAY_DESC *pDesc;
+	uint8_t		*frameBuffer;	//pDesc->height rows of pDesc->bytesPerLine bytes, bandLines rows for a banded display, see GFX_FB_SIZE()
+	uint8_t		*dirtyLines;	//one bit per row, (pDesc->height+7)/8 bytes
+	void		*shadow;		//GFX_SHADOW_COPY: the frame buffer size, GFX_SHADOW_HASH: 4 bytes per row, 0 for no shadow
+	GFX_FLUSH_MODE flushMode;
+	GFX_ROP		rop;			//raster op of the drawing functions
+	bool		shadowValid;
+	uint16_t	bandLines;		//rows of frameBuffer in banded mode, 0 when it holds the whole screen
+	uint16_t	bandTop;		//rows bandTop~bandEnd-1 are in frameBuffer while a band is rendered
+	uint16_t	bandEnd;
+	uint8_t		*bandList;		//display list of banded mode
+	uint16_t	bandListSize;	//bytes
+	uint16_t	bandListLen;	//bytes recorded
+	uint16_t	bandDropped;	//drawing calls that did not fit into the display list since GFXDisplayAllClear()
+	uint16_t	scrollTop;		//rows scrollTop~scrollTop+scrollRows-1 are the scroll region, scrollRows 0 for none
+	uint16_t	scrollRows;
+	uint16_t	scrollStart;	//GFX_SCROLL: row scrollTop is frame buffer row scrollTop+scrollStart, the region wraps around
+} GFX_DISPLAY;
+
+#if (GFX_SHADOW == GFX_SHADOW_COPY)
+	#define GFX_SHADOW_STORAGE(name, w, h)	static uint8_t name[(((w) + 7) / 8) * (h)];
+	#define GFX_SHADOW_ADDR(name)			name
+#elif (GFX_SHADOW == GFX_SHADOW_HASH)
+	#define GFX_SHADOW_STORAGE(name, w, h)	static uint32_t name[(h)];
+	#define GFX_SHADOW_ADDR(name)			name
+#else
+	#define GFX_SHADOW_STORAGE(name, w, h)
+	#define GFX_SHADOW_ADDR(name)			0
+#endif
+
+/**
+ * @note	Define a display instance of a model with static buffers, e.g.<br>
+ *			GFX_DISPLAY_DEFINE(lcdLarge, LS032B7DD02);<br>
+ *			GFX_DISPLAY_DEFINE(lcdSmall, LS013B7DH03);<br>
+ *			//...<br>
+ *			GFXDisplaySelect(digitalRead(SKU_PIN) ? &lcdLarge : &lcdSmall);
+ */
+#define GFX_DISPLAY_DEFINE(name, model) \
+	static uint8_t name##FrameBuffer[GFX_FB_SIZE(model##_HOR_RESOLUTION, model##_VER_RESOLUTION)]; \
+	static uint8_t name##DirtyLines[(model##_VER_RESOLUTION + 7) / 8]; \
+	GFX_SHADOW_STORAGE(name##Shadow, model##_HOR_RESOLUTION, model##_VER_RESOLUTION) \
+	GFX_DISPLAY name = { &gfxDesc##model, name##FrameBuffer, name##DirtyLines, GFX_SHADOW_ADDR(name##Shadow), GFX_FLUSH_IMMEDIATE, GFX_ROP_SET, false, \
+						 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
+
+/**
+ * @note	Define a banded display instance with a frame buffer of lines rows and a display list of listSize bytes, in
+ *			GFX_FLUSH_DEFERRED mode as set by GFXDisplayInitBanded(), e.g.<br>
+ *			GFX_DISPLAY_DEFINE_BANDED(lcd, LS032B7DD02, 16, 2048);	//about 2.8 KB of RAM instead of 22.5 KB
+ */
+#define GFX_DISPLAY_DEFINE_BANDED(name, model, lines, listSize) \
+	static uint8_t name##FrameBuffer[GFX_FB_SIZE(model##_HOR_RESOLUTION, (lines))]; \
+	static uint8_t name##DirtyLines[(model##_VER_RESOLUTION + 7) / 8]; \
+	static uint8_t name##BandList[(listSize)]; \
+	GFX_SHADOW_STORAGE(name##Shadow, model##_HOR_RESOLUTION, model##_VER_RESOLUTION) \
+	GFX_DISPLAY name = { &gfxDesc##model, name##FrameBuffer, name##DirtyLines, GFX_SHADOW_ADDR(name##Shadow), GFX_FLUSH_DEFERRED, GFX_ROP_SET, false, \
+						 (lines), 0, 0, name##BandList, (listSize), 0, 0, 0, 0, 0 }
+
+/**
+ * @note	Counters of the SPI traffic to the LCD since GFXDisplayResetStats(), for all displays. Kept when GFX_STATS is 1.<br>
+ *			Bus time is about (payloadBytes+headerBytes+dummyBytes)*8/SPI clock + delayUs.
+ */
+typedef struct
+{
+	uint32_t	transactions;		//SCS high windows
+	uint32_t	linesSent;			//lines written with a data update
+	uint32_t	payloadBytes;		//frame buffer row bytes
+	uint32_t	headerBytes;		//mode and gate address bytes
+	uint32_t	dummyBytes;			//trailing dummy bytes
+	uint32_t	delayUs;			//SCS setup and hold delays
+	uint32_t	redundantLines;		//lines requested while the LCD showed the same content already, found by GFX_SHADOW and not sent
+} GFX_DISPLAY_STATS;
+
+/**
+ * @note	Strip chart modes<br>
+ *			GFX_CHART_SWEEP  : new samples are drawn left to right over the old trace, a gap of blank columns runs ahead of the newest
+ *			                   sample and the trace wraps around at the right edge (ECG monitor style)<br>
+ *			GFX_CHART_SCROLL : the newest sample is at the right edge, older samples move to the left
+ */
+typedef enum
+{
+	GFX_CHART_SWEEP = 0,
+	GFX_CHART_SCROLL
+} GFX_CHART_MODE;
+
+/**
+ * @note	Strip chart bound to a rectangle of the selected display, set up with GFXDisplayChartInit() and fed with
+ *			GFXDisplayChartAddSamples(). step, gap, color and bg may be changed after GFXDisplayChartInit().
+ */
+typedef struct
+{
+	uint16_t	left, top, width, height;	//chart rectangle in pixels
+	int16_t		minValue, maxValue;			//sample values drawn on the bottom and top row
+	GFX_CHART_MODE mode;
+	uint8_t		step;						//pixels between two samples, 1 or more
+	uint8_t		gap;						//GFX_CHART_SWEEP: blank columns ahead of the newest sample
+	COLOR		color;						//trace color
+	COLOR		bg;							//background, TRANSPARENT to draw over the rectangle without erasing (sweep only)
+	uint16_t	*history;					//GFX_CHART_SCROLL: rows of the last GFX_CHART_HISTORY_SIZE samples, ring buffer
+	uint16_t	count;						//samples in history (scroll) or since the trace started at the left edge (sweep)
+	uint16_t	head;						//GFX_CHART_SCROLL: ring buffer index of the oldest sample
+	int32_t		lastY;						//row of the newest sample, -1 before the first one
+} GFX_CHART;
+
+//@note Entries of the history buffer of a GFX_CHART_SCROLL chart, one sample every step pixels across width with the oldest one on the left edge
+#define GFX_CHART_HISTORY_SIZE(width, step)	(((width) - 1) / (step) + 1)
+
+/**
+ * @note	Node types of the widget tree drawn by GFXWidgetRender()
+ */
+typedef enum
+{
+	GFX_WIDGET_GROUP = 0,		//holds child nodes, paints its rectangle with bg unless TRANSPARENT
+	GFX_WIDGET_RECT,			//filled rectangle
+	GFX_WIDGET_LABEL,			//string in a BFC font
+	GFX_WIDGET_IMAGE,			//tImage
+	GFX_WIDGET_NUMBER			//integer right aligned in a field of digit cells
+} GFX_WIDGET_TYPE;
+
+//@note GFX_WIDGET.flags
+#define GFX_WIDGET_VISIBLE	0x01	//shown if every parent is shown too
+#define GFX_WIDGET_DIRTY	0x02	//changed since the last GFXWidgetRender()
+#define GFX_WIDGET_DRAWN	0x04	//on the LCD at drawn* since the last GFXWidgetRender()
+#define GFX_WIDGET_REDRAW	0x08	//painted by the running GFXWidgetRender()
+#define GFX_WIDGET_VALUE	0x10	//number value changed since the last GFXWidgetRender(), digits repainted by cell
+
+/**
+ * @note	Node of a retained widget tree, owned by the caller (static storage, no heap). Set up with GFXWidgetInit*(),
+ *			linked with GFXWidgetAdd() and changed with GFXWidgetSet*() only, so changes are tracked.
+ *			Coordinates are absolute LCD pixels; children are painted after their parent, in the order they were added.
+ */
+typedef struct GFX_WIDGET
+{
+	GFX_WIDGET_TYPE	type;
+	uint8_t		flags;
+	COLOR		color;						//rect, label and number color
+	COLOR		bg;							//group, label and number background, TRANSPARENT to draw over what is below
+	uint16_t	left, top, width, height;	//bounding box, from the content for labels and images
+	const void	*ptr;						//label and number: BFC_FONT, image: tImage
+	const char	*text;						//label text
+	int32_t		value;						//number value, image: true for negative
+	uint16_t	drawnLeft, drawnTop, drawnRight, drawnBottom;	//box painted by the last GFXWidgetRender()
+	int32_t		drawnValue;					//number value painted by the last GFXWidgetRender()
+	uint8_t		digits;						//number field width in cells of the widest digit
+	struct GFX_WIDGET *parent, *child, *next;
+} GFX_WIDGET;
+
+/**
+ * @note	Frame of a GFX_ANIM sequence, usually in a const array next to the images
+ */
+typedef struct
+{
+	const tImage	*image;
+	uint16_t	ms;							//time the frame is shown
+} GFX_ANIM_FRAME;
+
+//@note GFX_ANIM.flags
+#define GFX_ANIM_SHOWN		0x01	//on the LCD after the next GFXAnimTick(), erased by it otherwise
+#define GFX_ANIM_RUNNING	0x02	//frames advance with GFXAnimTick()
+#define GFX_ANIM_DRAWN		0x04	//drawnImage on the LCD at drawnLeft,drawnTop since the last GFXAnimTick()
+
+/**
+ * @note	Animation of a frame sequence at a position, owned by the caller (static storage, no heap). Set up with
+ *			GFXAnimInit(), linked with GFXAnimAdd() and driven by GFXAnimTick(). The box is the size of the largest frame.
+ */
+typedef struct GFX_ANIM
+{
+	const GFX_ANIM_FRAME *frames;
+	uint16_t	count;						//frames in the sequence
+	uint16_t	frame;						//frame shown, or shown by the next GFXAnimTick()
+	uint16_t	loops;						//sequences left to play, 0 to repeat them forever
+	uint8_t		flags;
+	COLOR		bg;							//box around smaller frames and erased box, TRANSPARENT to draw the black pixels only
+	uint16_t	left, top, width, height;	//box of the largest frame
+	uint32_t	dueMs;						//hal_millis() when the next frame is due
+	uint8_t		*under;						//TRANSPARENT: frame buffer bytes under the box, GFX_ANIM_UNDER_SIZE() bytes
+	uint16_t	drawnLeft, drawnTop;		//position painted by the last GFXAnimTick()
+	const tImage *drawnImage;				//frame painted by the last GFXAnimTick()
+	struct GFX_ANIM *next;
+} GFX_ANIM;
+
+//@note Bytes saved under a TRANSPARENT animation whose largest frame is width x height pixels
+#define GFX_ANIM_UNDER_SIZE(width, height)	((((width) + 7) / 8 + 1) * (uint32_t)(height))
+
+//@note Transfer buffer size of GFXDisplayFlushAsync() holding every line of a model: 2-byte header and the row per line, 2 dummy bytes
+#define GFX_TRANSFER_SIZE(model)	((((model##_HOR_RESOLUTION + 7) / 8) + 2) * model##_VER_RESOLUTION + 2)
+
 /**
  * @note	HAL functions to be implemented by individual hardware platform
  */
 void		hal_bsp_init(void);
-inline void	hal_gpio_write(uint8_t pin, bool level);
+void		hal_gpio_write(uint8_t pin, bool level);
 void		hal_delayMs(uint32_t ms);
 void		hal_delayUs(uint32_t us);
-inline void hal_spi_start_transaction(void);
-inline void hal_spi_end_transaction(void);
-inline void hal_spi_write_byte(uint8_t val);
+uint32_t	hal_millis(void);
+void		hal_spi_start_transaction(void);
+void		hal_spi_end_transaction(void);
+void		hal_spi_write_byte(uint8_t val);
+void		hal_spi_write_buffer(const uint8_t *buf, uint16_t len);
+bool		hal_spi_write_dma(const uint8_t *buf, uint32_t len, void (*pfcnDone)(void));
+void		hal_spi_dma_wait(void);
 void    hal_extcom_start(uint8_t hz);
 void    hal_extcom_stop(void);
 void	hal_extcom_toggle(void);
@@ -135,17 +560,72 @@ void GFXDisplayPowerOn(void);
 void GFXDisplayOn(void);
 void GFXDisplayPowerOff(void);
 void GFXDisplayOff(void);
+bool GFXDisplayVcomService(void);
 void GFXDisplayPutPixel(uint16_t x, uint16_t y, COLOR color);
 void GFXDisplayLineDrawH(uint16_t x1, uint16_t x2, uint16_t y, COLOR color, uint8_t thick);
 void GFXDisplayLineDrawV(uint16_t x, uint16_t y1, uint16_t y2, COLOR color, uint8_t thick);
 void GFXDisplayDrawRect(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, COLOR color);
+void GFXDisplayDrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, COLOR color);
+void GFXDisplayDrawCircle(uint16_t x0, uint16_t y0, uint16_t r, COLOR color);
+void GFXDisplayFillCircle(uint16_t x0, uint16_t y0, uint16_t r, COLOR color);
+void GFXDisplayDrawEllipse(uint16_t x0, uint16_t y0, uint16_t rx, uint16_t ry, COLOR color);
+void GFXDisplayFillEllipse(uint16_t x0, uint16_t y0, uint16_t rx, uint16_t ry, COLOR color);
+void GFXDisplayChartInit(GFX_CHART *pChart, uint16_t left, uint16_t top, uint16_t width, uint16_t height,
+						 int16_t minValue, int16_t maxValue, GFX_CHART_MODE mode, uint16_t *history);
+void GFXDisplayChartClear(GFX_CHART *pChart);
+uint16_t GFXDisplayChartAddSamples(GFX_CHART *pChart, const int16_t *samples, uint16_t count);
 //void GFXDisplayPutPicture(uint16_t left, uint16_t top, const uint8_t* data, bool invert);
+void GFXWidgetInitGroup(GFX_WIDGET *pWidget, uint16_t left, uint16_t top, uint16_t width, uint16_t height, COLOR bg);
+void GFXWidgetInitRect(GFX_WIDGET *pWidget, uint16_t left, uint16_t top, uint16_t width, uint16_t height, COLOR color);
+void GFXWidgetInitLabel(GFX_WIDGET *pWidget, uint16_t left, uint16_t top, const BFC_FONT *pFont, const char *text, COLOR color, COLOR bg);
+void GFXWidgetInitImage(GFX_WIDGET *pWidget, uint16_t left, uint16_t top, const tImage *image, bool invert);
+void GFXWidgetInitNumber(GFX_WIDGET *pWidget, uint16_t left, uint16_t top, const BFC_FONT *pFont, uint8_t digits, int32_t value,
+						 COLOR color, COLOR bg);
+void GFXWidgetAdd(GFX_WIDGET *pParent, GFX_WIDGET *pWidget);
+void GFXWidgetSetText(GFX_WIDGET *pWidget, const char *text);
+bool GFXWidgetSetValue(GFX_WIDGET *pWidget, int32_t value);
+void GFXWidgetSetImage(GFX_WIDGET *pWidget, const tImage *image, bool invert);
+void GFXWidgetSetColor(GFX_WIDGET *pWidget, COLOR color, COLOR bg);
+void GFXWidgetMove(GFX_WIDGET *pWidget, uint16_t left, uint16_t top);
+void GFXWidgetSetVisible(GFX_WIDGET *pWidget, bool visible);
+void GFXWidgetInvalidate(GFX_WIDGET *pWidget);
+uint16_t GFXWidgetRender(GFX_WIDGET *pRoot);
+void GFXAnimInit(GFX_ANIM *pAnim, const GFX_ANIM_FRAME *frames, uint16_t count, uint16_t left, uint16_t top, COLOR bg, uint8_t *under);
+void GFXAnimAdd(GFX_ANIM *pFirst, GFX_ANIM *pAnim);
+void GFXAnimStart(GFX_ANIM *pAnim, uint16_t loops);
+void GFXAnimStop(GFX_ANIM *pAnim, bool erase);
+void GFXAnimMove(GFX_ANIM *pAnim, uint16_t left, uint16_t top);
+uint16_t GFXAnimTick(GFX_ANIM *pFirst);
+
 void GFXDisplayPutImage(uint16_t left, uint16_t top, const tImage* image, bool invert);
 uint32_t GFXDisplayTestPattern(uint8_t pattern, void (*pfcn)(void));
 uint16_t GFXDisplayPutChar(uint16_t x, uint16_t y, const BFC_FONT* pFont, const uint16_t ch, COLOR color, COLOR bg);
 uint16_t GFXDisplayPutString(uint16_t x, uint16_t y, const BFC_FONT* pFont, const char *str, COLOR color, COLOR bg);
 uint16_t GFXDisplayPutWString(uint16_t x, uint16_t y, const BFC_FONT* pFont, const uint16_t *str, COLOR color, COLOR bg);
 
+void GFXDisplayInit(GFX_DISPLAY *pDisplay, const GFX_DISPLAY_DESC *pDesc, uint8_t *frameBuffer, uint8_t *dirtyLines, void *shadow);
+void GFXDisplayInitBanded(GFX_DISPLAY *pDisplay, const GFX_DISPLAY_DESC *pDesc, uint8_t *bandBuffer, uint16_t bandLines,
+						  uint8_t *bandList, uint16_t bandListSize, uint8_t *dirtyLines, void *shadow);
+uint16_t GFXDisplayGetBandListUsed(uint16_t *pDropped);
+void GFXDisplaySelect(GFX_DISPLAY *pDisplay);
+GFX_DISPLAY* GFXDisplayGetSelected(void);
+const GFX_DISPLAY_DESC* GFXDisplayGetDesc(void);
+
+void GFXDisplaySetFlushMode(GFX_FLUSH_MODE mode);
+GFX_FLUSH_MODE GFXDisplayGetFlushMode(void);
+void GFXDisplaySetRasterOp(GFX_ROP rop);
+GFX_ROP GFXDisplayGetRasterOp(void);
+bool GFXDisplaySetScrollRegion(uint16_t top, uint16_t rows);
+void GFXDisplayScroll(int16_t lines, COLOR fill);
+uint8_t* GFXDisplayGetRow(uint16_t y);
+uint16_t GFXDisplayFlush(void);
+void GFXDisplaySetTransferBuffer(uint8_t *buf, uint32_t size);
+uint16_t GFXDisplayFlushAsync(void (*pfcnDone)(uint16_t lines));
+bool GFXDisplayFlushBusy(void);
+void GFXDisplayFlushWait(void);
+void GFXDisplayGetStats(GFX_DISPLAY_STATS *pStats);
+void GFXDisplayResetStats(void);
+
 uint16_t GFXDisplayGetLCDWidth(void);
 uint16_t GFXDisplayGetLCDHeight(void);
 uint16_t GFXDisplayGetCharWidth(const BFC_FONT *pFont, const uint16_t ch);
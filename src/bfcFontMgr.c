@@ -1,3 +1,4 @@
+#include <string.h>
 #include "bfcFontMgr.h"
 
 /**
@@ -92,15 +93,219 @@ int GetFontHeight(const BFC_FONT *pFont)
 	return height;
 }
 
+#if (BFC_INDEX_FONTS > 0)
+#define BFC_INDEX_ASCII		128
+#define BFC_INDEX_NONE		0xFF
+
+typedef struct
+{
+	const BFC_FONT		*pFont;		// 0 for a free slot
+	const BFC_FONT_PROP	*pFirst;	// range 0 in character order when the font's ranges are evenly spaced in memory
+	const BFC_FONT_PROP	**pTable;	// ranges in character order in indexTable[] otherwise, 0 for the font's own ranges
+	const BFC_FONT_PROP	*pLastProp;	// last range of the list, its first character is returned for characters not in the font
+	long				spacing;	// bytes from one range to the next in character order
+	unsigned short		count;		// number of ranges
+	unsigned char		ascii[BFC_INDEX_ASCII];	// range of characters 0x00~0x7F, BFC_INDEX_NONE if not in this font
+} BFC_INDEX;
+
+static BFC_INDEX indexFonts[BFC_INDEX_FONTS];
+static const BFC_FONT_PROP *indexTable[BFC_INDEX_RANGES];
+static unsigned short indexTableUsed = 0;
+static const BFC_FONT *pLastFont = 0;	// most recent font and its index, 0 if not indexed: strings are drawn with one font at a time
+static BFC_INDEX *pLastIndex = 0;
+
+/**
+ * @brief	Range k of an indexed font in character order
+ */
+static inline const BFC_FONT_PROP* IndexRange(const BFC_INDEX *pIndex, unsigned short k)
+{
+	if(pIndex->pTable != 0)
+		return pIndex->pTable[k];
+	return (const BFC_FONT_PROP *)((const char *)pIndex->pFirst + pIndex->spacing * k);
+}
+
+/**
+ * @brief	Return the index slot of a font, building the index on the first call
+ * @return	pointer to the slot, or 0 if all slots are taken or the font is not indexed. A slot is only taken by a font
+ *			that is indexed.
+ * @note	The ranges BitFontCreator exports are declared one after the other and end up evenly spaced in flash, in
+ *			ascending or descending order: they are searched where they are. Other fonts have their ranges sorted into
+ *			indexTable[] if they fit. Fonts with overlapping ranges keep the list walk.
+ */
+static BFC_INDEX* GetFontIndex(const BFC_FONT *pFont)
+{
+	BFC_INDEX *pIndex = 0;
+	const BFC_FONT_PROP *pProp, *pPrev = 0;
+	unsigned short count = 0, i, j;
+	long spacing = 0;
+	int even = 1, ascending = 1;
+
+	for(i = 0; i < BFC_INDEX_FONTS; i++)
+	{
+		if(indexFonts[i].pFont == pFont)
+			return &indexFonts[i];
+		if(pIndex == 0 && indexFonts[i].pFont == 0)
+			pIndex = &indexFonts[i];
+	}
+	if(pIndex == 0)
+		return 0;
+
+	for(pProp = pFont->p.pProp; pProp != 0; pPrev = pProp, pProp = pProp->pNextProp, count++)
+	{
+		if(pPrev == 0)
+			continue;
+		if(pProp->FirstChar <= pPrev->LastChar)
+			ascending = 0;
+		if(count == 1)
+			spacing = (long)((const char *)pProp - (const char *)pPrev);
+		else if((long)((const char *)pProp - (const char *)pPrev) != spacing)
+			even = 0;
+	}
+	if(count < BFC_INDEX_MIN_RANGES)
+		return 0;
+
+	pIndex->count = count;
+	pIndex->pLastProp = pPrev;
+	if(even && ascending)
+	{
+		pIndex->pFirst = pFont->p.pProp;
+		pIndex->pTable = 0;
+		pIndex->spacing = spacing;
+	}
+	else
+	{
+		if(count > BFC_INDEX_RANGES - indexTableUsed)
+			return 0;
+
+		// insertion sort of the range pointers by first character
+		const BFC_FONT_PROP **pTable = &indexTable[indexTableUsed];
+		for(pProp = pFont->p.pProp, i = 0; pProp != 0; pProp = pProp->pNextProp, i++)
+		{
+			for(j = i; j > 0 && pTable[j-1]->FirstChar > pProp->FirstChar; j--)
+				pTable[j] = pTable[j-1];
+			pTable[j] = pProp;
+		}
+		// a character in two ranges is found in the first one of the list, the search could find the other one
+		for(i = 1; i < count; i++)
+		{
+			if(pTable[i]->FirstChar <= pTable[i-1]->LastChar)
+				return 0;
+		}
+		pIndex->pTable = pTable;
+		indexTableUsed += count;
+	}
+
+	memset(pIndex->ascii, BFC_INDEX_NONE, sizeof(pIndex->ascii));
+	for(i = 0; i < count && i < BFC_INDEX_NONE; i++)
+	{
+		pProp = IndexRange(pIndex, i);
+		if(pProp->FirstChar >= BFC_INDEX_ASCII)
+			break;
+		for(j = pProp->FirstChar; j <= pProp->LastChar && j < BFC_INDEX_ASCII; j++)
+			pIndex->ascii[j] = (unsigned char)i;
+	}
+
+	pIndex->pFont = pFont;
+	return pIndex;
+}
+
+/**
+ * @brief	Look a character up in an indexed font, through the ASCII table or a binary search over the ranges
+ */
+static const BFC_CHARINFO* IndexLookup(const BFC_INDEX *pIndex, unsigned short ch)
+{
+	const BFC_FONT_PROP *pProp;
+
+	if(ch < BFC_INDEX_ASCII)
+	{
+		if(pIndex->ascii[ch] == BFC_INDEX_NONE)
+			return pIndex->pLastProp->pFirstCharInfo;
+		pProp = IndexRange(pIndex, pIndex->ascii[ch]);
+		return pProp->pFirstCharInfo + (ch - pProp->FirstChar);
+	}
+
+	// binary search for the last range with FirstChar <= ch
+	unsigned short lo = 0, hi = pIndex->count;
+	while(lo < hi)
+	{
+		unsigned short mid = (lo + hi) / 2;
+		if(IndexRange(pIndex, mid)->FirstChar <= ch)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if(lo > 0)
+	{
+		pProp = IndexRange(pIndex, lo - 1);
+		if(ch <= pProp->LastChar)
+			return pProp->pFirstCharInfo + (ch - pProp->FirstChar);
+	}
+	return pIndex->pLastProp->pFirstCharInfo;
+}
+
+int BuildFontIndex(const BFC_FONT *pFont)
+{
+	if(pFont == 0 || pFont->p.pProp == 0)
+		return 0;
+
+	pLastFont = 0;
+	return (GetFontIndex(pFont) != 0) ? 1 : 0;
+}
+
+void ResetFontIndex(void)
+{
+	memset(indexFonts, 0, sizeof(indexFonts));
+	indexTableUsed = 0;
+	pLastFont = 0;
+	pLastIndex = 0;
+}
+#else
+int BuildFontIndex(const BFC_FONT *pFont)
+{
+	(void)pFont;
+	return 0;
+}
+
+void ResetFontIndex(void)
+{
+}
+#endif
+
+/**
+ * @brief	Return the BFC_CHARINFO of a character
+ * @param	pFont is a pointer to a proportional font
+ * @param	ch is the character code
+ * @return	pointer to the character information. If the character is not rendered in this font, the first character of the
+ *			last range is returned, as the list walk always did.
+ * @note	Fonts of BFC_INDEX_MIN_RANGES ranges or more are looked up with the ASCII table or a binary search over their
+ *			ranges (see BFC_INDEX_FONTS), other fonts walk the BFC_FONT_PROP list.
+ */
 const BFC_CHARINFO* GetCharInfo(const BFC_FONT *pFont, unsigned short ch)
 {
 	const BFC_CHARINFO	*pCharInfo = 0;
-	const BFC_FONT_PROP *pProp = pFont->p.pProp;
+	const BFC_FONT_PROP *pProp;
 	unsigned short first_char, last_char;
 
 	if(pFont == 0 || pFont->p.pProp == 0)
 		return 0;
 
+	pProp = pFont->p.pProp;
+
+#if (BFC_INDEX_FONTS > 0)
+	// the first range, ASCII in most fonts, is the first step of the list walk and needs no index
+	if(ch >= pProp->FirstChar && ch <= pProp->LastChar)
+		return pProp->pFirstCharInfo + (ch - pProp->FirstChar);
+
+	if(pFont != pLastFont)
+	{
+		pLastIndex = GetFontIndex(pFont);
+		pLastFont = pFont;
+	}
+	if(pLastIndex != 0)
+		return IndexLookup(pLastIndex, ch);
+	pProp = pProp->pNextProp;
+#endif
+
 	while(pProp != 0)
 	{
 		first_char = pProp->FirstChar;
@@ -3,6 +3,26 @@
 
 #include "bfcfont.h"
 
+/**
+ * @note	Character lookup index of fonts with many ranges, built on the first GetCharInfo() call for a font.<br>
+ *			Characters 0x00~0x7F are mapped directly to their range, others are found with a binary search over the
+ *			ranges in character order. The ranges of a BitFontCreator font are evenly spaced in flash and searched where
+ *			they are, other fonts have pointers to their ranges sorted into a table in static RAM.<br>
+ *			BFC_INDEX_FONTS  = number of fonts indexed at the same time, 128+24 bytes each on 32-bit MCUs (0 disables the index)<br>
+ *			BFC_INDEX_RANGES = table shared by fonts whose ranges are not evenly spaced, 4 bytes a range on 32-bit MCUs.
+ *			A font that does not fit is searched through its BFC_FONT_PROP list as before.<br>
+ *			BFC_INDEX_MIN_RANGES = fonts with fewer ranges keep the list walk, it is as fast for a handful of ranges
+ */
+#ifndef BFC_INDEX_FONTS
+#define BFC_INDEX_FONTS		2
+#endif
+#ifndef BFC_INDEX_RANGES
+#define BFC_INDEX_RANGES	64
+#endif
+#ifndef BFC_INDEX_MIN_RANGES
+#define BFC_INDEX_MIN_RANGES	16
+#endif
+
 #if defined(__cplusplus)
 extern "C" {     /* Make sure we have C-declarations in C++ programs */
 #endif
@@ -21,6 +41,10 @@ int   GetFontDataPack(unsigned long FontType);
 int   GetFontHeight(const BFC_FONT *pFont);
 //	get structure BFC_CHARINFO pointer
 const BFC_CHARINFO* GetCharInfo(const BFC_FONT *pFont, unsigned short ch);
+//	build the lookup index of a font ahead of the first GetCharInfo(), return 1 if the font is indexed
+int   BuildFontIndex(const BFC_FONT *pFont);
+//	drop all lookup indexes, e.g. before fonts in RAM are reloaded
+void  ResetFontIndex(void);
 
 #ifdef __cplusplus
 }
@@ -12,11 +12,24 @@ extern "C" {     /* Make sure we have C-declarations in C++ programs */
 
 #include <stdint.h>
 
+/**
+ * @note	Values of tImage.compression. Images generated by lcd-image-converter leave it out, i.e. TIMAGE_RAW, which -Wextra
+ *			reports as a missing initializer. The images of the examples set it, add ", TIMAGE_RAW" after the dataSize of new ones.<br>
+ *			TIMAGE_RAW: (width+7)/8 bytes per row, leftmost pixel in the MSB, bit set for white.<br>
+ *			TIMAGE_RLE: the same rows compressed with PackBits, one row after another and no run across two rows.
+ *			A header byte n in 0~127 is followed by n+1 literal bytes, n in -127~-1 by one byte repeated 1-n times.
+ *			A row made of the single byte -128 (0x80) is the same as the row above.
+ *			extras/host/image_rle.cpp converts .bmp and .c images.
+ */
+#define TIMAGE_RAW	0
+#define TIMAGE_RLE	1
+
 typedef struct {
      const uint8_t *data;
      uint16_t width;
      uint16_t height;
      uint8_t dataSize;
+     uint8_t compression;
      } tImage;
 	 
 #ifdef __cplusplus